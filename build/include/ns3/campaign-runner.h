@@ -0,0 +1 @@
+#include "/root/repo/src/stats/helper/campaign-runner.h"
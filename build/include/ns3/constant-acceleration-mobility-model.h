@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/constant-acceleration-mobility-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/emu-epc-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/core/model/int-to-type.h"
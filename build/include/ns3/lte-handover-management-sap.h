@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-handover-management-sap.h"
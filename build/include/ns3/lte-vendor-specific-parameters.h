@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/lte-vendor-specific-parameters.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/qos-blocked-destinations.h"
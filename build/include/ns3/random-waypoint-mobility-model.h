@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/random-waypoint-mobility-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/tdbet-ff-mac-scheduler.h"
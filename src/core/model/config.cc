@@ -26,7 +26,9 @@
 #include "pointer.h"
 #include "singleton.h"
 
+#include <map>
 #include <sstream>
+#include <unordered_map>
 
 /**
  * \file
@@ -197,6 +199,9 @@ MatchContainer::DisconnectWithoutContext(std::string name, const CallbackBase& c
 /**
  * \ingroup config-impl
  * Helper to test if an array entry matches a config path specification.
+ *
+ * The specification is parsed once, when the matcher is constructed,
+ * into a list of index ranges.
  */
 class ArrayMatcher
 {
@@ -214,8 +219,22 @@ class ArrayMatcher
      * \returns \c true if the index matches the Config Path.
      */
     bool Matches(std::size_t i) const;
+    /**
+     * Test if the Config path specification selects a single index.
+     *
+     * \param [out] i The selected index.
+     * \returns \c true if only the index \pname{i} can match.
+     */
+    bool IsSingleIndex(std::size_t* i) const;
 
   private:
+    /**
+     * Parse a Config path specification, or one of the alternatives
+     * of a specification, into index ranges.
+     *
+     * \param [in] element The Config path specification.
+     */
+    void Parse(std::string element);
     /**
      * Convert a string to an \c uint32_t.
      *
@@ -226,77 +245,94 @@ class ArrayMatcher
     bool StringToUint32(std::string str, uint32_t* value) const;
     /** The Config path element. */
     std::string m_element;
+    /** The Config path element matches every index. */
+    bool m_all;
+    /** The ranges of indices matching the Config path element, bounds included. */
+    std::vector<std::pair<uint32_t, uint32_t>> m_ranges;
 
 }; // class ArrayMatcher
 
 ArrayMatcher::ArrayMatcher(std::string element)
-    : m_element(element)
+    : m_element(element),
+      m_all(false)
 {
     NS_LOG_FUNCTION(this << element);
+    Parse(element);
 }
 
-bool
-ArrayMatcher::Matches(std::size_t i) const
+void
+ArrayMatcher::Parse(std::string element)
 {
-    NS_LOG_FUNCTION(this << i);
-    if (m_element == "*")
+    NS_LOG_FUNCTION(this << element);
+    if (element == "*")
     {
-        NS_LOG_DEBUG("Array " << i << " matches *");
-        return true;
+        m_all = true;
+        return;
     }
     std::string::size_type tmp;
-    tmp = m_element.find('|');
+    tmp = element.find('|');
     if (tmp != std::string::npos)
     {
-        std::string left = m_element.substr(0, tmp - 0);
-        std::string right = m_element.substr(tmp + 1, m_element.size() - (tmp + 1));
-        ArrayMatcher matcher = ArrayMatcher(left);
-        if (matcher.Matches(i))
-        {
-            NS_LOG_DEBUG("Array " << i << " matches " << left);
-            return true;
-        }
-        matcher = ArrayMatcher(right);
-        if (matcher.Matches(i))
-        {
-            NS_LOG_DEBUG("Array " << i << " matches " << right);
-            return true;
-        }
-        NS_LOG_DEBUG("Array " << i << " does not match " << m_element);
-        return false;
+        Parse(element.substr(0, tmp - 0));
+        Parse(element.substr(tmp + 1, element.size() - (tmp + 1)));
+        return;
     }
-    std::string::size_type leftBracket = m_element.find('[');
-    std::string::size_type rightBracket = m_element.find(']');
-    std::string::size_type dash = m_element.find('-');
-    if (leftBracket == 0 && rightBracket == m_element.size() - 1 && dash > leftBracket &&
+    std::string::size_type leftBracket = element.find('[');
+    std::string::size_type rightBracket = element.find(']');
+    std::string::size_type dash = element.find('-');
+    if (leftBracket == 0 && rightBracket == element.size() - 1 && dash > leftBracket &&
         dash < rightBracket)
     {
-        std::string lowerBound = m_element.substr(leftBracket + 1, dash - (leftBracket + 1));
-        std::string upperBound = m_element.substr(dash + 1, rightBracket - (dash + 1));
+        std::string lowerBound = element.substr(leftBracket + 1, dash - (leftBracket + 1));
+        std::string upperBound = element.substr(dash + 1, rightBracket - (dash + 1));
         uint32_t min;
         uint32_t max;
-        if (StringToUint32(lowerBound, &min) && StringToUint32(upperBound, &max) && i >= min &&
-            i <= max)
+        if (StringToUint32(lowerBound, &min) && StringToUint32(upperBound, &max) && min <= max)
         {
-            NS_LOG_DEBUG("Array " << i << " matches " << m_element);
-            return true;
-        }
-        else
-        {
-            NS_LOG_DEBUG("Array " << i << " does not " << m_element);
-            return false;
+            m_ranges.emplace_back(min, max);
         }
+        return;
     }
     uint32_t value;
-    if (StringToUint32(m_element, &value) && i == value)
+    if (StringToUint32(element, &value))
     {
-        NS_LOG_DEBUG("Array " << i << " matches " << m_element);
+        m_ranges.emplace_back(value, value);
+    }
+}
+
+bool
+ArrayMatcher::Matches(std::size_t i) const
+{
+    NS_LOG_FUNCTION(this << i);
+    if (m_all)
+    {
+        NS_LOG_DEBUG("Array " << i << " matches *");
         return true;
     }
+    for (const auto& range : m_ranges)
+    {
+        if (i >= range.first && i <= range.second)
+        {
+            NS_LOG_DEBUG("Array " << i << " matches " << m_element);
+            return true;
+        }
+    }
     NS_LOG_DEBUG("Array " << i << " does not match " << m_element);
     return false;
 }
 
+bool
+ArrayMatcher::IsSingleIndex(std::size_t* i) const
+{
+    NS_LOG_FUNCTION(this << i);
+    if (m_all || m_ranges.size() != 1 || m_ranges.front().first != m_ranges.front().second)
+    {
+        return false;
+    }
+    *i = m_ranges.front().first;
+    return true;
+}
+
 bool
 ArrayMatcher::StringToUint32(std::string str, uint32_t* value) const
 {
@@ -310,6 +346,12 @@ ArrayMatcher::StringToUint32(std::string str, uint32_t* value) const
 /**
  * \ingroup config-impl
  * Abstract class to parse Config paths into object references.
+ *
+ * The Config path is split into its elements once, at construction, and
+ * the attributes through which a path can go from an object to another
+ * are indexed by TypeId the first time an instance of that TypeId is
+ * traversed, so that resolving a path does not scan the attribute list
+ * of every object met along the way.
  */
 class Resolver
 {
@@ -333,23 +375,39 @@ class Resolver
     void Resolve(Ptr<Object> root);
 
   private:
+    /** An attribute through which a Config path can lead to other objects. */
+    struct PathAttribute
+    {
+        /** The attribute name. */
+        std::string name;
+        /** The attribute accessor. */
+        Ptr<const AttributeAccessor> accessor;
+        /** The container accessor, or null for a Pointer attribute. */
+        const ObjectPtrContainerAccessor* containerAccessor;
+        /** Whether the attribute value can be read. */
+        bool gettable;
+    };
+
     /** Ensure the Config path starts and ends with a '/'. */
     void Canonicalize();
     /**
      * Parse the next element in the Config path.
      *
-     * \param [in] path The remaining portion of the Config path.
+     * \param [in] element The index in m_elements of the next element.
      * \param [in] root The object corresponding to the current position
      *                  in the Config path.
      */
-    void DoResolve(std::string path, Ptr<Object> root);
+    void DoResolve(std::size_t element, Ptr<Object> root);
     /**
      * Parse an index on the Config path.
      *
-     * \param [in] path The remaining Config path.
-     * \param [in,out] vector The resulting list of matching objects.
+     * \param [in] element The index in m_elements of the index element.
+     * \param [in] root The object holding the container.
+     * \param [in] accessor The accessor of the container.
      */
-    void DoArrayResolve(std::string path, const ObjectPtrContainerValue& vector);
+    void DoArrayResolve(std::size_t element,
+                        Ptr<Object> root,
+                        const ObjectPtrContainerAccessor* accessor);
     /**
      * Handle one object found on the path.
      *
@@ -369,11 +427,21 @@ class Resolver
      * \param [in] path The matching Config path context.
      */
     virtual void DoOne(Ptr<Object> object, std::string path) = 0;
+    /**
+     * Get the Pointer and ObjectPtrContainer attributes of a TypeId,
+     * including those of its parents.
+     *
+     * \param [in] tid The TypeId.
+     * \returns The attributes, in the order they are searched for a match.
+     */
+    static const std::vector<PathAttribute>& GetPathAttributes(TypeId tid);
 
     /** Current list of path tokens. */
     std::vector<std::string> m_workStack;
     /** The Config path. */
     std::string m_path;
+    /** The elements of the Config path. */
+    std::vector<std::string> m_elements;
 
 }; // class Resolver
 
@@ -382,6 +450,15 @@ Resolver::Resolver(std::string path)
 {
     NS_LOG_FUNCTION(this << path);
     Canonicalize();
+
+    std::string::size_type start = 1;
+    std::string::size_type next = m_path.find('/', start);
+    while (next != std::string::npos)
+    {
+        m_elements.push_back(m_path.substr(start, next - start));
+        start = next + 1;
+        next = m_path.find('/', start);
+    }
 }
 
 Resolver::~Resolver()
@@ -414,7 +491,7 @@ Resolver::Resolve(Ptr<Object> root)
 {
     NS_LOG_FUNCTION(this << root);
 
-    DoResolve(m_path, root);
+    DoResolve(0, root);
 }
 
 std::string
@@ -440,14 +517,63 @@ Resolver::DoResolveOne(Ptr<Object> object)
     DoOne(object, GetResolvedPath());
 }
 
+const std::vector<Resolver::PathAttribute>&
+Resolver::GetPathAttributes(TypeId tid)
+{
+    NS_LOG_FUNCTION(tid);
+
+    static std::unordered_map<uint16_t, std::vector<PathAttribute>> pathAttributes;
+
+    uint16_t uid = tid.GetUid();
+    auto it = pathAttributes.find(uid);
+    if (it != pathAttributes.end())
+    {
+        return it->second;
+    }
+
+    std::vector<PathAttribute> attributes;
+    TypeId nextTid = tid;
+    do
+    {
+        tid = nextTid;
+
+        for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+        {
+            struct TypeId::AttributeInformation info;
+            info = tid.GetAttribute(i);
+            bool gettable = (info.flags & TypeId::ATTR_GET) && info.accessor->HasGetter();
+            // attempt to cast to a pointer checker.
+            if (dynamic_cast<const PointerChecker*>(PeekPointer(info.checker)) != nullptr)
+            {
+                attributes.push_back({info.name, info.accessor, nullptr, gettable});
+            }
+            // attempt to cast to an object vector.
+            if (dynamic_cast<const ObjectPtrContainerChecker*>(PeekPointer(info.checker)) !=
+                nullptr)
+            {
+                const ObjectPtrContainerAccessor* accessor =
+                    dynamic_cast<const ObjectPtrContainerAccessor*>(PeekPointer(info.accessor));
+                NS_ASSERT_MSG(accessor != nullptr,
+                              "Attribute " << info.name << " of " << tid.GetName()
+                                           << " has no ObjectPtrContainerAccessor");
+                attributes.push_back({info.name, info.accessor, accessor, gettable});
+            }
+            // this could be anything else and we don't know what to do with it.
+            // So, we just ignore it.
+        }
+
+        nextTid = tid.GetParent();
+    } while (nextTid != tid);
+
+    return pathAttributes.emplace(uid, std::move(attributes)).first->second;
+}
+
 void
-Resolver::DoResolve(std::string path, Ptr<Object> root)
+Resolver::DoResolve(std::size_t element, Ptr<Object> root)
 {
-    NS_LOG_FUNCTION(this << path << root);
-    NS_ASSERT((path.find('/')) == 0);
-    std::string::size_type next = path.find('/', 1);
+    NS_LOG_FUNCTION(this << element << root);
 
-    if (next == std::string::npos)
+    if (element == m_elements.size())
     {
         //
         // If root is zero, we're beginning to see if we can use the object name
@@ -463,8 +589,7 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
         }
         return;
     }
-    std::string item = path.substr(1, next - 1);
-    std::string pathLeft = path.substr(next, path.size() - next);
+    const std::string& item = m_elements[element];
 
     //
     // If root is zero, we're beginning to see if we can use the object name
@@ -475,11 +600,10 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
     //
     if (!root)
     {
-        std::string::size_type offset = path.find("/Names");
-        if (offset == 0)
+        if (item.compare(0, 5, "Names") == 0)
         {
             m_workStack.push_back(item);
-            DoResolve(pathLeft, root);
+            DoResolve(element + 1, root);
             m_workStack.pop_back();
             return;
         }
@@ -496,7 +620,7 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
     {
         NS_LOG_DEBUG("Name system resolved item = " << item << " to " << namedObject);
         m_workStack.push_back(item);
-        DoResolve(pathLeft, namedObject);
+        DoResolve(element + 1, namedObject);
         m_workStack.pop_back();
         return;
     }
@@ -526,71 +650,56 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
             return;
         }
         m_workStack.push_back(item);
-        DoResolve(pathLeft, object);
+        DoResolve(element + 1, object);
         m_workStack.pop_back();
     }
     else
     {
         // this is a normal attribute.
-        TypeId tid;
-        TypeId nextTid = root->GetInstanceTypeId();
         bool foundMatch = false;
 
-        do
+        for (const auto& attribute : GetPathAttributes(root->GetInstanceTypeId()))
         {
-            tid = nextTid;
-
-            for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+            if (attribute.name != item && item != "*")
+            {
+                continue;
+            }
+            if (!attribute.gettable)
             {
-                struct TypeId::AttributeInformation info;
-                info = tid.GetAttribute(i);
-                if (info.name != item && item != "*")
+                NS_FATAL_ERROR("Attribute name=" << attribute.name
+                                                 << " is not gettable for this object: tid="
+                                                 << root->GetInstanceTypeId().GetName());
+            }
+            if (attribute.containerAccessor == nullptr)
+            {
+                NS_LOG_DEBUG("GetAttribute(ptr)=" << attribute.name
+                                                  << " on path=" << GetResolvedPath());
+                PointerValue pValue;
+                attribute.accessor->Get(PeekPointer(root), pValue);
+                Ptr<Object> object = pValue.Get<Object>();
+                if (!object)
                 {
+                    NS_LOG_ERROR("Requested object name=\"" << item << "\" exists on path=\""
+                                                            << GetResolvedPath()
+                                                            << "\""
+                                                               " but is null.");
                     continue;
                 }
-                // attempt to cast to a pointer checker.
-                const PointerChecker* pChecker =
-                    dynamic_cast<const PointerChecker*>(PeekPointer(info.checker));
-                if (pChecker != nullptr)
-                {
-                    NS_LOG_DEBUG("GetAttribute(ptr)=" << info.name
-                                                      << " on path=" << GetResolvedPath());
-                    PointerValue pValue;
-                    root->GetAttribute(info.name, pValue);
-                    Ptr<Object> object = pValue.Get<Object>();
-                    if (!object)
-                    {
-                        NS_LOG_ERROR("Requested object name=\"" << item << "\" exists on path=\""
-                                                                << GetResolvedPath()
-                                                                << "\""
-                                                                   " but is null.");
-                        continue;
-                    }
-                    foundMatch = true;
-                    m_workStack.push_back(info.name);
-                    DoResolve(pathLeft, object);
-                    m_workStack.pop_back();
-                }
-                // attempt to cast to an object vector.
-                const ObjectPtrContainerChecker* vectorChecker =
-                    dynamic_cast<const ObjectPtrContainerChecker*>(PeekPointer(info.checker));
-                if (vectorChecker != nullptr)
-                {
-                    NS_LOG_DEBUG("GetAttribute(vector)=" << info.name << " on path="
-                                                         << GetResolvedPath() << pathLeft);
-                    foundMatch = true;
-                    ObjectPtrContainerValue vector;
-                    root->GetAttribute(info.name, vector);
-                    m_workStack.push_back(info.name);
-                    DoArrayResolve(pathLeft, vector);
-                    m_workStack.pop_back();
-                }
-                // this could be anything else and we don't know what to do with it.
-                // So, we just ignore it.
+                foundMatch = true;
+                m_workStack.push_back(attribute.name);
+                DoResolve(element + 1, object);
+                m_workStack.pop_back();
             }
-
-            nextTid = tid.GetParent();
-        } while (nextTid != tid);
+            else
+            {
+                NS_LOG_DEBUG("GetAttribute(vector)=" << attribute.name
+                                                     << " on path=" << GetResolvedPath());
+                foundMatch = true;
+                m_workStack.push_back(attribute.name);
+                DoArrayResolve(element + 1, root, attribute.containerAccessor);
+                m_workStack.pop_back();
+            }
+        }
 
         if (!foundMatch)
         {
@@ -602,32 +711,56 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
 }
 
 void
-Resolver::DoArrayResolve(std::string path, const ObjectPtrContainerValue& container)
+Resolver::DoArrayResolve(std::size_t element,
+                         Ptr<Object> root,
+                         const ObjectPtrContainerAccessor* accessor)
 {
-    NS_LOG_FUNCTION(this << path << &container);
-    NS_ASSERT(!path.empty());
-    NS_ASSERT((path.find('/')) == 0);
-    std::string::size_type next = path.find('/', 1);
-    if (next == std::string::npos)
+    NS_LOG_FUNCTION(this << element << root << accessor);
+    if (element == m_elements.size())
     {
         return;
     }
-    std::string item = path.substr(1, next - 1);
-    std::string pathLeft = path.substr(next, path.size() - next);
+    std::size_t n;
+    if (!accessor->GetN(PeekPointer(root), &n))
+    {
+        return;
+    }
+
+    ArrayMatcher matcher = ArrayMatcher(m_elements[element]);
 
-    ArrayMatcher matcher = ArrayMatcher(item);
-    ObjectPtrContainerValue::Iterator it;
-    for (it = container.Begin(); it != container.End(); ++it)
+    // Most paths select a single index, which is usually the position of
+    // the object in the container: check that position first, to avoid
+    // walking the whole container.
+    std::size_t single;
+    if (matcher.IsSingleIndex(&single) && single < n)
     {
-        if (matcher.Matches((*it).first))
+        std::size_t index;
+        Ptr<Object> object = accessor->GetItem(PeekPointer(root), single, &index);
+        if (index == single)
         {
-            std::ostringstream oss;
-            oss << (*it).first;
-            m_workStack.push_back(oss.str());
-            DoResolve(pathLeft, (*it).second);
+            m_workStack.push_back(std::to_string(index));
+            DoResolve(element + 1, object);
             m_workStack.pop_back();
+            return;
         }
     }
+
+    std::map<std::size_t, Ptr<Object>> matches;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        std::size_t index;
+        Ptr<Object> object = accessor->GetItem(PeekPointer(root), i, &index);
+        if (matcher.Matches(index))
+        {
+            matches[index] = object;
+        }
+    }
+    for (const auto& [index, object] : matches)
+    {
+        m_workStack.push_back(std::to_string(index));
+        DoResolve(element + 1, object);
+        m_workStack.pop_back();
+    }
 }
 
 /**
@@ -358,6 +358,11 @@ class MatchContainer
  * \param [in] path The path to perform a match against
  * \returns A container which contains all the objects which match the input
  *          path.
+ *
+ * The returned container can be kept to perform several Set or Connect
+ * operations on the matching objects without resolving the path again,
+ * which is much cheaper than calling Config::Set or Config::Connect with
+ * the same path several times.
  */
 MatchContainer LookupMatches(std::string path);
 
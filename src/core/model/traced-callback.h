@@ -22,7 +22,9 @@
 
 #include "callback.h"
 
+#include <algorithm>
 #include <list>
+#include <vector>
 
 /**
  * \file
@@ -47,6 +49,15 @@ namespace ns3
  * calling the \c operator() form with the appropriate
  * number of arguments.
  *
+ * Most trace sources have no Callback connected, so invoking an empty
+ * chain only costs an inlined test, and the Callbacks are stored
+ * contiguously.  Call sites which spend time computing the arguments
+ * of a trace source should still check IsEmpty() first.
+ *
+ * A Callback may connect or disconnect Callbacks (including itself)
+ * while the chain is invoked: the Callbacks connected meanwhile are
+ * invoked as well, those disconnected meanwhile are no longer invoked.
+ *
  * \tparam Ts \explicit Types of the functor arguments.
  */
 template <typename... Ts>
@@ -89,7 +100,14 @@ class TracedCallback
      * \tparam Ts \deduced Types of the functor arguments.
      * \param [in] args The arguments to the functor
      */
-    void operator()(Ts... args) const;
+    void operator()(Ts... args) const
+    {
+        if (m_callbackList.empty())
+        {
+            return;
+        }
+        Invoke(args...);
+    }
     /**
      * \brief Checks if the Callbacks list is empty.
      * \return true if the Callbacks list is empty.
@@ -108,14 +126,24 @@ class TracedCallback
     /**@}*/
 
   private:
+    /**
+     * Invoke the chain of Callbacks, which is not empty.
+     * \param [in] args The arguments to the functor
+     */
+    void Invoke(const Ts&... args) const;
+
     /**
      * Container type for holding the chain of Callbacks.
      *
      * \tparam Ts \deduced Types of the functor arguments.
      */
-    typedef std::list<Callback<void, Ts...>> CallbackList;
+    typedef std::vector<Callback<void, Ts...>> CallbackList;
     /** The chain of Callbacks. */
-    CallbackList m_callbackList;
+    mutable CallbackList m_callbackList;
+    /** The number of invocations of the chain in progress. */
+    mutable uint32_t m_invocations;
+    /** Whether Callbacks were disconnected while the chain was invoked. */
+    mutable bool m_disconnected;
 };
 
 } // namespace ns3
@@ -129,7 +157,9 @@ namespace ns3
 
 template <typename... Ts>
 TracedCallback<Ts...>::TracedCallback()
-    : m_callbackList()
+    : m_callbackList(),
+      m_invocations(0),
+      m_disconnected(false)
 {
 }
 
@@ -162,18 +192,27 @@ template <typename... Ts>
 void
 TracedCallback<Ts...>::DisconnectWithoutContext(const CallbackBase& callback)
 {
-    for (typename CallbackList::iterator i = m_callbackList.begin(); i != m_callbackList.end();
-         /* empty */)
+    if (m_invocations > 0)
     {
-        if ((*i).IsEqual(callback))
-        {
-            i = m_callbackList.erase(i);
-        }
-        else
+        // The chain is being invoked: do not shift the Callbacks, which would
+        // make the invocation skip some of them, but null the disconnected
+        // ones, which are removed once the invocation is complete
+        for (auto& cb : m_callbackList)
         {
-            i++;
+            if (!cb.IsNull() && cb.IsEqual(callback))
+            {
+                cb = Callback<void, Ts...>();
+                m_disconnected = true;
+            }
         }
+        return;
     }
+    m_callbackList.erase(std::remove_if(m_callbackList.begin(),
+                                        m_callbackList.end(),
+                                        [&callback](const Callback<void, Ts...>& cb) {
+                                            return cb.IsEqual(callback);
+                                        }),
+                         m_callbackList.end());
 }
 
 template <typename... Ts>
@@ -191,13 +230,29 @@ TracedCallback<Ts...>::Disconnect(const CallbackBase& callback, std::string path
 
 template <typename... Ts>
 void
-TracedCallback<Ts...>::operator()(Ts... args) const
+TracedCallback<Ts...>::Invoke(const Ts&... args) const
 {
-    for (typename CallbackList::const_iterator i = m_callbackList.begin();
-         i != m_callbackList.end();
-         i++)
+    // Callbacks may be connected while the chain is invoked, which can
+    // reallocate the container: index it rather than holding iterators.
+    // The Callback is copied because it may be disconnected while it runs.
+    m_invocations++;
+    for (std::size_t i = 0; i < m_callbackList.size(); i++)
+    {
+        if (!m_callbackList[i].IsNull())
+        {
+            Callback<void, Ts...> cb = m_callbackList[i];
+            cb(args...);
+        }
+    }
+    if (--m_invocations == 0 && m_disconnected)
     {
-        (*i)(args...);
+        m_callbackList.erase(std::remove_if(m_callbackList.begin(),
+                                            m_callbackList.end(),
+                                            [](const Callback<void, Ts...>& cb) {
+                                                return cb.IsNull();
+                                            }),
+                             m_callbackList.end());
+        m_disconnected = false;
     }
 }
 
@@ -21,6 +21,7 @@
 #include "ns3/integer.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
+#include "ns3/object-map.h"
 #include "ns3/object-vector.h"
 #include "ns3/object.h"
 #include "ns3/pointer.h"
@@ -73,6 +74,12 @@ class ConfigTestObject : public Object
      * \param b test object b
      */
     void AddNodeB(Ptr<ConfigTestObject> b);
+    /**
+     * Add node to the NodesMap attribute
+     * \param key the key of the node
+     * \param node test object
+     */
+    void AddNodeMap(uint32_t key, Ptr<ConfigTestObject> node);
 
     /**
      * Set node A function
@@ -97,13 +104,14 @@ class ConfigTestObject : public Object
     int8_t GetB() const;
 
   private:
-    std::vector<Ptr<ConfigTestObject>> m_nodesA; //!< NodesA attribute target.
-    std::vector<Ptr<ConfigTestObject>> m_nodesB; //!< NodesB attribute target.
-    Ptr<ConfigTestObject> m_nodeA;               //!< NodeA attribute target.
-    Ptr<ConfigTestObject> m_nodeB;               //!< NodeB attribute target.
-    int8_t m_a;                                  //!< A attribute target.
-    int8_t m_b;                                  //!< B attribute target.
-    TracedValue<int16_t> m_trace;                //!< Source TraceSource target.
+    std::vector<Ptr<ConfigTestObject>> m_nodesA;          //!< NodesA attribute target.
+    std::vector<Ptr<ConfigTestObject>> m_nodesB;          //!< NodesB attribute target.
+    std::map<uint32_t, Ptr<ConfigTestObject>> m_nodesMap; //!< NodesMap attribute target.
+    Ptr<ConfigTestObject> m_nodeA;                        //!< NodeA attribute target.
+    Ptr<ConfigTestObject> m_nodeB;                        //!< NodeB attribute target.
+    int8_t m_a;                                           //!< A attribute target.
+    int8_t m_b;                                           //!< B attribute target.
+    TracedValue<int16_t> m_trace;                         //!< Source TraceSource target.
 };
 
 TypeId
@@ -121,6 +129,11 @@ ConfigTestObject::GetTypeId()
                                           ObjectVectorValue(),
                                           MakeObjectVectorAccessor(&ConfigTestObject::m_nodesB),
                                           MakeObjectVectorChecker<ConfigTestObject>())
+                            .AddAttribute("NodesMap",
+                                          "",
+                                          ObjectMapValue(),
+                                          MakeObjectMapAccessor(&ConfigTestObject::m_nodesMap),
+                                          MakeObjectMapChecker<ConfigTestObject>())
                             .AddAttribute("NodeA",
                                           "",
                                           PointerValue(),
@@ -177,6 +190,12 @@ ConfigTestObject::AddNodeB(Ptr<ConfigTestObject> b)
     m_nodesB.push_back(b);
 }
 
+void
+ConfigTestObject::AddNodeMap(uint32_t key, Ptr<ConfigTestObject> node)
+{
+    m_nodesMap[key] = node;
+}
+
 int8_t
 ConfigTestObject::GetA() const
 {
@@ -807,6 +826,92 @@ ObjectVectorTraceConfigTestCase::DoRun()
                           "Trace 1 did not provide expected context");
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the ability to configure maps of objects, whose keys are not
+ * the positions of the objects in the container, and to reuse the
+ * result of a lookup.
+ */
+class ObjectMapConfigTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    ObjectMapConfigTestCase();
+
+    /** Destructor. */
+    ~ObjectMapConfigTestCase() override
+    {
+    }
+
+  private:
+    void DoRun() override;
+};
+
+ObjectMapConfigTestCase::ObjectMapConfigTestCase()
+    : TestCase("Check ability to configure maps of Object and to reuse a MatchContainer")
+{
+}
+
+void
+ObjectMapConfigTestCase::DoRun()
+{
+    IntegerValue iv;
+
+    Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject>();
+    Config::RegisterRootNamespaceObject(root);
+    Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject>();
+    root->SetNodeA(a);
+
+    //
+    // The keys 1, 5 and 7 are at positions 0, 1 and 2 of the map, so that
+    // no key is the position of its object.
+    //
+    Ptr<ConfigTestObject> obj1 = CreateObject<ConfigTestObject>();
+    Ptr<ConfigTestObject> obj5 = CreateObject<ConfigTestObject>();
+    Ptr<ConfigTestObject> obj7 = CreateObject<ConfigTestObject>();
+    a->AddNodeMap(1, obj1);
+    a->AddNodeMap(5, obj5);
+    a->AddNodeMap(7, obj7);
+
+    Config::Set("/NodeA/NodesMap/5/A", IntegerValue(-5));
+    obj5->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -5, "Object Attribute \"A\" not set as expected");
+    obj1->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), 10, "Object Attribute \"A\" unexpectedly set");
+
+    Config::Set("/NodeA/NodesMap/1/A", IntegerValue(-1));
+    obj1->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -1, "Object Attribute \"A\" not set as expected");
+    obj5->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -5, "Object Attribute \"A\" unexpectedly set");
+
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodeA/NodesMap/2").GetN(),
+                          0,
+                          "No object should match a missing key");
+
+    //
+    // Resolve the path once and apply several settings to the matches.
+    //
+    Config::MatchContainer matches = Config::LookupMatches("/NodeA/NodesMap/[5-9]");
+    NS_TEST_ASSERT_MSG_EQ(matches.GetN(), 2, "Unexpected number of matches");
+    NS_TEST_ASSERT_MSG_EQ(matches.GetMatchedPath(0),
+                          "/NodeA/NodesMap/5/",
+                          "Unexpected context of the first match");
+    NS_TEST_ASSERT_MSG_EQ(matches.GetMatchedPath(1),
+                          "/NodeA/NodesMap/7/",
+                          "Unexpected context of the second match");
+    matches.Set("A", IntegerValue(-7));
+    matches.Set("B", IntegerValue(-8));
+    obj7->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -7, "Object Attribute \"A\" not set as expected");
+    obj5->GetAttribute("B", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -8, "Object Attribute \"B\" not set as expected");
+    obj1->GetAttribute("B", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), 9, "Object Attribute \"B\" unexpectedly set");
+
+    Config::UnregisterRootNamespaceObject(root);
+}
+
 /**
  * \ingroup config-tests
  * Test for the ability to search attributes of parent classes
@@ -881,6 +986,7 @@ ConfigTestSuite::ConfigTestSuite()
     AddTestCase(new RootNamespaceConfigTestCase);
     AddTestCase(new UnderRootNamespaceConfigTestCase);
     AddTestCase(new ObjectVectorConfigTestCase);
+    AddTestCase(new ObjectMapConfigTestCase);
     AddTestCase(new SearchAttributesOfParentObjectsTestCase);
 }
 
@@ -133,6 +133,184 @@ BasicTracedCallbackTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_two, true, "Callback CbTwo not called");
 }
 
+/**
+ * \ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check that the Callbacks are invoked in the
+ * order they were connected, including a Callback connected by another
+ * Callback while the chain is being invoked.
+ */
+class ConnectWhileInvokingTracedCallbackTestCase : public TestCase
+{
+  public:
+    ConnectWhileInvokingTracedCallbackTestCase();
+
+    ~ConnectWhileInvokingTracedCallbackTestCase() override
+    {
+    }
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Callback recording its identifier and, the first time it is
+     * invoked, connecting more Callbacks to the trace.
+     * \param id Identifier of the Callback.
+     * \param value The traced value.
+     */
+    void Cb(uint32_t id, uint32_t value);
+
+    TracedCallback<uint32_t> m_trace; //!< The traced callback
+    std::vector<uint32_t> m_calls;    //!< Identifiers of the invoked Callbacks
+};
+
+ConnectWhileInvokingTracedCallbackTestCase::ConnectWhileInvokingTracedCallbackTestCase()
+    : TestCase("Check TracedCallback invocation order and connection from a Callback")
+{
+}
+
+void
+ConnectWhileInvokingTracedCallbackTestCase::Cb(uint32_t id, uint32_t value)
+{
+    m_calls.push_back(id);
+    if (id == 0 && value == 0)
+    {
+        // enough connections to reallocate the storage of the chain
+        for (uint32_t i = 2; i < 10; i++)
+        {
+            m_trace.ConnectWithoutContext(
+                MakeCallback(&ConnectWhileInvokingTracedCallbackTestCase::Cb, this).Bind(i));
+        }
+    }
+}
+
+void
+ConnectWhileInvokingTracedCallbackTestCase::DoRun()
+{
+    NS_TEST_ASSERT_MSG_EQ(m_trace.IsEmpty(), true, "TracedCallback should be empty");
+    m_trace(0);
+
+    m_trace.ConnectWithoutContext(
+        MakeCallback(&ConnectWhileInvokingTracedCallbackTestCase::Cb, this).Bind(0));
+    m_trace.ConnectWithoutContext(
+        MakeCallback(&ConnectWhileInvokingTracedCallbackTestCase::Cb, this).Bind(1));
+    m_trace(0);
+    NS_TEST_ASSERT_MSG_EQ(m_calls.size(), 10, "All the Callbacks should have been invoked");
+    for (uint32_t i = 0; i < m_calls.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_calls[i], i, "Callbacks invoked out of order");
+    }
+
+    m_calls.clear();
+    m_trace.DisconnectWithoutContext(
+        MakeCallback(&ConnectWhileInvokingTracedCallbackTestCase::Cb, this).Bind(1));
+    m_trace(1);
+    NS_TEST_ASSERT_MSG_EQ(m_calls.size(), 9, "Only the disconnected Callback should be skipped");
+    NS_TEST_EXPECT_MSG_EQ(m_calls[1], 2, "Callback 1 unexpectedly called");
+}
+
+/**
+ * \ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check that a Callback may disconnect itself
+ * or another Callback while the chain is being invoked, without making
+ * the invocation skip the following Callbacks.
+ */
+class DisconnectWhileInvokingTracedCallbackTestCase : public TestCase
+{
+  public:
+    DisconnectWhileInvokingTracedCallbackTestCase();
+
+    ~DisconnectWhileInvokingTracedCallbackTestCase() override
+    {
+    }
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Callback recording its identifier.  Callback 1 disconnects itself
+     * and Callback 2 disconnects Callback 3.
+     * \param id Identifier of the Callback.
+     * \param value The traced value.
+     */
+    void Cb(uint32_t id, uint32_t value);
+
+    /**
+     * \param id Identifier of the Callback.
+     * \return the Callback with the given identifier
+     */
+    Callback<void, uint32_t> GetCb(uint32_t id);
+
+    TracedCallback<uint32_t> m_trace; //!< The traced callback
+    std::vector<uint32_t> m_calls;    //!< Identifiers of the invoked Callbacks
+};
+
+DisconnectWhileInvokingTracedCallbackTestCase::DisconnectWhileInvokingTracedCallbackTestCase()
+    : TestCase("Check TracedCallback disconnection from a Callback")
+{
+}
+
+Callback<void, uint32_t>
+DisconnectWhileInvokingTracedCallbackTestCase::GetCb(uint32_t id)
+{
+    // bind a copy of the identifier: Callbacks bound to an lvalue are
+    // compared through a reference to it
+    return MakeCallback(&DisconnectWhileInvokingTracedCallbackTestCase::Cb, this)
+        .Bind(uint32_t{id});
+}
+
+void
+DisconnectWhileInvokingTracedCallbackTestCase::Cb(uint32_t id, uint32_t value)
+{
+    m_calls.push_back(id);
+    if (id == 1)
+    {
+        m_trace.DisconnectWithoutContext(GetCb(1));
+    }
+    else if (id == 2)
+    {
+        m_trace.DisconnectWithoutContext(GetCb(3));
+    }
+}
+
+void
+DisconnectWhileInvokingTracedCallbackTestCase::DoRun()
+{
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        m_trace.ConnectWithoutContext(GetCb(i));
+    }
+
+    m_trace(0);
+    const std::vector<uint32_t> first{0, 1, 2, 4};
+    NS_TEST_ASSERT_MSG_EQ(m_calls.size(), first.size(), "Unexpected number of invocations");
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_calls[i], first[i], "Unexpected Callback invoked");
+    }
+
+    m_calls.clear();
+    m_trace(1);
+    const std::vector<uint32_t> second{0, 2, 4};
+    NS_TEST_ASSERT_MSG_EQ(m_calls.size(), second.size(), "Disconnected Callbacks were invoked");
+    for (std::size_t i = 0; i < second.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_calls[i], second[i], "Unexpected Callback invoked");
+    }
+
+    // the only Callback of the chain disconnects itself
+    for (uint32_t i : {0, 2, 4})
+    {
+        m_trace.DisconnectWithoutContext(GetCb(i));
+    }
+    m_trace.ConnectWithoutContext(GetCb(1));
+    m_calls.clear();
+    m_trace(2);
+    NS_TEST_EXPECT_MSG_EQ(m_calls.size(), 1, "Callback 1 should have been invoked");
+    NS_TEST_EXPECT_MSG_EQ(m_trace.IsEmpty(), true, "TracedCallback should be empty");
+}
+
 /**
  * \ingroup tracedcallback-tests
  *
@@ -148,6 +326,8 @@ TracedCallbackTestSuite::TracedCallbackTestSuite()
     : TestSuite("traced-callback", UNIT)
 {
     AddTestCase(new BasicTracedCallbackTestCase, TestCase::QUICK);
+    AddTestCase(new ConnectWhileInvokingTracedCallbackTestCase, TestCase::QUICK);
+    AddTestCase(new DisconnectWhileInvokingTracedCallbackTestCase, TestCase::QUICK);
 }
 
 static TracedCallbackTestSuite
@@ -0,0 +1,97 @@
+"""!
+Reader of the files written by FlowMonitor::StartStreamExport.
+
+Usage:
+  python3 flowmon-read-stream.py FILE          print the per-flow totals
+  python3 flowmon-read-stream.py --csv FILE    print every exported change as CSV
+
+The file starts with the 8 bytes magic "NS3FLOWS" and a uint32 version,
+followed by blocks.  Each block holds the time of the export (int64, ns),
+the number N of flows that changed since the previous export (uint32) and
+then one column of N values per counter, in the order given by COLUMNS.
+All the counters are deltas with respect to the previous export, and all
+the values are little endian.
+"""
+
+import struct
+import sys
+
+## Magic number at the beginning of the file
+MAGIC = b"NS3FLOWS"
+
+## Columns of a block: name and struct format of each value
+COLUMNS = [
+    ("flowId", "I"),
+    ("txPackets", "I"),
+    ("rxPackets", "I"),
+    ("lostPackets", "I"),
+    ("timesForwarded", "I"),
+    ("txBytes", "Q"),
+    ("rxBytes", "Q"),
+    ("delaySumNs", "q"),
+    ("jitterSumNs", "q"),
+]
+
+
+def read_blocks(f):
+    '''! Iterate over the blocks of a stream export file.
+    @param f The file object, opened in binary mode.
+    @return A generator of (time in ns, list of per-flow dicts).
+    '''
+    if f.read(len(MAGIC)) != MAGIC:
+        raise ValueError("not a FlowMonitor stream export file")
+    (version,) = struct.unpack("<I", f.read(4))
+    if version != 1:
+        raise ValueError("unsupported version %d" % version)
+
+    while True:
+        header = f.read(12)
+        if len(header) < 12:
+            return
+        time_ns, n = struct.unpack("<qI", header)
+        columns = []
+        for (name, fmt) in COLUMNS:
+            size = struct.calcsize(fmt) * n
+            columns.append(struct.unpack("<%d%s" % (n, fmt), f.read(size)))
+        yield time_ns, [dict(zip([c[0] for c in COLUMNS], values)) for values in zip(*columns)]
+
+
+def main(argv):
+    '''! The main function.
+    @param argv The argument list.
+    @return The exit code.
+    '''
+    csv = "--csv" in argv
+    files = [arg for arg in argv[1:] if arg != "--csv"]
+    if len(files) != 1:
+        print(__doc__)
+        return 1
+
+    totals = {}
+    with open(files[0], "rb") as f:
+        if csv:
+            print(",".join(["timeNs"] + [c[0] for c in COLUMNS]))
+        for time_ns, flows in read_blocks(f):
+            for flow in flows:
+                if csv:
+                    print(",".join([str(time_ns)] + [str(flow[c[0]]) for c in COLUMNS]))
+                    continue
+                total = totals.setdefault(flow["flowId"], dict.fromkeys(flow, 0))
+                for key, value in flow.items():
+                    if key != "flowId":
+                        total[key] += value
+
+    for flow_id in sorted(totals):
+        total = totals[flow_id]
+        print("FlowID: %i" % flow_id)
+        print("\tTX bytes: %i in %i packets" % (total["txBytes"], total["txPackets"]))
+        print("\tRX bytes: %i in %i packets" % (total["rxBytes"], total["rxPackets"]))
+        if total["rxPackets"]:
+            print("\tMean Delay: %.4f ms" % (total["delaySumNs"] / total["rxPackets"] * 1e-6))
+        print("\tPacket Loss Ratio: %.2f %%" %
+              (100.0 * total["lostPackets"] / total["txPackets"] if total["txPackets"] else 0))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -19,10 +19,12 @@
 
 #include "flow-monitor.h"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -33,6 +35,49 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("FlowMonitor");
 
+namespace
+{
+
+/// Magic number at the beginning of a stream export file
+const char STREAM_EXPORT_MAGIC[8] = {'N', 'S', '3', 'F', 'L', 'O', 'W', 'S'};
+/// Version of the stream export file format
+const uint32_t STREAM_EXPORT_VERSION = 1;
+
+/**
+ * Write an unsigned integer in little endian byte order
+ * \param os the output stream
+ * \param value the value to write
+ * \param size the number of bytes to write
+ */
+void
+WriteLittleEndian(std::ostream& os, uint64_t value, uint8_t size)
+{
+    char buffer[8];
+    for (uint8_t i = 0; i < size; i++)
+    {
+        buffer[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    os.write(buffer, size);
+}
+
+/**
+ * Write a column of unsigned integers in little endian byte order
+ * \tparam T the integer type
+ * \param os the output stream
+ * \param column the values to write
+ */
+template <typename T>
+void
+WriteColumn(std::ostream& os, const std::vector<T>& column)
+{
+    for (const auto& value : column)
+    {
+        WriteLittleEndian(os, static_cast<uint64_t>(value), sizeof(T));
+    }
+}
+
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(FlowMonitor);
 
 TypeId
@@ -80,7 +125,14 @@ FlowMonitor::GetTypeId()
                 ("The minimum inter-arrival time that is considered a flow interruption."),
                 TimeValue(Seconds(0.5)),
                 MakeTimeAccessor(&FlowMonitor::m_flowInterruptionsMinTime),
-                MakeTimeChecker());
+                MakeTimeChecker())
+            .AddAttribute("EnableHistograms",
+                          ("Whether the delay, jitter, packet size and flow interruptions "
+                           "histograms are filled.  Disabling them saves memory and time "
+                           "when only the flow counters are needed."),
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&FlowMonitor::m_enableHistograms),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -91,7 +143,8 @@ FlowMonitor::GetInstanceTypeId() const
 }
 
 FlowMonitor::FlowMonitor()
-    : m_enabled(false)
+    : m_enabled(false),
+      m_enableHistograms(true)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -102,6 +155,7 @@ FlowMonitor::DoDispose()
     NS_LOG_FUNCTION(this);
     Simulator::Cancel(m_startEvent);
     Simulator::Cancel(m_stopEvent);
+    StopStreamExport();
     for (std::list<Ptr<FlowClassifier>>::iterator iter = m_classifiers.begin();
          iter != m_classifiers.end();
          iter++)
@@ -120,11 +174,24 @@ inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow(FlowId flowId)
 {
     NS_LOG_FUNCTION(this);
+    if (flowId < m_flowStatsIndex.size() && m_flowStatsIndex[flowId] != nullptr)
+    {
+        return *m_flowStatsIndex[flowId];
+    }
     FlowStatsContainerI iter;
     iter = m_flowStats.find(flowId);
     if (iter == m_flowStats.end())
     {
         FlowMonitor::FlowStats& ref = m_flowStats[flowId];
+        // FlowIds are normally consecutive; do not index the (unusual) sparse ones
+        if (flowId < 2 * m_flowStatsIndex.size() + 1024)
+        {
+            if (flowId >= m_flowStatsIndex.size())
+            {
+                m_flowStatsIndex.resize(flowId + 1, nullptr);
+            }
+            m_flowStatsIndex[flowId] = &ref;
+        }
         ref.delaySum = Seconds(0);
         ref.jitterSum = Seconds(0);
         ref.lastDelay = Seconds(0);
@@ -146,6 +213,19 @@ FlowMonitor::GetStatsForFlow(FlowId flowId)
     }
 }
 
+uint64_t
+FlowMonitor::GetTrackedPacketKey(FlowId flowId, FlowPacketId packetId)
+{
+    return (static_cast<uint64_t>(flowId) << 32) | packetId;
+}
+
+void
+FlowMonitor::RemoveTrackedPacket(TrackedPacketMap::iterator tracked)
+{
+    m_trackedPacketList.erase(tracked->second);
+    m_trackedPackets.erase(tracked);
+}
+
 void
 FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
                            uint32_t flowId,
@@ -159,16 +239,21 @@ FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
         return;
     }
     Time now = Simulator::Now();
-    TrackedPacket& tracked = m_trackedPackets[std::make_pair(flowId, packetId)];
-    tracked.firstSeenTime = now;
-    tracked.lastSeenTime = tracked.firstSeenTime;
-    tracked.timesForwarded = 0;
+    uint64_t key = GetTrackedPacketKey(flowId, packetId);
+    TrackedPacketMap::iterator tracked = m_trackedPackets.find(key);
+    if (tracked != m_trackedPackets.end())
+    {
+        m_trackedPacketList.erase(tracked->second);
+    }
+    m_trackedPackets[key] =
+        m_trackedPacketList.insert(m_trackedPacketList.end(), {now, now, 0, flowId, packetId});
     NS_LOG_DEBUG("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId="
                                                                  << packetId << ").");
 
     probe->AddPacketStats(flowId, packetSize, Seconds(0));
 
     FlowStats& stats = GetStatsForFlow(flowId);
+    NotifyFlowChanged(flowId);
     stats.txBytes += packetSize;
     stats.txPackets++;
     if (stats.txPackets == 1)
@@ -190,8 +275,8 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    std::pair<FlowId, FlowPacketId> key(flowId, packetId);
-    TrackedPacketMap::iterator tracked = m_trackedPackets.find(key);
+    TrackedPacketMap::iterator tracked =
+        m_trackedPackets.find(GetTrackedPacketKey(flowId, packetId));
     if (tracked == m_trackedPackets.end())
     {
         NS_LOG_WARN("Received packet forward report (flowId="
@@ -199,10 +284,13 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
         return;
     }
 
-    tracked->second.timesForwarded++;
-    tracked->second.lastSeenTime = Simulator::Now();
+    TrackedPacketList::iterator packet = tracked->second;
+    packet->timesForwarded++;
+    packet->lastSeenTime = Simulator::Now();
+    // keep the list sorted by lastSeenTime
+    m_trackedPacketList.splice(m_trackedPacketList.end(), m_trackedPacketList, packet);
 
-    Time delay = (Simulator::Now() - tracked->second.firstSeenTime);
+    Time delay = (Simulator::Now() - packet->firstSeenTime);
     probe->AddPacketStats(flowId, packetSize, delay);
 }
 
@@ -218,7 +306,8 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    TrackedPacketMap::iterator tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
+    TrackedPacketMap::iterator tracked =
+        m_trackedPackets.find(GetTrackedPacketKey(flowId, packetId));
     if (tracked == m_trackedPackets.end())
     {
         NS_LOG_WARN("Received packet last-tx report (flowId="
@@ -227,30 +316,32 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
     }
 
     Time now = Simulator::Now();
-    Time delay = (now - tracked->second.firstSeenTime);
+    Time delay = (now - tracked->second->firstSeenTime);
     probe->AddPacketStats(flowId, packetSize, delay);
 
     FlowStats& stats = GetStatsForFlow(flowId);
+    NotifyFlowChanged(flowId);
     stats.delaySum += delay;
-    stats.delayHistogram.AddValue(delay.GetSeconds());
+    if (m_enableHistograms)
+    {
+        stats.delayHistogram.AddValue(delay.GetSeconds());
+    }
     if (stats.rxPackets > 0)
     {
-        Time jitter = stats.lastDelay - delay;
-        if (jitter > Seconds(0))
+        Time jitter = Abs(stats.lastDelay - delay);
+        stats.jitterSum += jitter;
+        if (m_enableHistograms)
         {
-            stats.jitterSum += jitter;
             stats.jitterHistogram.AddValue(jitter.GetSeconds());
         }
-        else
-        {
-            stats.jitterSum -= jitter;
-            stats.jitterHistogram.AddValue(-jitter.GetSeconds());
-        }
     }
     stats.lastDelay = delay;
 
     stats.rxBytes += packetSize;
-    stats.packetSizeHistogram.AddValue((double)packetSize);
+    if (m_enableHistograms)
+    {
+        stats.packetSizeHistogram.AddValue((double)packetSize);
+    }
     stats.rxPackets++;
     if (stats.rxPackets == 1)
     {
@@ -260,18 +351,18 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
     {
         // measure possible flow interruptions
         Time interArrivalTime = now - stats.timeLastRxPacket;
-        if (interArrivalTime > m_flowInterruptionsMinTime)
+        if (m_enableHistograms && interArrivalTime > m_flowInterruptionsMinTime)
         {
             stats.flowInterruptionsHistogram.AddValue(interArrivalTime.GetSeconds());
         }
     }
     stats.timeLastRxPacket = now;
-    stats.timesForwarded += tracked->second.timesForwarded;
+    stats.timesForwarded += tracked->second->timesForwarded;
 
     NS_LOG_DEBUG("ReportLastTx: removing tracked packet (flowId=" << flowId << ", packetId="
                                                                   << packetId << ").");
 
-    m_trackedPackets.erase(tracked); // we don't need to track this packet anymore
+    RemoveTrackedPacket(tracked); // we don't need to track this packet anymore
 }
 
 void
@@ -291,6 +382,7 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
     probe->AddPacketDropStats(flowId, packetSize, reasonCode);
 
     FlowStats& stats = GetStatsForFlow(flowId);
+    NotifyFlowChanged(flowId);
     stats.lostPackets++;
     if (stats.packetsDropped.size() < reasonCode + 1)
     {
@@ -302,14 +394,15 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
     NS_LOG_DEBUG("++stats.packetsDropped["
                  << reasonCode << "]; // becomes: " << stats.packetsDropped[reasonCode]);
 
-    TrackedPacketMap::iterator tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
+    TrackedPacketMap::iterator tracked =
+        m_trackedPackets.find(GetTrackedPacketKey(flowId, packetId));
     if (tracked != m_trackedPackets.end())
     {
         // we don't need to track this packet anymore
         // FIXME: this will not necessarily be true with broadcast/multicast
         NS_LOG_DEBUG("ReportDrop: removing tracked packet (flowId=" << flowId << ", packetId="
                                                                     << packetId << ").");
-        m_trackedPackets.erase(tracked);
+        RemoveTrackedPacket(tracked);
     }
 }
 
@@ -325,23 +418,20 @@ FlowMonitor::CheckForLostPackets(Time maxDelay)
     NS_LOG_FUNCTION(this << maxDelay.As(Time::S));
     Time now = Simulator::Now();
 
-    for (TrackedPacketMap::iterator iter = m_trackedPackets.begin();
-         iter != m_trackedPackets.end();)
+    // The list is sorted by lastSeenTime, so stop at the first packet seen recently enough
+    while (!m_trackedPacketList.empty() &&
+           now - m_trackedPacketList.front().lastSeenTime >= maxDelay)
     {
-        if (now - iter->second.lastSeenTime >= maxDelay)
-        {
-            // packet is considered lost, add it to the loss statistics
-            FlowStatsContainerI flow = m_flowStats.find(iter->first.first);
-            NS_ASSERT(flow != m_flowStats.end());
-            flow->second.lostPackets++;
+        const TrackedPacket& packet = m_trackedPacketList.front();
 
-            // we won't track it anymore
-            m_trackedPackets.erase(iter++);
-        }
-        else
-        {
-            iter++;
-        }
+        // packet is considered lost, add it to the loss statistics
+        NS_ASSERT(m_flowStats.find(packet.flowId) != m_flowStats.end());
+        NotifyFlowChanged(packet.flowId);
+        GetStatsForFlow(packet.flowId).lostPackets++;
+
+        // we won't track it anymore
+        m_trackedPackets.erase(GetTrackedPacketKey(packet.flowId, packet.packetId));
+        m_trackedPacketList.pop_front();
     }
 }
 
@@ -534,4 +624,146 @@ FlowMonitor::SerializeToXmlFile(std::string fileName, bool enableHistograms, boo
     os.close();
 }
 
+void
+FlowMonitor::StartStreamExport(const std::string& fileName, const Time& interval)
+{
+    NS_LOG_FUNCTION(this << fileName << interval.As(Time::S));
+    NS_ABORT_MSG_IF(m_streamEnabled, "Stream export already started");
+    NS_ABORT_MSG_UNLESS(interval.IsStrictlyPositive(), "The export interval must be positive");
+
+    m_streamFile.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_UNLESS(m_streamFile.is_open(), "Unable to open " << fileName);
+    m_streamFile.write(STREAM_EXPORT_MAGIC, sizeof(STREAM_EXPORT_MAGIC));
+    WriteLittleEndian(m_streamFile, STREAM_EXPORT_VERSION, 4);
+
+    // Flows seen before the export started are exported as changed since the beginning
+    m_streamEnabled = true;
+    for (const auto& flow : m_flowStats)
+    {
+        m_streamed[flow.first].changed = true;
+        m_changedFlows.push_back(flow.first);
+    }
+    m_streamDestroyEvent = Simulator::ScheduleDestroy(&FlowMonitor::StopStreamExport, this);
+
+    m_streamInterval = interval;
+    m_streamEvent =
+        Simulator::Schedule(m_streamInterval, &FlowMonitor::PeriodicStreamExport, this);
+}
+
+void
+FlowMonitor::StopStreamExport()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_streamEnabled)
+    {
+        return;
+    }
+    m_streamEvent.Cancel();
+    m_streamDestroyEvent.Cancel();
+    WriteStreamBlock();
+    m_streamFile.close();
+    m_streamEnabled = false;
+    m_streamed.clear();
+    m_changedFlows.clear();
+}
+
+void
+FlowMonitor::NotifyFlowChanged(FlowId flowId)
+{
+    if (!m_streamEnabled)
+    {
+        return;
+    }
+    auto [it, inserted] = m_streamed.try_emplace(flowId);
+    if (inserted)
+    {
+        // the flow did not change since the last export (or it is new), hence the
+        // counters exported so far are the current ones
+        const FlowStats& stats = GetStatsForFlow(flowId);
+        it->second = {stats.txBytes,
+                      stats.rxBytes,
+                      stats.txPackets,
+                      stats.rxPackets,
+                      stats.lostPackets,
+                      stats.timesForwarded,
+                      stats.delaySum,
+                      stats.jitterSum,
+                      false};
+    }
+    if (!it->second.changed)
+    {
+        it->second.changed = true;
+        m_changedFlows.push_back(flowId);
+    }
+}
+
+void
+FlowMonitor::PeriodicStreamExport()
+{
+    WriteStreamBlock();
+    m_streamEvent =
+        Simulator::Schedule(m_streamInterval, &FlowMonitor::PeriodicStreamExport, this);
+}
+
+void
+FlowMonitor::WriteStreamBlock()
+{
+    NS_LOG_FUNCTION(this << m_changedFlows.size());
+    // Forget the flows that did not change during the last interval, so that the
+    // memory used does not grow with the number of flows that ever existed
+    for (auto it = m_streamed.begin(); it != m_streamed.end();)
+    {
+        it = (it->second.changed ? std::next(it) : m_streamed.erase(it));
+    }
+    std::sort(m_changedFlows.begin(), m_changedFlows.end());
+
+    std::size_t n = m_changedFlows.size();
+    std::vector<uint32_t> txPackets(n);
+    std::vector<uint32_t> rxPackets(n);
+    std::vector<uint32_t> lostPackets(n);
+    std::vector<uint32_t> timesForwarded(n);
+    std::vector<uint64_t> txBytes(n);
+    std::vector<uint64_t> rxBytes(n);
+    std::vector<int64_t> delaySum(n);
+    std::vector<int64_t> jitterSum(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const FlowStats& stats = GetStatsForFlow(m_changedFlows[i]);
+        StreamedFlowStats& last = m_streamed[m_changedFlows[i]];
+        txPackets[i] = stats.txPackets - last.txPackets;
+        rxPackets[i] = stats.rxPackets - last.rxPackets;
+        lostPackets[i] = stats.lostPackets - last.lostPackets;
+        timesForwarded[i] = stats.timesForwarded - last.timesForwarded;
+        txBytes[i] = stats.txBytes - last.txBytes;
+        rxBytes[i] = stats.rxBytes - last.rxBytes;
+        delaySum[i] = (stats.delaySum - last.delaySum).GetNanoSeconds();
+        jitterSum[i] = (stats.jitterSum - last.jitterSum).GetNanoSeconds();
+        last = {stats.txBytes,
+                stats.rxBytes,
+                stats.txPackets,
+                stats.rxPackets,
+                stats.lostPackets,
+                stats.timesForwarded,
+                stats.delaySum,
+                stats.jitterSum,
+                false};
+    }
+
+    // Block header: time and number of flows, then one column per counter
+    WriteLittleEndian(m_streamFile, Simulator::Now().GetNanoSeconds(), 8);
+    WriteLittleEndian(m_streamFile, n, 4);
+    WriteColumn(m_streamFile, m_changedFlows);
+    WriteColumn(m_streamFile, txPackets);
+    WriteColumn(m_streamFile, rxPackets);
+    WriteColumn(m_streamFile, lostPackets);
+    WriteColumn(m_streamFile, timesForwarded);
+    WriteColumn(m_streamFile, txBytes);
+    WriteColumn(m_streamFile, rxBytes);
+    WriteColumn(m_streamFile, delaySum);
+    WriteColumn(m_streamFile, jitterSum);
+    m_streamFile.flush();
+
+    m_changedFlows.clear();
+}
+
 } // namespace ns3
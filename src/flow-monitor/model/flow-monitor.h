@@ -28,7 +28,10 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <fstream>
+#include <list>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -273,6 +276,24 @@ class FlowMonitor : public Object
     /// \param enableProbes if true, include also the per-probe/flow pair statistics in the output
     void SerializeToXmlFile(std::string fileName, bool enableHistograms, bool enableProbes);
 
+    /// Start exporting the flow statistics while the simulation runs.
+    ///
+    /// Every \p interval, the changes of the counters of the flows that
+    /// were active during the interval are appended to \p fileName in a
+    /// compact binary format (see the module documentation), so that the
+    /// results are available before the end of the simulation and the
+    /// output does not need to be built in memory.  The file can be read
+    /// with src/flow-monitor/examples/flowmon-read-stream.py.
+    /// \param fileName name or path of the output file that will be created
+    /// \param interval time between two consecutive exports
+    void StartStreamExport(const std::string& fileName, const Time& interval);
+
+    /// Export the pending changes and close the stream export file.
+    ///
+    /// This is done automatically when the simulator is destroyed or the
+    /// FlowMonitor is disposed, if the stream export was not stopped before.
+    void StopStreamExport();
+
   protected:
     void NotifyConstructionCompleted() override;
     void DoDispose() override;
@@ -284,14 +305,25 @@ class FlowMonitor : public Object
         Time firstSeenTime;      //!< absolute time when the packet was first seen by a probe
         Time lastSeenTime;       //!< absolute time when the packet was last seen by a probe
         uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
+        FlowId flowId;           //!< flow the packet belongs to
+        FlowPacketId packetId;   //!< identifier of the packet within the flow
     };
 
     /// FlowId --> FlowStats
     FlowStatsContainer m_flowStats;
 
-    /// (FlowId,PacketId) --> TrackedPacket
-    typedef std::map<std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
-    TrackedPacketMap m_trackedPackets; //!< Tracked packets
+    /// Direct access to the entries of m_flowStats, indexed by FlowId.
+    /// Classifiers assign consecutive FlowIds, so this avoids a map lookup per packet.
+    std::vector<FlowStats*> m_flowStatsIndex;
+
+    /// Tracked packets, sorted by increasing lastSeenTime.  Since the simulation time
+    /// never decreases, a packet seen again is simply moved to the back, and the packets
+    /// to be considered lost are always at the front.
+    typedef std::list<TrackedPacket> TrackedPacketList;
+    /// (FlowId,PacketId) packed in 64 bits --> position in the tracked packet list
+    typedef std::unordered_map<uint64_t, TrackedPacketList::iterator> TrackedPacketMap;
+    TrackedPacketList m_trackedPacketList; //!< Tracked packets, least recently seen first
+    TrackedPacketMap m_trackedPackets;     //!< Tracked packets lookup table
     Time m_maxPerHopDelay;             //!< Minimum per-hop delay
     FlowProbeContainer m_flowProbes;   //!< all the FlowProbes
 
@@ -307,11 +339,55 @@ class FlowMonitor : public Object
     double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
     Time m_flowInterruptionsMinTime;    //!< Flow interruptions minimum time
 
+    /// Flow counters as of the last stream export
+    struct StreamedFlowStats
+    {
+        uint64_t txBytes{0};        //!< transmitted bytes
+        uint64_t rxBytes{0};        //!< received bytes
+        uint32_t txPackets{0};      //!< transmitted packets
+        uint32_t rxPackets{0};      //!< received packets
+        uint32_t lostPackets{0};    //!< lost packets
+        uint32_t timesForwarded{0}; //!< times forwarded
+        Time delaySum;              //!< sum of the delays
+        Time jitterSum;             //!< sum of the jitters
+        bool changed{false};        //!< whether the flow changed since the last export
+    };
+
+    bool m_enableHistograms;                                  //!< Fill the histograms
+    bool m_streamEnabled{false};                              //!< Stream export is active
+    std::ofstream m_streamFile;                               //!< Stream export file
+    Time m_streamInterval;                                    //!< Stream export interval
+    EventId m_streamEvent;                                    //!< Next stream export
+    EventId m_streamDestroyEvent;                             //!< Last stream export
+    std::unordered_map<FlowId, StreamedFlowStats> m_streamed; //!< Last exported counters of
+                                                              //!< the recently active flows
+    std::vector<FlowId> m_changedFlows;                       //!< Flows changed since last export
+
     /// Get the stats for a given flow
     /// \param flowId the Flow identification
     /// \returns the stats of the flow
     FlowStats& GetStatsForFlow(FlowId flowId);
 
+    /// Record that the counters of a flow are about to change, for the stream export
+    /// \param flowId the Flow identification
+    void NotifyFlowChanged(FlowId flowId);
+
+    /// Append the changes of the flows since the last export to the stream export file
+    void WriteStreamBlock();
+
+    /// Periodic function exporting the flow statistics changes
+    void PeriodicStreamExport();
+
+    /// Get the key of a tracked packet
+    /// \param flowId the Flow identification
+    /// \param packetId the Packet identification
+    /// \returns the key of the packet in m_trackedPackets
+    static uint64_t GetTrackedPacketKey(FlowId flowId, FlowPacketId packetId);
+
+    /// Stop tracking a packet
+    /// \param tracked the packet to remove
+    void RemoveTrackedPacket(TrackedPacketMap::iterator tracked);
+
     /// Periodic function to check for lost packets and prune statistics
     void PeriodicCheckForLostPackets();
 };
@@ -25,6 +25,8 @@
 #include "ns3/ipv6-header.h"
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <stdint.h>
 
 namespace ns3
@@ -49,6 +51,14 @@ class Ipv6FlowClassifier : public FlowClassifier
         uint16_t destinationPort;       //!< Destination port
     };
 
+    /// Hash function for FiveTuple
+    struct FiveTupleHash
+    {
+        /// \param tuple the FiveTuple to hash
+        /// \return the hash of the FiveTuple
+        std::size_t operator()(const FiveTuple& tuple) const;
+    };
+
     Ipv6FlowClassifier();
 
     /// \brief try to classify the packet into flow-id and packet-id
@@ -93,12 +103,19 @@ class Ipv6FlowClassifier : public FlowClassifier
     void SerializeToXmlStream(std::ostream& os, uint16_t indent) const override;
 
   private:
+    /// Per-flow state, stored at index FlowId - 1 since FlowIds are consecutive
+    struct FlowInfo
+    {
+        FiveTuple tuple;           //!< Flow identifier
+        FlowPacketId lastPacketId; //!< Last FlowPacketId assigned in the flow
+        /// (DSCP value, packet count) pairs
+        std::map<Ipv6Header::DscpType, uint32_t> dscpCounts;
+    };
+
     /// Map to Flows Identifiers to FlowIds
-    std::map<FiveTuple, FlowId> m_flowMap;
-    /// Map to FlowIds to FlowPacketId
-    std::map<FlowId, FlowPacketId> m_flowPktIdMap;
-    /// Map FlowIds to (DSCP value, packet count) pairs
-    std::map<FlowId, std::map<Ipv6Header::DscpType, uint32_t>> m_flowDscpMap;
+    std::unordered_map<FiveTuple, FlowId, FiveTupleHash> m_flowMap;
+    /// Per-flow state, indexed by FlowId - 1
+    std::vector<FlowInfo> m_flows;
 };
 
 /**
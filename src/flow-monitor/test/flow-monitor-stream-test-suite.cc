@@ -0,0 +1,327 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \defgroup flow-monitor-test FlowMonitor module tests
+ * \ingroup flow-monitor
+ * \ingroup tests
+ */
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Flow probe reporting the packets scheduled by the test.
+ */
+class StreamTestFlowProbe : public FlowProbe
+{
+  public:
+    /**
+     * \param monitor the FlowMonitor this probe reports to
+     */
+    StreamTestFlowProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor stream export test.
+ *
+ * Packets of three flows are reported to a FlowMonitor exporting its
+ * statistics every second.  Flow 1 is idle for two seconds in the middle
+ * of the simulation and flow 3 only sends packets after the last periodic
+ * export.  The stream export is never stopped explicitly, so the last
+ * block must be written when the simulator is destroyed.  The file is
+ * then read back and the sum of the exported changes of each flow must
+ * match the final statistics of the flow.
+ */
+class FlowMonitorStreamTestCase : public TestCase
+{
+  public:
+    FlowMonitorStreamTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Counters of a flow in a block of the stream export file
+    struct Counters
+    {
+        uint32_t txPackets{0};      //!< transmitted packets
+        uint32_t rxPackets{0};      //!< received packets
+        uint32_t lostPackets{0};    //!< lost packets
+        uint32_t timesForwarded{0}; //!< times forwarded
+        uint64_t txBytes{0};        //!< transmitted bytes
+        uint64_t rxBytes{0};        //!< received bytes
+        int64_t delaySum{0};        //!< sum of the delays in nanoseconds
+        int64_t jitterSum{0};       //!< sum of the jitters in nanoseconds
+    };
+
+    /// A block of the stream export file: the time of the export and the changed flows
+    typedef std::pair<int64_t, std::map<FlowId, Counters>> Block;
+
+    /**
+     * Schedule the transmission of a packet and its reception (or drop) a few ms later
+     * \param flowId the flow of the packet
+     * \param time the transmission time
+     * \param dropped whether the packet is dropped
+     */
+    void SendPacket(FlowId flowId, Time time, bool dropped = false);
+
+    /**
+     * Read the stream export file
+     * \param fileName the name of the file
+     * \return the blocks of the file
+     */
+    std::vector<Block> ReadStream(const std::string& fileName);
+
+    Ptr<FlowMonitor> m_monitor; //!< the FlowMonitor
+    Ptr<FlowProbe> m_probe;     //!< the probe reporting the packets
+    uint32_t m_packetId{0};     //!< the identifier of the last packet
+};
+
+FlowMonitorStreamTestCase::FlowMonitorStreamTestCase()
+    : TestCase("Check that the stream export of FlowMonitor can be read back")
+{
+}
+
+void
+FlowMonitorStreamTestCase::SendPacket(FlowId flowId, Time time, bool dropped)
+{
+    uint32_t packetId = ++m_packetId;
+    uint32_t size = 100 * flowId;
+    Simulator::Schedule(time,
+                        &FlowMonitor::ReportFirstTx,
+                        m_monitor,
+                        m_probe,
+                        flowId,
+                        packetId,
+                        size);
+    if (dropped)
+    {
+        Simulator::Schedule(time + MilliSeconds(10),
+                            &FlowMonitor::ReportDrop,
+                            m_monitor,
+                            m_probe,
+                            flowId,
+                            packetId,
+                            size,
+                            0);
+    }
+    else
+    {
+        Simulator::Schedule(time + MilliSeconds(10 * flowId),
+                            &FlowMonitor::ReportLastRx,
+                            m_monitor,
+                            m_probe,
+                            flowId,
+                            packetId,
+                            size);
+    }
+}
+
+std::vector<FlowMonitorStreamTestCase::Block>
+FlowMonitorStreamTestCase::ReadStream(const std::string& fileName)
+{
+    std::ifstream is(fileName, std::ios::in | std::ios::binary);
+    auto read = [&is](uint8_t size) {
+        uint64_t value = 0;
+        for (uint8_t i = 0; i < size; i++)
+        {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(is.get())) << (8 * i);
+        }
+        return value;
+    };
+
+    std::string magic(8, '\0');
+    is.read(&magic[0], magic.size());
+    NS_TEST_EXPECT_MSG_EQ(magic, "NS3FLOWS", "Unexpected magic number");
+    NS_TEST_EXPECT_MSG_EQ(read(4), 1, "Unexpected version");
+
+    std::vector<Block> blocks;
+    while (is.peek() != std::ifstream::traits_type::eof())
+    {
+        int64_t time = read(8);
+        uint32_t n = read(4);
+        std::vector<FlowId> flowIds(n);
+        std::vector<Counters> counters(n);
+        for (auto& flowId : flowIds)
+        {
+            flowId = read(4);
+        }
+        for (auto& c : counters)
+        {
+            c.txPackets = read(4);
+        }
+        for (auto& c : counters)
+        {
+            c.rxPackets = read(4);
+        }
+        for (auto& c : counters)
+        {
+            c.lostPackets = read(4);
+        }
+        for (auto& c : counters)
+        {
+            c.timesForwarded = read(4);
+        }
+        for (auto& c : counters)
+        {
+            c.txBytes = read(8);
+        }
+        for (auto& c : counters)
+        {
+            c.rxBytes = read(8);
+        }
+        for (auto& c : counters)
+        {
+            c.delaySum = read(8);
+        }
+        for (auto& c : counters)
+        {
+            c.jitterSum = read(8);
+        }
+        NS_TEST_EXPECT_MSG_EQ(is.good(), true, "Truncated block");
+        if (!is.good())
+        {
+            break;
+        }
+        blocks.emplace_back(time, std::map<FlowId, Counters>());
+        for (uint32_t i = 0; i < n; i++)
+        {
+            blocks.back().second[flowIds[i]] = counters[i];
+        }
+    }
+    return blocks;
+}
+
+void
+FlowMonitorStreamTestCase::DoRun()
+{
+    std::string fileName = CreateTempDirFilename("flow-monitor-stream.bin");
+
+    m_monitor = CreateObject<FlowMonitor>();
+    m_probe = CreateObject<StreamTestFlowProbe>(m_monitor);
+    m_monitor->Start(Seconds(0));
+    m_monitor->StartStreamExport(fileName, Seconds(1));
+
+    for (double t : {0.1, 0.5, 0.9, 3.1, 3.5})
+    {
+        SendPacket(1, Seconds(t));
+    }
+    SendPacket(2, Seconds(1.5));
+    SendPacket(2, Seconds(2.5), true);
+    SendPacket(2, Seconds(3.2));
+    SendPacket(3, Seconds(4.2));
+    SendPacket(3, Seconds(4.3));
+
+    Simulator::Stop(Seconds(4.5));
+    Simulator::Run();
+    FlowMonitor::FlowStatsContainer stats = m_monitor->GetFlowStats();
+    Simulator::Destroy();
+
+    auto blocks = ReadStream(fileName);
+    NS_TEST_ASSERT_MSG_EQ(blocks.size(), 5, "Unexpected number of blocks");
+    const std::vector<int64_t> times{1, 2, 3, 4};
+    for (std::size_t i = 0; i < times.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(blocks[i].first,
+                              Seconds(times[i]).GetNanoSeconds(),
+                              "Unexpected time of block " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ(blocks[4].first,
+                          Seconds(4.5).GetNanoSeconds(),
+                          "The last block must be written when the simulator is destroyed");
+    NS_TEST_EXPECT_MSG_EQ(blocks[1].second.count(1), 0, "Flow 1 did not change in [1s, 2s]");
+    NS_TEST_EXPECT_MSG_EQ(blocks[2].second.count(1), 0, "Flow 1 did not change in [2s, 3s]");
+    NS_TEST_EXPECT_MSG_EQ(blocks[3].second.count(1), 1, "Flow 1 changed in [3s, 4s]");
+    NS_TEST_EXPECT_MSG_EQ(blocks[4].second.size(), 1, "Only flow 3 changed after 4s");
+
+    std::map<FlowId, Counters> totals;
+    for (const auto& [time, flows] : blocks)
+    {
+        for (const auto& [flowId, c] : flows)
+        {
+            auto& total = totals[flowId];
+            total.txPackets += c.txPackets;
+            total.rxPackets += c.rxPackets;
+            total.lostPackets += c.lostPackets;
+            total.timesForwarded += c.timesForwarded;
+            total.txBytes += c.txBytes;
+            total.rxBytes += c.rxBytes;
+            total.delaySum += c.delaySum;
+            total.jitterSum += c.jitterSum;
+        }
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(totals.size(), stats.size(), "Unexpected number of flows");
+    for (const auto& [flowId, flowStats] : stats)
+    {
+        const auto& total = totals[flowId];
+        NS_TEST_EXPECT_MSG_EQ(total.txPackets, flowStats.txPackets, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.rxPackets, flowStats.rxPackets, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.lostPackets, flowStats.lostPackets, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.timesForwarded, flowStats.timesForwarded, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.txBytes, flowStats.txBytes, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.rxBytes, flowStats.rxBytes, "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.delaySum,
+                              flowStats.delaySum.GetNanoSeconds(),
+                              "Flow " << flowId);
+        NS_TEST_EXPECT_MSG_EQ(total.jitterSum,
+                              flowStats.jitterSum.GetNanoSeconds(),
+                              "Flow " << flowId);
+    }
+    NS_TEST_EXPECT_MSG_EQ(totals[1].txPackets, 5, "Unexpected number of packets of flow 1");
+    NS_TEST_EXPECT_MSG_EQ(totals[2].lostPackets, 1, "Unexpected number of lost packets");
+
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    m_probe = nullptr;
+    std::remove(fileName.c_str());
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor TestSuite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTestSuite();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite()
+    : TestSuite("flow-monitor", UNIT)
+{
+    AddTestCase(new FlowMonitorStreamTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static FlowMonitorTestSuite g_flowMonitorTestSuite;
@@ -0,0 +1,507 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/data-rate.h"
+#include "ns3/flow-monitor-helper.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/ipv6-flow-classifier.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/test.h"
+#include "ns3/udp-socket-factory.h"
+
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Flow probe reporting the packets scheduled by the test.
+ */
+class TrackingTestFlowProbe : public FlowProbe
+{
+  public:
+    /**
+     * \param monitor the FlowMonitor this probe reports to
+     */
+    TrackingTestFlowProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor lost packets test.
+ *
+ * Flow 1 has a packet that is forwarded shortly before the first check for
+ * lost packets and a packet that is never forwarded.  Only the latter may be
+ * counted as lost by the first check, the former is lost at the second check
+ * because the maximum delay is measured from its last hop.  Flow 2 has three
+ * packets, one of which has the same packet identifier as a packet of flow 1,
+ * that expire at the first check.  They must not be counted again by the second
+ * check, nor be received or forwarded after having expired.
+ */
+class FlowMonitorLostPacketsTestCase : public TestCase
+{
+  public:
+    FlowMonitorLostPacketsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check for lost packets and compare the number of lost packets of the flows
+     * \param lost1 the expected number of lost packets of flow 1
+     * \param lost2 the expected number of lost packets of flow 2
+     */
+    void CheckLostPackets(uint32_t lost1, uint32_t lost2);
+
+    Ptr<FlowMonitor> m_monitor; //!< the FlowMonitor
+    Ptr<FlowProbe> m_probe;     //!< the probe reporting the packets
+};
+
+FlowMonitorLostPacketsTestCase::FlowMonitorLostPacketsTestCase()
+    : TestCase("Check that packets are lost maxDelay after their last hop and counted once")
+{
+}
+
+void
+FlowMonitorLostPacketsTestCase::CheckLostPackets(uint32_t lost1, uint32_t lost2)
+{
+    m_monitor->CheckForLostPackets(Seconds(1));
+    const auto& stats = m_monitor->GetFlowStats();
+    NS_TEST_ASSERT_MSG_EQ(stats.size(), 2, "Unexpected number of flows");
+    NS_TEST_EXPECT_MSG_EQ(stats.at(1).lostPackets,
+                          lost1,
+                          "Unexpected number of lost packets of flow 1 at " << Simulator::Now());
+    NS_TEST_EXPECT_MSG_EQ(stats.at(2).lostPackets,
+                          lost2,
+                          "Unexpected number of lost packets of flow 2 at " << Simulator::Now());
+}
+
+void
+FlowMonitorLostPacketsTestCase::DoRun()
+{
+    m_monitor = CreateObject<FlowMonitor>();
+    m_probe = CreateObject<TrackingTestFlowProbe>(m_monitor);
+    m_monitor->Start(Seconds(0));
+
+    Simulator::Schedule(Seconds(0), &FlowMonitor::ReportFirstTx, m_monitor, m_probe, 1, 1, 100);
+    Simulator::Schedule(Seconds(0.1), &FlowMonitor::ReportFirstTx, m_monitor, m_probe, 1, 2, 100);
+    Simulator::Schedule(Seconds(0.8),
+                        &FlowMonitor::ReportForwarding,
+                        m_monitor,
+                        m_probe,
+                        1,
+                        1,
+                        100);
+    for (uint32_t packetId = 1; packetId <= 3; packetId++)
+    {
+        Simulator::Schedule(Seconds(0.2),
+                            &FlowMonitor::ReportFirstTx,
+                            m_monitor,
+                            m_probe,
+                            2,
+                            packetId,
+                            200);
+    }
+
+    Simulator::Schedule(Seconds(1.2),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        1,
+                        3);
+    Simulator::Schedule(Seconds(1.5),
+                        &FlowMonitor::ReportForwarding,
+                        m_monitor,
+                        m_probe,
+                        2,
+                        2,
+                        200);
+    Simulator::Schedule(Seconds(1.9),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        2,
+                        3);
+    Simulator::Schedule(Seconds(2), &FlowMonitor::ReportLastRx, m_monitor, m_probe, 2, 1, 200);
+    Simulator::Schedule(Seconds(2.1),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        2,
+                        3);
+
+    Simulator::Stop(Seconds(2.5));
+    Simulator::Run();
+
+    const auto& stats = m_monitor->GetFlowStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.at(2).rxPackets, 0, "An expired packet must not be received");
+    NS_TEST_EXPECT_MSG_EQ(stats.at(1).txPackets, 2, "Unexpected number of packets of flow 1");
+    NS_TEST_EXPECT_MSG_EQ(stats.at(2).txPackets, 3, "Unexpected number of packets of flow 2");
+
+    Simulator::Destroy();
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    m_probe = nullptr;
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief Flow classifiers test.
+ *
+ * Packets of several five-tuples are classified by an Ipv4FlowClassifier and
+ * an Ipv6FlowClassifier.  The FlowIds must be assigned in the order in which
+ * the five-tuples are first seen, the packets of a five-tuple must get the
+ * same FlowId and consecutive packet identifiers, and the flows must be
+ * serialized to XML in five-tuple order.
+ */
+class FlowClassifierTestCase : public TestCase
+{
+  public:
+    FlowClassifierTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create a packet carrying the given ports in its first four bytes
+     * \param sourcePort the source port
+     * \param destinationPort the destination port
+     * \return the packet
+     */
+    static Ptr<Packet> CreatePayload(uint16_t sourcePort, uint16_t destinationPort);
+
+    /// Check the Ipv4FlowClassifier
+    void CheckIpv4();
+    /// Check the Ipv6FlowClassifier
+    void CheckIpv6();
+};
+
+FlowClassifierTestCase::FlowClassifierTestCase()
+    : TestCase("Check the FlowIds assigned by the flow classifiers and their XML export")
+{
+}
+
+Ptr<Packet>
+FlowClassifierTestCase::CreatePayload(uint16_t sourcePort, uint16_t destinationPort)
+{
+    uint8_t data[8] = {static_cast<uint8_t>(sourcePort >> 8),
+                       static_cast<uint8_t>(sourcePort & 0xff),
+                       static_cast<uint8_t>(destinationPort >> 8),
+                       static_cast<uint8_t>(destinationPort & 0xff)};
+    return Create<Packet>(data, sizeof(data));
+}
+
+void
+FlowClassifierTestCase::CheckIpv4()
+{
+    Ptr<Ipv4FlowClassifier> classifier = Create<Ipv4FlowClassifier>();
+
+    /// A classified packet and the expected result
+    struct Entry
+    {
+        const char* source;       //!< source address
+        const char* destination;  //!< destination address
+        uint16_t sourcePort;      //!< source port
+        uint16_t destinationPort; //!< destination port
+        FlowId flowId;            //!< expected FlowId
+        FlowPacketId packetId;    //!< expected packet identifier
+    };
+
+    const std::vector<Entry> entries{{"10.1.1.3", "10.1.1.1", 49153, 9, 1, 0},
+                                     {"10.1.1.1", "10.1.1.3", 49153, 9, 2, 0},
+                                     {"10.1.1.3", "10.1.1.1", 49153, 9, 1, 1},
+                                     {"10.1.1.2", "10.1.1.3", 49154, 10, 3, 0},
+                                     {"10.1.1.1", "10.1.1.3", 49153, 9, 2, 1},
+                                     {"10.1.1.1", "10.1.1.3", 49152, 9, 4, 0},
+                                     {"10.1.1.3", "10.1.1.1", 49153, 9, 1, 2}};
+    for (const auto& entry : entries)
+    {
+        Ipv4Header header;
+        header.SetSource(Ipv4Address(entry.source));
+        header.SetDestination(Ipv4Address(entry.destination));
+        header.SetProtocol(17);
+        uint32_t flowId = 0;
+        uint32_t packetId = 0;
+        bool classified = classifier->Classify(header,
+                                               CreatePayload(entry.sourcePort,
+                                                             entry.destinationPort),
+                                               &flowId,
+                                               &packetId);
+        NS_TEST_ASSERT_MSG_EQ(classified, true, "The UDP packet must be classified");
+        NS_TEST_EXPECT_MSG_EQ(flowId, entry.flowId, "Unexpected FlowId");
+        NS_TEST_EXPECT_MSG_EQ(packetId, entry.packetId, "Unexpected packet identifier");
+    }
+
+    Ipv4FlowClassifier::FiveTuple tuple = classifier->FindFlow(3);
+    NS_TEST_EXPECT_MSG_EQ(tuple.sourceAddress, Ipv4Address("10.1.1.2"), "Wrong tuple of flow 3");
+    NS_TEST_EXPECT_MSG_EQ(tuple.sourcePort, 49154, "Wrong tuple of flow 3");
+    NS_TEST_EXPECT_MSG_EQ(tuple.destinationPort, 10, "Wrong tuple of flow 3");
+
+    std::ostringstream os;
+    classifier->SerializeToXmlStream(os, 0);
+    NS_TEST_EXPECT_MSG_EQ(os.str(),
+                          "<Ipv4FlowClassifier>\n"
+                          "  <Flow flowId=\"4\" sourceAddress=\"10.1.1.1\""
+                          " destinationAddress=\"10.1.1.3\" protocol=\"17\" sourcePort=\"49152\""
+                          " destinationPort=\"9\">\n"
+                          "    <Dscp value=\"0x0\" packets=\"1\" />\n"
+                          "  </Flow>\n"
+                          "  <Flow flowId=\"2\" sourceAddress=\"10.1.1.1\""
+                          " destinationAddress=\"10.1.1.3\" protocol=\"17\" sourcePort=\"49153\""
+                          " destinationPort=\"9\">\n"
+                          "    <Dscp value=\"0x0\" packets=\"2\" />\n"
+                          "  </Flow>\n"
+                          "  <Flow flowId=\"3\" sourceAddress=\"10.1.1.2\""
+                          " destinationAddress=\"10.1.1.3\" protocol=\"17\" sourcePort=\"49154\""
+                          " destinationPort=\"10\">\n"
+                          "    <Dscp value=\"0x0\" packets=\"1\" />\n"
+                          "  </Flow>\n"
+                          "  <Flow flowId=\"1\" sourceAddress=\"10.1.1.3\""
+                          " destinationAddress=\"10.1.1.1\" protocol=\"17\" sourcePort=\"49153\""
+                          " destinationPort=\"9\">\n"
+                          "    <Dscp value=\"0x0\" packets=\"3\" />\n"
+                          "  </Flow>\n"
+                          "</Ipv4FlowClassifier>\n",
+                          "The flows must be serialized in five-tuple order");
+}
+
+void
+FlowClassifierTestCase::CheckIpv6()
+{
+    Ptr<Ipv6FlowClassifier> classifier = Create<Ipv6FlowClassifier>();
+
+    const std::vector<std::pair<const char*, FlowId>> entries{{"2001:db8::3", 1},
+                                                              {"2001:db8::1", 2},
+                                                              {"2001:db8::3", 1},
+                                                              {"2001:db8::2", 3}};
+    for (const auto& [source, expectedFlowId] : entries)
+    {
+        Ipv6Header header;
+        header.SetSource(Ipv6Address(source));
+        header.SetDestination(Ipv6Address("2001:db8::ff"));
+        header.SetNextHeader(17);
+        uint32_t flowId = 0;
+        uint32_t packetId = 0;
+        bool classified =
+            classifier->Classify(header, CreatePayload(49153, 9), &flowId, &packetId);
+        NS_TEST_ASSERT_MSG_EQ(classified, true, "The UDP packet must be classified");
+        NS_TEST_EXPECT_MSG_EQ(flowId, expectedFlowId, "Unexpected FlowId of " << source);
+    }
+
+    std::ostringstream os;
+    classifier->SerializeToXmlStream(os, 0);
+    std::string xml = os.str();
+    std::size_t flow2 = xml.find("flowId=\"2\"");
+    std::size_t flow3 = xml.find("flowId=\"3\"");
+    std::size_t flow1 = xml.find("flowId=\"1\"");
+    NS_TEST_ASSERT_MSG_NE(flow1, std::string::npos, "Flow 1 not serialized");
+    NS_TEST_ASSERT_MSG_NE(flow2, std::string::npos, "Flow 2 not serialized");
+    NS_TEST_ASSERT_MSG_NE(flow3, std::string::npos, "Flow 3 not serialized");
+    NS_TEST_EXPECT_MSG_LT(flow2, flow3, "The flows must be serialized in five-tuple order");
+    NS_TEST_EXPECT_MSG_LT(flow3, flow1, "The flows must be serialized in five-tuple order");
+}
+
+void
+FlowClassifierTestCase::DoRun()
+{
+    CheckIpv4();
+    CheckIpv6();
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor XML export test.
+ *
+ * Three UDP flows are sent over a chain of three nodes, the first one from the
+ * last node to the first node.  The XML export of the FlowMonitor must match
+ * the one obtained when the flow classifiers kept the flows in ordered maps,
+ * which lists the flows of a classifier in five-tuple order.
+ */
+class FlowMonitorXmlTestCase : public TestCase
+{
+  public:
+    FlowMonitorXmlTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Send a packet
+     * \param socket the socket sending the packet
+     * \param size the size of the packet
+     */
+    static void SendPacket(Ptr<Socket> socket, uint32_t size);
+};
+
+FlowMonitorXmlTestCase::FlowMonitorXmlTestCase()
+    : TestCase("Check the XML export of FlowMonitor for a small topology")
+{
+}
+
+void
+FlowMonitorXmlTestCase::SendPacket(Ptr<Socket> socket, uint32_t size)
+{
+    socket->Send(Create<Packet>(size));
+}
+
+void
+FlowMonitorXmlTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    SimpleNetDeviceHelper simpleHelper;
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    simpleHelper.SetDeviceAttribute("DataRate", DataRateValue(DataRate("1Mbps")));
+    simpleHelper.SetChannelAttribute("Delay", TimeValue(MilliSeconds(2)));
+    NetDeviceContainer net = simpleHelper.Install(NodeContainer(nodes.Get(0), nodes.Get(1)));
+    NetDeviceContainer net2 = simpleHelper.Install(NodeContainer(nodes.Get(1), nodes.Get(2)));
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer i = ipv4.Assign(net);
+    ipv4.SetBase("10.1.2.0", "255.255.255.0");
+    Ipv4InterfaceContainer i2 = ipv4.Assign(net2);
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    /// A UDP flow of the topology
+    struct Flow
+    {
+        uint32_t source;     //!< index of the source node
+        Ipv4Address address; //!< destination address
+        uint16_t port;       //!< destination port
+        double start;        //!< time of the first packet in seconds
+        uint32_t packets;    //!< number of packets
+    };
+
+    const std::vector<Flow> flows{{2, i.GetAddress(0), 9, 1.0, 3},
+                                  {0, i2.GetAddress(1), 9, 1.05, 2},
+                                  {1, i2.GetAddress(1), 10, 1.3, 1}};
+    TypeId tid = UdpSocketFactory::GetTypeId();
+    for (uint32_t node : {0, 2})
+    {
+        for (uint16_t port : {9, 10})
+        {
+            Ptr<Socket> sink = Socket::CreateSocket(nodes.Get(node), tid);
+            sink->Bind(InetSocketAddress(Ipv4Address::GetAny(), port));
+        }
+    }
+    for (const auto& flow : flows)
+    {
+        Ptr<Socket> socket = Socket::CreateSocket(nodes.Get(flow.source), tid);
+        socket->Bind();
+        socket->Connect(InetSocketAddress(flow.address, flow.port));
+        for (uint32_t n = 0; n < flow.packets; n++)
+        {
+            Simulator::Schedule(Seconds(flow.start + 0.1 * n),
+                                &FlowMonitorXmlTestCase::SendPacket,
+                                socket,
+                                500 + 100 * n);
+        }
+    }
+
+    FlowMonitorHelper flowmon;
+    Ptr<FlowMonitor> monitor = flowmon.InstallAll();
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    monitor->CheckForLostPackets();
+    std::string xml = flowmon.SerializeToXmlString(0, false, false);
+    Simulator::Destroy();
+
+    const std::string expected =
+        "<FlowMonitor>\n"
+        "  <FlowStats>\n"
+        "    <Flow flowId=\"1\" timeFirstTxPacket=\"+1e+09ns\""
+        " timeFirstRxPacket=\"+1.01245e+09ns\" timeLastTxPacket=\"+1.2e+09ns\""
+        " timeLastRxPacket=\"+1.21565e+09ns\" delaySum=\"+4.2144e+07ns\""
+        " jitterSum=\"+3.2e+06ns\" lastDelay=\"+1.5648e+07ns\" txBytes=\"1884\""
+        " rxBytes=\"1884\" txPackets=\"3\" rxPackets=\"3\" lostPackets=\"0\""
+        " timesForwarded=\"3\">\n"
+        "    </Flow>\n"
+        "    <Flow flowId=\"2\" timeFirstTxPacket=\"+1.05e+09ns\""
+        " timeFirstRxPacket=\"+1.06245e+09ns\" timeLastTxPacket=\"+1.15e+09ns\""
+        " timeLastRxPacket=\"+1.16405e+09ns\" delaySum=\"+2.6496e+07ns\""
+        " jitterSum=\"+1.6e+06ns\" lastDelay=\"+1.4048e+07ns\" txBytes=\"1156\""
+        " rxBytes=\"1156\" txPackets=\"2\" rxPackets=\"2\" lostPackets=\"0\""
+        " timesForwarded=\"2\">\n"
+        "    </Flow>\n"
+        "    <Flow flowId=\"3\" timeFirstTxPacket=\"+1.3e+09ns\""
+        " timeFirstRxPacket=\"+1.30622e+09ns\" timeLastTxPacket=\"+1.3e+09ns\""
+        " timeLastRxPacket=\"+1.30622e+09ns\" delaySum=\"+6.224e+06ns\""
+        " jitterSum=\"+0ns\" lastDelay=\"+6.224e+06ns\" txBytes=\"528\" rxBytes=\"528\""
+        " txPackets=\"1\" rxPackets=\"1\" lostPackets=\"0\" timesForwarded=\"0\">\n"
+        "    </Flow>\n"
+        "  </FlowStats>\n"
+        "  <Ipv4FlowClassifier>\n"
+        "    <Flow flowId=\"2\" sourceAddress=\"10.1.1.1\""
+        " destinationAddress=\"10.1.2.2\" protocol=\"17\" sourcePort=\"49153\""
+        " destinationPort=\"9\">\n"
+        "      <Dscp value=\"0x0\" packets=\"2\" />\n"
+        "    </Flow>\n"
+        "    <Flow flowId=\"3\" sourceAddress=\"10.1.2.1\""
+        " destinationAddress=\"10.1.2.2\" protocol=\"17\" sourcePort=\"49153\""
+        " destinationPort=\"10\">\n"
+        "      <Dscp value=\"0x0\" packets=\"1\" />\n"
+        "    </Flow>\n"
+        "    <Flow flowId=\"1\" sourceAddress=\"10.1.2.2\""
+        " destinationAddress=\"10.1.1.1\" protocol=\"17\" sourcePort=\"49153\""
+        " destinationPort=\"9\">\n"
+        "      <Dscp value=\"0x0\" packets=\"3\" />\n"
+        "    </Flow>\n"
+        "  </Ipv4FlowClassifier>\n"
+        "  <Ipv6FlowClassifier>\n"
+        "  </Ipv6FlowClassifier>\n"
+        "</FlowMonitor>\n";
+    NS_TEST_EXPECT_MSG_EQ(xml, expected, "Unexpected XML export");
+}
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * \brief FlowMonitor packet tracking and flow classification TestSuite
+ */
+class FlowMonitorTrackingTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTrackingTestSuite();
+};
+
+FlowMonitorTrackingTestSuite::FlowMonitorTrackingTestSuite()
+    : TestSuite("flow-monitor-tracking", UNIT)
+{
+    AddTestCase(new FlowMonitorLostPacketsTestCase, TestCase::QUICK);
+    AddTestCase(new FlowClassifierTestCase, TestCase::QUICK);
+    AddTestCase(new FlowMonitorXmlTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static FlowMonitorTrackingTestSuite g_flowMonitorTrackingTestSuite;
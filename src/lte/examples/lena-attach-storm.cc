@@ -0,0 +1,177 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the RRC signaling of a large number
+// of UEs attaching at the same time, with the ideal RRC protocol, with the
+// real RRC protocol, and with the real RRC protocol skipping the decoding of
+// the RRC messages (LteHelper::SkipRrcDecoding), and compare them with the
+// UEs connected without any signaling (LteHelper::PreAttach).
+// Sample usage:  ./ns3 run 'lena-attach-storm --nEnbs=10 --nUesPerEnb=200'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// Number of UEs which completed the RRC connection establishment
+uint32_t g_connectedUes = 0;
+
+/**
+ * ConnectionEstablished trace sink.
+ * \param imsi the IMSI
+ * \param cellId the cell ID
+ * \param rnti the RNTI
+ */
+void
+ConnectionEstablished(uint64_t imsi, uint16_t cellId, uint16_t rnti)
+{
+    g_connectedUes++;
+}
+
+/**
+ * Run an attach storm and print its statistics.
+ * \param mode the name of the RRC mode
+ * \param useIdealRrc the value of the LteHelper UseIdealRrc attribute
+ * \param skipRrcDecoding the value of the LteHelper SkipRrcDecoding attribute
+ * \param preAttach whether the UEs are pre-attached rather than attached
+ * \param nEnbs the number of eNBs
+ * \param nUesPerEnb the number of UEs around each eNB
+ * \param simTime the duration of the simulation
+ */
+void
+RunAttachStorm(std::string mode,
+               bool useIdealRrc,
+               bool skipRrcDecoding,
+               bool preAttach,
+               uint32_t nEnbs,
+               uint32_t nUesPerEnb,
+               Time simTime)
+{
+    g_connectedUes = 0;
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    lteHelper->SetAttribute("UseIdealRrc", BooleanValue(useIdealRrc));
+    lteHelper->SetAttribute("SkipRrcDecoding", BooleanValue(skipRrcDecoding));
+
+    NodeContainer enbNodes;
+    enbNodes.Create(nEnbs);
+    NodeContainer ueNodes;
+    ueNodes.Create(nEnbs * nUesPerEnb);
+
+    Ptr<ListPositionAllocator> enbPositionAlloc = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < nEnbs; i++)
+    {
+        enbPositionAlloc->Add(Vector(1000.0 * i, 0.0, 30.0));
+    }
+    MobilityHelper enbMobility;
+    enbMobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    enbMobility.SetPositionAllocator(enbPositionAlloc);
+    enbMobility.Install(enbNodes);
+
+    MobilityHelper ueMobility;
+    ueMobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    ueMobility.SetPositionAllocator("ns3::RandomBoxPositionAllocator",
+                                    "X",
+                                    StringValue("ns3::UniformRandomVariable[Min=-300.0|Max=" +
+                                                std::to_string(1000.0 * nEnbs - 700.0) + "]"),
+                                    "Y",
+                                    StringValue("ns3::UniformRandomVariable[Min=-300.0|Max=300.0]"),
+                                    "Z",
+                                    StringValue("ns3::ConstantRandomVariable[Constant=1.5]"));
+    ueMobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    if (preAttach)
+    {
+        lteHelper->PreAttachToClosestEnb(ueDevs, enbDevs);
+    }
+    else
+    {
+        // every UE starts the random access at the same time
+        lteHelper->AttachToClosestEnb(ueDevs, enbDevs);
+    }
+
+    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/ConnectionEstablished",
+                                  MakeCallback(&ConnectionEstablished));
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Stop(simTime);
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << mode << ": " << g_connectedUes << "/" << ueDevs.GetN()
+              << " UEs connected, " << Simulator::GetEventCount() << " events in " << elapsedMs
+              << " ms" << std::endl;
+
+    Simulator::Destroy();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nEnbs = 4;
+    uint32_t nUesPerEnb = 50;
+    Time simTime = Seconds(1);
+    bool ideal = true;
+    bool real = true;
+    bool skipDecoding = true;
+    bool preAttach = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the RRC connection establishment of many UEs at once");
+    cmd.AddValue("nEnbs", "Number of eNBs", nEnbs);
+    cmd.AddValue("nUesPerEnb", "Number of UEs per eNB", nUesPerEnb);
+    cmd.AddValue("simTime", "Duration of each simulation", simTime);
+    cmd.AddValue("ideal", "Run with the ideal RRC protocol", ideal);
+    cmd.AddValue("real", "Run with the real RRC protocol", real);
+    cmd.AddValue("skipDecoding",
+                 "Run with the real RRC protocol skipping the decoding of the messages",
+                 skipDecoding);
+    cmd.AddValue("preAttach", "Run with the UEs connected without signaling", preAttach);
+    cmd.Parse(argc, argv);
+
+    // enough SRS configuration indexes for all the UEs of a cell
+    Config::SetDefault("ns3::LteEnbRrc::SrsPeriodicity", UintegerValue(320));
+
+    if (ideal)
+    {
+        RunAttachStorm("ideal RRC", true, false, false, nEnbs, nUesPerEnb, simTime);
+    }
+    if (real)
+    {
+        RunAttachStorm("real RRC", false, false, false, nEnbs, nUesPerEnb, simTime);
+    }
+    if (skipDecoding)
+    {
+        RunAttachStorm("real RRC (decoding skipped)",
+                       false,
+                       true,
+                       false,
+                       nEnbs,
+                       nUesPerEnb,
+                       simTime);
+    }
+    if (preAttach)
+    {
+        RunAttachStorm("pre-attached", true, false, true, nEnbs, nUesPerEnb, simTime);
+    }
+    return 0;
+}
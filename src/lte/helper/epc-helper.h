@@ -125,6 +125,19 @@ class EpcHelper : public Object
                                       Ptr<EpcTft> tft,
                                       EpsBearer bearer) = 0;
 
+    /**
+     * Set up the EPS bearers and the S1-U tunnels of a UE which is connected
+     * to an eNB without the attach procedure (see LteHelper::PreAttach). The
+     * state of the MME, SGW, PGW and eNB is set up directly, as the S1-AP and
+     * GTP-C signaling of the attach procedure would do, for all the bearers
+     * already activated with ActivateEpsBearer.
+     *
+     * \param imsi the unique identifier of the UE
+     * \param enbLteDevice the LTE device of the eNB the UE is connected to
+     * \param rnti the RNTI of the UE in the eNB
+     */
+    virtual void PreAttachUe(uint64_t imsi, Ptr<NetDevice> enbLteDevice, uint16_t rnti) = 0;
+
     /**
      * Get the SGW node
      *
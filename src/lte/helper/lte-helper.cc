@@ -156,6 +156,13 @@ LteHelper::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&LteHelper::m_useIdealRrc),
                           MakeBooleanChecker())
+            .AddAttribute("SkipRrcDecoding",
+                          "If true and LteRrcProtocolReal is used, the RRC messages keep the "
+                          "size of their encoding over the radio, but they are not decoded "
+                          "by the receiving RRC.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteHelper::m_skipRrcDecoding),
+                          MakeBooleanChecker())
             .AddAttribute("AnrEnabled",
                           "Activate or deactivate Automatic Neighbour Relation function",
                           BooleanValue(true),
@@ -622,6 +629,7 @@ LteHelper::InstallSingleEnbDevice(Ptr<Node> n)
     else
     {
         Ptr<LteEnbRrcProtocolReal> rrcProtocol = CreateObject<LteEnbRrcProtocolReal>();
+        rrcProtocol->SetAttribute("SkipDecoding", BooleanValue(m_skipRrcDecoding));
         rrcProtocol->SetLteEnbRrcSapProvider(rrc->GetLteEnbRrcSapProvider());
         rrc->SetLteEnbRrcSapUser(rrcProtocol->GetLteEnbRrcSapUser());
         rrc->AggregateObject(rrcProtocol);
@@ -953,6 +961,7 @@ LteHelper::InstallSingleUeDevice(Ptr<Node> n)
     else
     {
         Ptr<LteUeRrcProtocolReal> rrcProtocol = CreateObject<LteUeRrcProtocolReal>();
+        rrcProtocol->SetAttribute("SkipDecoding", BooleanValue(m_skipRrcDecoding));
         rrcProtocol->SetUeRrc(rrc);
         rrc->AggregateObject(rrcProtocol);
         rrcProtocol->SetLteUeRrcSapProvider(rrc->GetLteUeRrcSapProvider());
@@ -1155,6 +1164,140 @@ LteHelper::AttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDev
     Attach(ueDevice, closestEnbDevice);
 }
 
+void
+LteHelper::PreAttach(NetDeviceContainer ueDevices, Ptr<NetDevice> enbDevice)
+{
+    NS_LOG_FUNCTION(this);
+    for (NetDeviceContainer::Iterator i = ueDevices.Begin(); i != ueDevices.End(); ++i)
+    {
+        PreAttach(*i, enbDevice);
+    }
+}
+
+void
+LteHelper::PreAttach(Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice, uint8_t componentCarrierId)
+{
+    NS_LOG_FUNCTION(this << ueDevice << enbDevice << +componentCarrierId);
+    NS_ABORT_MSG_IF(Simulator::Now() > Seconds(0),
+                    "UEs can be pre-attached only before the beginning of the simulation");
+
+    Ptr<LteUeNetDevice> ueLteDevice = ueDevice->GetObject<LteUeNetDevice>();
+    NS_ABORT_MSG_IF(!ueLteDevice, "The passed NetDevice must be an LteUeNetDevice");
+    Ptr<LteEnbNetDevice> enbLteDevice = enbDevice->GetObject<LteEnbNetDevice>();
+    NS_ABORT_MSG_IF(!enbLteDevice, "The passed NetDevice must be an LteEnbNetDevice");
+
+    if (m_epcHelper)
+    {
+        // activate default EPS bearer
+        m_epcHelper->ActivateEpsBearer(ueDevice,
+                                       ueLteDevice->GetImsi(),
+                                       EpcTft::Default(),
+                                       EpsBearer(EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+    }
+
+    // tricks needed for the simplified LTE-only simulations
+    if (!m_epcHelper)
+    {
+        ueLteDevice->SetTargetEnb(enbLteDevice);
+    }
+
+    // The UE is connected by DoPreAttach once all the bearers of the UE are
+    // known to the NAS, which receives them with events scheduled now (see
+    // EpcHelper::ActivateEpsBearer), possibly after this method is called
+    // (e.g., by ActivateDedicatedEpsBearer). Hence DoPreAttach is scheduled
+    // from an event executed at the beginning of the simulation, so that it
+    // is executed after all the events scheduled before the simulation begins.
+    Simulator::ScheduleNow(&LteHelper::SchedulePreAttach,
+                           this,
+                           ueDevice,
+                           enbDevice,
+                           componentCarrierId);
+}
+
+void
+LteHelper::PreAttachToClosestEnb(NetDeviceContainer ueDevices, NetDeviceContainer enbDevices)
+{
+    NS_LOG_FUNCTION(this);
+    for (NetDeviceContainer::Iterator i = ueDevices.Begin(); i != ueDevices.End(); ++i)
+    {
+        PreAttachToClosestEnb(*i, enbDevices);
+    }
+}
+
+void
+LteHelper::PreAttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDevices)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(enbDevices.GetN() > 0, "empty enb device container");
+    Vector uepos = ueDevice->GetNode()->GetObject<MobilityModel>()->GetPosition();
+    double minDistance = std::numeric_limits<double>::infinity();
+    Ptr<NetDevice> closestEnbDevice;
+    for (NetDeviceContainer::Iterator i = enbDevices.Begin(); i != enbDevices.End(); ++i)
+    {
+        Vector enbpos = (*i)->GetNode()->GetObject<MobilityModel>()->GetPosition();
+        double distance = CalculateDistance(uepos, enbpos);
+        if (distance < minDistance)
+        {
+            minDistance = distance;
+            closestEnbDevice = *i;
+        }
+    }
+    NS_ASSERT(closestEnbDevice);
+    PreAttach(ueDevice, closestEnbDevice);
+}
+
+void
+LteHelper::SchedulePreAttach(Ptr<NetDevice> ueDevice,
+                             Ptr<NetDevice> enbDevice,
+                             uint8_t componentCarrierId)
+{
+    NS_LOG_FUNCTION(this << ueDevice << enbDevice << +componentCarrierId);
+    Simulator::ScheduleNow(&LteHelper::DoPreAttach,
+                           this,
+                           ueDevice,
+                           enbDevice,
+                           componentCarrierId);
+}
+
+void
+LteHelper::DoPreAttach(Ptr<NetDevice> ueDevice,
+                       Ptr<NetDevice> enbDevice,
+                       uint8_t componentCarrierId)
+{
+    NS_LOG_FUNCTION(this << ueDevice << enbDevice << +componentCarrierId);
+
+    Ptr<LteUeNetDevice> ueLteDevice = ueDevice->GetObject<LteUeNetDevice>();
+    Ptr<LteEnbNetDevice> enbLteDevice = enbDevice->GetObject<LteEnbNetDevice>();
+    Ptr<LteUeRrc> ueRrc = ueLteDevice->GetRrc();
+    Ptr<LteEnbRrc> enbRrc = enbLteDevice->GetRrc();
+    uint64_t imsi = ueLteDevice->GetImsi();
+
+    // same state as after the reception of the RRC Connection Request
+    uint16_t rnti = enbRrc->AddPreAttachedUe(imsi, componentCarrierId);
+
+    if (m_epcHelper)
+    {
+        // same state as after the attach procedure, which sets up the bearers
+        // of the UE in the eNB
+        m_epcHelper->PreAttachUe(imsi, enbDevice, rnti);
+    }
+
+    // same state as after the RRC connection reconfiguration which follows
+    // the attach procedure, at both the eNB and the UE
+    LteRrcSap::RrcConnectionReconfiguration msg = enbRrc->ConnectPreAttachedUe(rnti);
+    ueRrc->PreAttach(enbRrc->GetSystemInformation(componentCarrierId), msg);
+
+    // let the UE RRC protocol deliver the messages of the UE to the eNB
+    if (m_useIdealRrc)
+    {
+        ueRrc->GetObject<LteUeRrcProtocolIdeal>()->SetEnbRrc(enbRrc);
+    }
+    else
+    {
+        ueRrc->GetObject<LteUeRrcProtocolReal>()->SetEnbRrc(enbRrc);
+    }
+}
+
 uint8_t
 LteHelper::ActivateDedicatedEpsBearer(NetDeviceContainer ueDevices,
                                       EpsBearer bearer,
@@ -1220,8 +1363,8 @@ class DrbActivator : public SimpleRefCount<DrbActivator>
     /**
      * Procedure firstly checks if bearer was not activated, if IMSI
      * from trace source equals configured one and if UE is really
-     * in RRC connected state. If all requirements are met, it performs
-     * bearer activation.
+     * in RRC connected state at the eNB. If all requirements are met,
+     * it performs bearer activation.
      *
      * \param imsi
      * \param cellId
@@ -1275,15 +1418,15 @@ DrbActivator::ActivateDrb(uint64_t imsi, uint16_t cellId, uint16_t rnti)
     NS_LOG_FUNCTION(this << imsi << cellId << rnti << m_active);
     if ((!m_active) && (imsi == m_imsi))
     {
-        Ptr<LteUeRrc> ueRrc = m_ueDevice->GetObject<LteUeNetDevice>()->GetRrc();
-        NS_ASSERT(ueRrc->GetState() == LteUeRrc::CONNECTED_NORMALLY);
-        uint16_t rnti = ueRrc->GetRnti();
         Ptr<LteEnbNetDevice> enbLteDevice = m_ueDevice->GetObject<LteUeNetDevice>()->GetTargetEnb();
         Ptr<LteEnbRrc> enbRrc = enbLteDevice->GetObject<LteEnbNetDevice>()->GetRrc();
-        NS_ASSERT(ueRrc->GetCellId() == enbLteDevice->GetCellId());
+        NS_ASSERT(enbLteDevice->HasCellId(cellId));
         Ptr<UeManager> ueManager = enbRrc->GetUeManager(rnti);
+        // ATTACH_REQUEST is the state of a UE which is being pre-attached, see
+        // LteHelper::PreAttach
         NS_ASSERT(ueManager->GetState() == UeManager::CONNECTED_NORMALLY ||
-                  ueManager->GetState() == UeManager::CONNECTION_RECONFIGURATION);
+                  ueManager->GetState() == UeManager::CONNECTION_RECONFIGURATION ||
+                  ueManager->GetState() == UeManager::ATTACH_REQUEST);
         EpcEnbS1SapUser::DataRadioBearerSetupRequestParameters params;
         params.rnti = rnti;
         params.bearer = m_bearer;
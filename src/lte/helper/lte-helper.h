@@ -446,6 +446,67 @@ class LteHelper : public Object
      */
     void AttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDevices);
 
+    /**
+     * \brief Manual attachment of a set of UE devices to the network via a given
+     *        eNodeB, without the RRC connection establishment and the attach
+     *        procedure.
+     * \param ueDevices the set of UE devices to be attached
+     * \param enbDevice the destination eNodeB device
+     *
+     * \sa LteHelper::PreAttach(Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice,
+     *     uint8_t componentCarrierId)
+     */
+    void PreAttach(NetDeviceContainer ueDevices, Ptr<NetDevice> enbDevice);
+
+    /**
+     * \brief Manual attachment of a UE device to the network via a given eNodeB,
+     *        without the RRC connection establishment and the attach procedure.
+     * \param ueDevice the UE device to be attached
+     * \param enbDevice the destination eNodeB device
+     * \param componentCarrierId the destination eNodeB component carrier
+     *
+     * The UE starts the simulation in the state reached at the end of a manual
+     * attachment (see LteHelper::Attach), i.e., CONNECTED to the given cell with
+     * the default EPS bearer and the bearers activated before the beginning of
+     * the simulation (with ActivateDedicatedEpsBearer or ActivateDataRadioBearer).
+     * This state is built at time zero by the same RRC and EPC procedures used
+     * by the regular attachment, but without exchanging any message: the random
+     * access, the RRC connection establishment, the S1-AP/S11 signaling and the
+     * RRC connection reconfiguration are skipped. This is meant for simulations
+     * where the attachment of many UEs is not the object of the study and would
+     * otherwise dominate the simulation time.
+     *
+     * The function can be used in both LTE-only and EPC-enabled simulations, and
+     * it must be called before the simulation begins.
+     */
+    void PreAttach(Ptr<NetDevice> ueDevice,
+                   Ptr<NetDevice> enbDevice,
+                   uint8_t componentCarrierId = 0);
+
+    /**
+     * \brief Manual attachment of a set of UE devices to the network via the
+     *        closest eNodeB (with respect to distance) among those in the set,
+     *        without the RRC connection establishment and the attach procedure.
+     * \param ueDevices the set of UE devices to be attached
+     * \param enbDevices the set of eNodeB devices to be considered
+     *
+     * \sa LteHelper::PreAttach(Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice,
+     *     uint8_t componentCarrierId)
+     */
+    void PreAttachToClosestEnb(NetDeviceContainer ueDevices, NetDeviceContainer enbDevices);
+
+    /**
+     * \brief Manual attachment of a UE device to the network via the closest
+     *        eNodeB (with respect to distance) among those in the set, without
+     *        the RRC connection establishment and the attach procedure.
+     * \param ueDevice the UE device to be attached
+     * \param enbDevices the set of eNodeB devices to be considered
+     *
+     * \sa LteHelper::PreAttach(Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice,
+     *     uint8_t componentCarrierId)
+     */
+    void PreAttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDevices);
+
     /**
      * Activate a dedicated EPS bearer on a given set of UE devices.
      *
@@ -725,6 +786,33 @@ class LteHelper : public Object
                            Ptr<NetDevice> sourceEnbDev,
                            uint16_t targetCellId);
 
+    /**
+     * Schedule DoPreAttach after all the events scheduled before the beginning
+     * of the simulation.
+     * \param ueDevice the UE device to be attached
+     * \param enbDevice the destination eNodeB device
+     * \param componentCarrierId the destination eNodeB component carrier
+     *
+     * This method is scheduled by PreAttach() to run at the beginning of the
+     * simulation.
+     */
+    void SchedulePreAttach(Ptr<NetDevice> ueDevice,
+                           Ptr<NetDevice> enbDevice,
+                           uint8_t componentCarrierId);
+
+    /**
+     * The actual function to connect a UE without the RRC connection
+     * establishment and the attach procedure.
+     * \param ueDevice the UE device to be attached
+     * \param enbDevice the destination eNodeB device
+     * \param componentCarrierId the destination eNodeB component carrier
+     *
+     * This method is scheduled by SchedulePreAttach().
+     */
+    void DoPreAttach(Ptr<NetDevice> ueDevice,
+                     Ptr<NetDevice> enbDevice,
+                     uint8_t componentCarrierId);
+
     /**
      * \brief The actual function to trigger a manual bearer de-activation
      * \param ueDevice the UE on which bearer to be de-activated must be of the type LteUeNetDevice
@@ -829,6 +917,11 @@ class LteHelper : public Object
      * RRC signaling. If false, LteRrcProtocolReal will be used.
      */
     bool m_useIdealRrc;
+    /**
+     * The `SkipRrcDecoding` attribute. If true, the `SkipDecoding` attribute
+     * of LteRrcProtocolReal is set on the eNBs and the UEs.
+     */
+    bool m_skipRrcDecoding;
     /**
      * The `AnrEnabled` attribute. Activate or deactivate Automatic Neighbour
      * Relation function.
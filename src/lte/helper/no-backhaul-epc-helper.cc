@@ -506,6 +506,39 @@ NoBackhaulEpcHelper::ActivateEpsBearer(Ptr<NetDevice> ueDevice,
     return bearerId;
 }
 
+void
+NoBackhaulEpcHelper::PreAttachUe(uint64_t imsi, Ptr<NetDevice> enbLteDevice, uint16_t rnti)
+{
+    NS_LOG_FUNCTION(this << imsi << enbLteDevice << rnti);
+
+    Ptr<LteEnbNetDevice> enbDevice = enbLteDevice->GetObject<LteEnbNetDevice>();
+    NS_ABORT_MSG_IF(!enbDevice, "Unable to find LteEnbNetDevice");
+    // the eNB application identifies itself to the core network with its first cell ID
+    uint16_t cellId = enbDevice->GetCellIds().at(0);
+    Ptr<EpcEnbApplication> enbApp =
+        enbDevice->GetNode()->GetApplication(0)->GetObject<EpcEnbApplication>();
+    NS_ASSERT_MSG(enbApp, "cannot retrieve EpcEnbApplication");
+
+    // same state as after the Create Session Request/Response exchanged by MME, SGW and PGW
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts =
+        m_mmeApp->PreAttachUe(imsi, cellId);
+    bearerContexts = m_sgwApp->PreAttachUe(imsi, cellId, bearerContexts);
+    m_pgwApp->PreAttachUe(imsi, bearerContexts);
+
+    // same state as after the Initial Context Setup Request sent by the MME to the eNB
+    std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList;
+    for (const auto& bearerContext : bearerContexts)
+    {
+        EpcS1apSapEnb::ErabToBeSetupItem erab;
+        erab.erabId = bearerContext.epsBearerId;
+        erab.erabLevelQosParameters = bearerContext.bearerLevelQos;
+        erab.transportLayerAddress = bearerContext.sgwS5uFteid.addr;
+        erab.sgwTeid = bearerContext.sgwS5uFteid.teid;
+        erabToBeSetupList.push_back(erab);
+    }
+    enbApp->PreAttachUe(imsi, rnti, erabToBeSetupList);
+}
+
 void
 NoBackhaulEpcHelper::DoActivateEpsBearerForUe(const Ptr<NetDevice>& ueDevice,
                                               const Ptr<EpcTft>& tft,
@@ -79,6 +79,7 @@ class NoBackhaulEpcHelper : public EpcHelper
                               uint64_t imsi,
                               Ptr<EpcTft> tft,
                               EpsBearer bearer) override;
+    void PreAttachUe(uint64_t imsi, Ptr<NetDevice> enbLteDevice, uint16_t rnti) override;
     Ptr<Node> GetSgwNode() const override;
     Ptr<Node> GetPgwNode() const override;
     Ipv4InterfaceContainer AssignUeIpv4Address(NetDeviceContainer ueDevices) override;
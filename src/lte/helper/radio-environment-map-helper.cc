@@ -20,6 +20,8 @@
 #include "radio-environment-map-helper.h"
 
 #include <ns3/abort.h>
+#include <ns3/angles.h>
+#include <ns3/antenna-model.h>
 #include <ns3/boolean.h>
 #include <ns3/buildings-helper.h>
 #include <ns3/config.h>
@@ -27,16 +29,22 @@
 #include <ns3/double.h>
 #include <ns3/integer.h>
 #include <ns3/log.h>
+#include <ns3/lte-spectrum-signal-parameters.h>
 #include <ns3/lte-spectrum-value-helper.h>
 #include <ns3/mobility-building-info.h>
 #include <ns3/node.h>
 #include <ns3/pointer.h>
+#include <ns3/propagation-loss-model.h>
 #include <ns3/rem-spectrum-phy.h>
 #include <ns3/simulator.h>
 #include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/string.h>
 #include <ns3/uinteger.h>
 
+#include <cmath>
+#include <filesystem>
 #include <fstream>
 #include <limits>
 
@@ -48,6 +56,7 @@ NS_LOG_COMPONENT_DEFINE("RadioEnvironmentMapHelper");
 NS_OBJECT_ENSURE_REGISTERED(RadioEnvironmentMapHelper);
 
 RadioEnvironmentMapHelper::RadioEnvironmentMapHelper()
+    : m_skippedPoints(0)
 {
 }
 
@@ -59,6 +68,7 @@ void
 RadioEnvironmentMapHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_txSignals.clear();
 }
 
 TypeId
@@ -169,7 +179,23 @@ RadioEnvironmentMapHelper::GetTypeId()
                           "default value is -1, what means REM will be averaged from all RBs",
                           IntegerValue(-1),
                           MakeIntegerAccessor(&RadioEnvironmentMapHelper::m_rbId),
-                          MakeIntegerChecker<int32_t>());
+                          MakeIntegerChecker<int32_t>())
+            .AddAttribute("DirectComputation",
+                          "If true, the signals transmitted in a single subframe are captured "
+                          "and the SINR of every point is computed from them in a single step, "
+                          "without delivering the signals to a listener per point through the "
+                          "channel. MaxPointsPerIteration then only bounds the number of "
+                          "mobility models used to evaluate the propagation loss.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RadioEnvironmentMapHelper::m_directComputation),
+                          MakeBooleanChecker())
+            .AddAttribute("ResumeOutput",
+                          "If true, the points already present in the output file are not "
+                          "computed again, and the new points are appended to the file. "
+                          "Only supported with DirectComputation.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RadioEnvironmentMapHelper::m_resumeOutput),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -220,7 +246,17 @@ RadioEnvironmentMapHelper::Install()
                         "object at " << m_channelPath << " is not of type SpectrumChannel");
     }
 
-    m_outFile.open(m_outputFile.c_str());
+    NS_ABORT_MSG_IF(m_resumeOutput && !m_directComputation,
+                    "ResumeOutput is only supported with DirectComputation");
+    if (m_resumeOutput)
+    {
+        m_skippedPoints = RecoverOutputFile();
+        m_outFile.open(m_outputFile.c_str(), std::ios_base::app);
+    }
+    else
+    {
+        m_outFile.open(m_outputFile.c_str());
+    }
     if (!m_outFile.is_open())
     {
         NS_FATAL_ERROR("Can't open file " << (m_outputFile));
@@ -250,6 +286,33 @@ RadioEnvironmentMapHelper::DelayedInstall()
         m_maxPointsPerIteration = m_xRes * m_yRes;
     }
 
+    if (m_directComputation)
+    {
+        // A single listener, not attached to the channel, accumulates the
+        // power of the captured signals.  The points still use their own
+        // mobility model, as the propagation loss models may store state
+        // (e.g., shadowing) per pair of mobility models.
+        Ptr<RemSpectrumPhy> phy = CreateObject<RemSpectrumPhy>();
+        phy->SetRxSpectrumModel(LteSpectrumValueHelper::GetSpectrumModel(m_earfcn, m_bandwidth));
+        phy->SetUseDataChannel(m_useDataChannel);
+        phy->SetRbId(m_rbId);
+        for (uint32_t i = 0; i < m_maxPointsPerIteration; ++i)
+        {
+            RemPoint p;
+            p.phy = phy;
+            p.bmm = CreateObject<ConstantPositionMobilityModel>();
+            Ptr<MobilityBuildingInfo> buildingInfo = CreateObject<MobilityBuildingInfo>();
+            p.bmm->AggregateObject(buildingInfo);
+            m_rem.push_back(p);
+        }
+        m_channel->TraceConnectWithoutContext(
+            "TxSigParams",
+            MakeCallback(&RadioEnvironmentMapHelper::CaptureTxSignal, this));
+        // same delay as the first PrintAndReset() of the iterative generation
+        Simulator::Schedule(Seconds(0.0006), &RadioEnvironmentMapHelper::RunDirectComputation, this);
+        return;
+    }
+
     for (uint32_t i = 0; i < m_maxPointsPerIteration; ++i)
     {
         RemPoint p;
@@ -359,6 +422,156 @@ RadioEnvironmentMapHelper::PrintAndReset()
     }
 }
 
+void
+RadioEnvironmentMapHelper::CaptureTxSignal(Ptr<SpectrumSignalParameters> params)
+{
+    NS_LOG_FUNCTION(this << params);
+    // keep only the signals that RemSpectrumPhy takes into account
+    bool relevant = m_useDataChannel
+                        ? (DynamicCast<LteSpectrumSignalParametersDataFrame>(params) != nullptr)
+                        : (DynamicCast<LteSpectrumSignalParametersDlCtrlFrame>(params) != nullptr);
+    if (relevant)
+    {
+        m_txSignals.push_back(params);
+    }
+}
+
+void
+RadioEnvironmentMapHelper::RunDirectComputation()
+{
+    NS_LOG_FUNCTION(this);
+    m_channel->TraceDisconnectWithoutContext(
+        "TxSigParams",
+        MakeCallback(&RadioEnvironmentMapHelper::CaptureTxSignal, this));
+    NS_ABORT_MSG_IF(m_channel->GetPhasedArraySpectrumPropagationLossModel(),
+                    "PhasedArraySpectrumPropagationLossModel not supported by DirectComputation");
+    Ptr<PropagationLossModel> propagationLoss = m_channel->GetPropagationLossModel();
+    Ptr<SpectrumPropagationLossModel> spectrumPropagationLoss =
+        m_channel->GetSpectrumPropagationLossModel();
+    DoubleValue maxLossDb;
+    m_channel->GetAttribute("MaxLossDb", maxLossDb);
+
+    // convert the transmitted PSDs to the spectrum model of the map, as done by the channel
+    Ptr<RemSpectrumPhy> phy = m_rem.front().phy;
+    Ptr<const SpectrumModel> rxSpectrumModel = phy->GetRxSpectrumModel();
+    std::vector<Ptr<SpectrumSignalParameters>> txSignals;
+    for (const auto& txParams : m_txSignals)
+    {
+        Ptr<const SpectrumModel> txSpectrumModel = txParams->psd->GetSpectrumModel();
+        if (txSpectrumModel->GetUid() == rxSpectrumModel->GetUid())
+        {
+            txSignals.push_back(txParams);
+        }
+        else if (!txSpectrumModel->IsOrthogonal(*rxSpectrumModel))
+        {
+            SpectrumConverter converter(txSpectrumModel, rxSpectrumModel);
+            Ptr<SpectrumSignalParameters> convertedParams = txParams->Copy();
+            convertedParams->psd = converter.Convert(txParams->psd);
+            txSignals.push_back(convertedParams);
+        }
+    }
+    m_txSignals.clear();
+    NS_LOG_LOGIC("computing the map from " << txSignals.size() << " signals, skipping "
+                                           << m_skippedPoints << " points");
+
+    uint64_t point = 0;
+    std::list<RemPoint>::iterator remIt = m_rem.begin();
+    for (double x = m_xMin; x < m_xMax + 0.5 * m_xStep; x += m_xStep)
+    {
+        for (double y = m_yMin; y < m_yMax + 0.5 * m_yStep; y += m_yStep)
+        {
+            // use the mobility models in the same order as the iterative generation
+            Ptr<MobilityModel> rxMobility = remIt->bmm;
+            if (++remIt == m_rem.end())
+            {
+                remIt = m_rem.begin();
+            }
+            if (point++ < m_skippedPoints)
+            {
+                continue;
+            }
+            rxMobility->SetPosition(Vector(x, y, m_z));
+            rxMobility->GetObject<MobilityBuildingInfo>()->MakeConsistent(rxMobility);
+
+            for (const auto& txParams : txSignals)
+            {
+                Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
+                Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility();
+                if (txMobility)
+                {
+                    double pathLossDb = 0;
+                    if (rxParams->txAntenna)
+                    {
+                        Angles txAngles(rxMobility->GetPosition(), txMobility->GetPosition());
+                        pathLossDb -= rxParams->txAntenna->GetGainDb(txAngles);
+                    }
+                    if (propagationLoss)
+                    {
+                        pathLossDb -= propagationLoss->CalcRxPower(0, txMobility, rxMobility);
+                    }
+                    if (pathLossDb > maxLossDb.Get())
+                    {
+                        // beyond range
+                        continue;
+                    }
+                    *(rxParams->psd) *= std::pow(10.0, (-pathLossDb) / 10.0);
+                    if (spectrumPropagationLoss)
+                    {
+                        rxParams->psd =
+                            spectrumPropagationLoss->CalcRxPowerSpectralDensity(rxParams,
+                                                                                txMobility,
+                                                                                rxMobility);
+                    }
+                }
+                phy->StartRx(rxParams);
+            }
+
+            NS_LOG_LOGIC("output: " << x << "\t" << y << "\t" << m_z << "\t"
+                                    << phy->GetSinr(m_noisePower));
+            m_outFile << x << "\t" << y << "\t" << m_z << "\t" << phy->GetSinr(m_noisePower)
+                      << "\n";
+            phy->Reset();
+        }
+        // make the completed columns available for ResumeOutput
+        m_outFile.flush();
+    }
+
+    Finalize();
+}
+
+uint64_t
+RadioEnvironmentMapHelper::RecoverOutputFile()
+{
+    NS_LOG_FUNCTION(this);
+    std::ifstream inFile(m_outputFile.c_str(), std::ios_base::binary);
+    if (!inFile.is_open())
+    {
+        // nothing to resume
+        return 0;
+    }
+    uint64_t lines = 0;
+    uint64_t size = 0;
+    uint64_t completeSize = 0;
+    char c;
+    while (inFile.get(c))
+    {
+        ++size;
+        if (c == '\n')
+        {
+            ++lines;
+            completeSize = size;
+        }
+    }
+    inFile.close();
+    if (completeSize < size)
+    {
+        NS_LOG_LOGIC("removing an incomplete line at the end of " << m_outputFile);
+        std::filesystem::resize_file(m_outputFile, completeSize);
+    }
+    NS_LOG_INFO(lines << " points already in " << m_outputFile);
+    return lines;
+}
+
 void
 RadioEnvironmentMapHelper::Finalize()
 {
@@ -23,11 +23,13 @@
 #include <ns3/object.h>
 
 #include <fstream>
+#include <vector>
 
 namespace ns3
 {
 
 class RemSpectrumPhy;
+class SpectrumSignalParameters;
 class Node;
 class NetDevice;
 class SpectrumChannel;
@@ -101,6 +103,31 @@ class RadioEnvironmentMapHelper : public Object
     /// Go through every listener, write the computed SINR, and then reset it.
     void PrintAndReset();
 
+    /**
+     * TxSigParams trace sink of the channel, storing the signals transmitted
+     * on the channel for which the map is generated, when the map is
+     * computed directly.
+     *
+     * \param params the parameters of the transmitted signal
+     */
+    void CaptureTxSignal(Ptr<SpectrumSignalParameters> params);
+
+    /**
+     * Compute the SINR of every point of the map from the signals captured
+     * by CaptureTxSignal(), without going through the channel, and write it
+     * to the output file.
+     */
+    void RunDirectComputation();
+
+    /**
+     * Prepare the output file for the continuation of a map computed
+     * directly: remove the trailing incomplete line, if any, and count the
+     * points already written.
+     *
+     * \return the number of points already written in the output file
+     */
+    uint64_t RecoverOutputFile();
+
     /// Called when the map generation procedure has been completed.
     void Finalize();
 
@@ -159,6 +186,13 @@ class RadioEnvironmentMapHelper : public Object
     bool m_useDataChannel; ///< The `UseDataChannel` attribute.
     int32_t m_rbId;        ///< The `RbId` attribute.
 
+    bool m_directComputation; ///< The `DirectComputation` attribute.
+    bool m_resumeOutput;      ///< The `ResumeOutput` attribute.
+    uint64_t m_skippedPoints; ///< Number of points already in the output file.
+
+    /// Signals transmitted on the channel, captured for the direct computation.
+    std::vector<Ptr<SpectrumSignalParameters>> m_txSignals;
+
 }; // end of `class RadioEnvironmentMapHelper`
 
 } // namespace ns3
@@ -222,6 +222,31 @@ EpcEnbApplication::DoInitialContextSetupRequest(
     NS_ASSERT_MSG(imsiIt != m_imsiRntiMap.end(), "unknown IMSI");
     uint16_t rnti = imsiIt->second;
 
+    SetupDataRadioBearers(rnti, erabToBeSetupList);
+
+    // Send Initial Context Setup Request to RRC
+    struct EpcEnbS1SapUser::InitialContextSetupRequestParameters params;
+    params.rnti = rnti;
+    m_s1SapUser->InitialContextSetupRequest(params);
+}
+
+void
+EpcEnbApplication::PreAttachUe(uint64_t imsi,
+                               uint16_t rnti,
+                               std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList)
+{
+    NS_LOG_FUNCTION(this << imsi << rnti);
+    // side effect: create entry if not exist
+    m_imsiRntiMap[imsi] = rnti;
+    SetupDataRadioBearers(rnti, erabToBeSetupList);
+}
+
+void
+EpcEnbApplication::SetupDataRadioBearers(
+    uint16_t rnti,
+    std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList)
+{
+    NS_LOG_FUNCTION(this << rnti);
     for (std::list<EpcS1apSapEnb::ErabToBeSetupItem>::iterator erabIt = erabToBeSetupList.begin();
          erabIt != erabToBeSetupList.end();
          ++erabIt)
@@ -239,11 +264,6 @@ EpcEnbApplication::DoInitialContextSetupRequest(
         m_rbidTeidMap[rnti][erabIt->erabId] = params.gtpTeid;
         m_teidRbidMap[params.gtpTeid] = rbid;
     }
-
-    // Send Initial Context Setup Request to RRC
-    struct EpcEnbS1SapUser::InitialContextSetupRequestParameters params;
-    params.rnti = rnti;
-    m_s1SapUser->InitialContextSetupRequest(params);
 }
 
 void
@@ -121,6 +121,20 @@ class EpcEnbApplication : public Application
      */
     EpcS1apSapEnb* GetS1apSapEnb();
 
+    /**
+     * Set up the E-RABs of a UE which is connected without the attach
+     * procedure (see LteHelper::PreAttach), as upon the reception of an
+     * Initial Context Setup Request from the MME, except that the RRC is only
+     * requested to set up the data radio bearers.
+     *
+     * \param imsi the unique identifier of the UE
+     * \param rnti the RNTI of the UE
+     * \param erabToBeSetupList the E-RABs to be set up
+     */
+    void PreAttachUe(uint64_t imsi,
+                     uint16_t rnti,
+                     std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList);
+
     /**
      * Method to be assigned to the recv callback of the LTE socket. It is called when the eNB
      * receives a data packet from the radio interface that is to be forwarded to the SGW.
@@ -210,6 +224,15 @@ class EpcEnbApplication : public Application
         uint64_t mmeUeS1Id,
         uint16_t enbUeS1Id,
         std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList);
+
+    /**
+     * Request the RRC to set up the data radio bearers of a list of E-RABs
+     * and map their S1-U TEIDs
+     * \param rnti the RNTI of the UE
+     * \param erabToBeSetupList the ERAB setup list
+     */
+    void SetupDataRadioBearers(uint16_t rnti,
+                               std::list<EpcS1apSapEnb::ErabToBeSetupItem> erabToBeSetupList);
     /**
      * Path Switch Request Acknowledge
      * \param mmeUeS1Id the MME UE S1 ID
@@ -112,6 +112,28 @@ EpcMmeApplication::AddBearer(uint64_t imsi, Ptr<EpcTft> tft, EpsBearer bearer)
     return bearerInfo.bearerId;
 }
 
+std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated>
+EpcMmeApplication::PreAttachUe(uint64_t imsi, uint16_t ecgi)
+{
+    NS_LOG_FUNCTION(this << imsi << ecgi);
+    std::map<uint64_t, Ptr<UeInfo>>::iterator it = m_ueInfoMap.find(imsi);
+    NS_ASSERT_MSG(it != m_ueInfoMap.end(), "could not find any UE with IMSI " << imsi);
+    NS_ASSERT_MSG(m_enbInfoMap.find(ecgi) != m_enbInfoMap.end(),
+                  "could not find any eNB with CellId " << ecgi);
+    it->second->cellId = ecgi;
+
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts;
+    for (const auto& bearerInfo : it->second->bearersToBeActivated)
+    {
+        GtpcCreateSessionRequestMessage::BearerContextToBeCreated bearerContext;
+        bearerContext.epsBearerId = bearerInfo.bearerId;
+        bearerContext.tft = bearerInfo.tft;
+        bearerContext.bearerLevelQos = bearerInfo.bearer;
+        bearerContexts.push_back(bearerContext);
+    }
+    return bearerContexts;
+}
+
 // S1-AP SAP MME forwarded methods
 
 void
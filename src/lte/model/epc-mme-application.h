@@ -108,6 +108,20 @@ class EpcMmeApplication : public Application
      */
     uint8_t AddBearer(uint64_t imsi, Ptr<EpcTft> tft, EpsBearer bearer);
 
+    /**
+     * Set up the context of a UE which is connected without the attach
+     * procedure (see LteHelper::PreAttach), as upon the reception of an
+     * Initial UE Message from the given cell.
+     *
+     * \param imsi the unique identifier of the UE
+     * \param ecgi E-UTRAN Cell Global ID of the serving eNB
+     * \returns the bearer contexts which would be sent to the SGW in the
+     * Create Session Request
+     */
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> PreAttachUe(
+        uint64_t imsi,
+        uint16_t ecgi);
+
   private:
     // S1-AP SAP MME forwarded methods
 
@@ -513,4 +513,25 @@ EpcPgwApplication::SetUeAddress6(uint64_t imsi, Ipv6Address ueAddr)
     ueit->second->SetUeAddr6(ueAddr);
 }
 
+void
+EpcPgwApplication::PreAttachUe(
+    uint64_t imsi,
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts)
+{
+    NS_LOG_FUNCTION(this << imsi);
+    std::map<uint64_t, Ptr<UeInfo>>::iterator ueit = m_ueInfoByImsiMap.find(imsi);
+    NS_ASSERT_MSG(ueit != m_ueInfoByImsiMap.end(), "unknown IMSI " << imsi);
+    ueit->second->SetSgwAddr(m_sgwS5Addr);
+
+    for (auto& bearerContext : bearerContexts)
+    {
+        NS_LOG_DEBUG("bearerId " << (uint16_t)bearerContext.epsBearerId << " SGW "
+                                 << bearerContext.sgwS5uFteid.addr << " TEID "
+                                 << bearerContext.sgwS5uFteid.teid);
+        ueit->second->AddBearer(bearerContext.epsBearerId,
+                                bearerContext.sgwS5uFteid.teid,
+                                bearerContext.tft);
+    }
+}
+
 } // namespace ns3
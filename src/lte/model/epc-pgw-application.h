@@ -157,6 +157,19 @@ class EpcPgwApplication : public Application
      */
     void SetUeAddress6(uint64_t imsi, Ipv6Address ueAddr);
 
+    /**
+     * Set up the session of a UE which is connected without the attach
+     * procedure (see LteHelper::PreAttach), as upon the reception of a
+     * Create Session Request from the SGW.
+     *
+     * \param imsi the unique identifier of the UE
+     * \param bearerContexts the bearer contexts to be created, including
+     * the S5-U TEIDs allocated by the SGW
+     */
+    void PreAttachUe(
+        uint64_t imsi,
+        std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts);
+
     /**
      * TracedCallback signature for data Packet reception event.
      *
@@ -97,6 +97,63 @@ EpcSgwApplication::AddEnb(uint16_t cellId, Ipv4Address enbAddr, Ipv4Address sgwA
     m_enbInfoByCellId[cellId] = enbInfo;
 }
 
+std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated>
+EpcSgwApplication::PreAttachUe(
+    uint64_t imsi,
+    uint16_t cellId,
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts)
+{
+    NS_LOG_FUNCTION(this << imsi << cellId);
+
+    GtpcHeader::Fteid_t mmeS11Fteid;
+    mmeS11Fteid.interfaceType = GtpcHeader::S11_MME_GTPC;
+    mmeS11Fteid.teid = imsi;
+    mmeS11Fteid.addr = m_mmeS11Addr;
+    return SetupSession(imsi, cellId, mmeS11Fteid, bearerContexts);
+}
+
+std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated>
+EpcSgwApplication::SetupSession(
+    uint64_t imsi,
+    uint16_t cellId,
+    GtpcHeader::Fteid_t mmeS11Fteid,
+    const std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated>& bearerContexts)
+{
+    NS_LOG_FUNCTION(this << imsi << cellId);
+
+    std::map<uint16_t, EnbInfo>::iterator enbit = m_enbInfoByCellId.find(cellId);
+    NS_ASSERT_MSG(enbit != m_enbInfoByCellId.end(), "unknown CellId " << cellId);
+    Ipv4Address enbAddr = enbit->second.enbAddr;
+    NS_LOG_DEBUG("eNB " << enbAddr);
+
+    // the S5 SGW GTP-C TEID is the IMSI
+    m_mmeS11FteidBySgwS5cTeid[imsi] = mmeS11Fteid;
+
+    NS_LOG_DEBUG("BearerContextToBeCreated size = " << bearerContexts.size());
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContextsOut;
+    for (auto& bearerContext : bearerContexts)
+    {
+        // simple sanity check. If you ever need more than 4M teids
+        // throughout your simulation, you'll need to implement a smarter teid
+        // management algorithm.
+        NS_ABORT_IF(m_teidCount == 0xFFFFFFFF);
+        uint32_t teid = ++m_teidCount;
+
+        NS_LOG_DEBUG("  TEID " << teid);
+        m_enbByTeidMap[teid] = enbAddr;
+
+        GtpcCreateSessionRequestMessage::BearerContextToBeCreated bearerContextOut;
+        bearerContextOut.sgwS5uFteid.interfaceType = GtpcHeader::S5_SGW_GTPU;
+        bearerContextOut.sgwS5uFteid.teid = teid; // S5U SGW FTEID
+        bearerContextOut.sgwS5uFteid.addr = enbit->second.sgwAddr;
+        bearerContextOut.epsBearerId = bearerContext.epsBearerId;
+        bearerContextOut.bearerLevelQos = bearerContext.bearerLevelQos;
+        bearerContextOut.tft = bearerContext.tft;
+        bearerContextsOut.push_back(bearerContextOut);
+    }
+    return bearerContextsOut;
+}
+
 void
 EpcSgwApplication::RecvFromS11Socket(Ptr<Socket> socket)
 {
@@ -232,11 +289,6 @@ EpcSgwApplication::DoRecvCreateSessionRequest(Ptr<Packet> packet)
     uint16_t cellId = msg.GetUliEcgi();
     NS_LOG_DEBUG("cellId " << cellId << " IMSI " << imsi);
 
-    std::map<uint16_t, EnbInfo>::iterator enbit = m_enbInfoByCellId.find(cellId);
-    NS_ASSERT_MSG(enbit != m_enbInfoByCellId.end(), "unknown CellId " << cellId);
-    Ipv4Address enbAddr = enbit->second.enbAddr;
-    NS_LOG_DEBUG("eNB " << enbAddr);
-
     GtpcHeader::Fteid_t mmeS11Fteid = msg.GetSenderCpFteid();
     NS_ASSERT_MSG(mmeS11Fteid.interfaceType == GtpcHeader::S11_MME_GTPC, "wrong interface type");
 
@@ -247,36 +299,11 @@ EpcSgwApplication::DoRecvCreateSessionRequest(Ptr<Packet> packet)
     GtpcHeader::Fteid_t sgwS5cFteid;
     sgwS5cFteid.interfaceType = GtpcHeader::S5_SGW_GTPC;
     sgwS5cFteid.teid = imsi;
-    m_mmeS11FteidBySgwS5cTeid[sgwS5cFteid.teid] = mmeS11Fteid;
     sgwS5cFteid.addr = m_s5Addr;
     msgOut.SetSenderCpFteid(sgwS5cFteid); // S5 SGW GTP-C TEID
 
-    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts =
-        msg.GetBearerContextsToBeCreated();
-    NS_LOG_DEBUG("BearerContextToBeCreated size = " << bearerContexts.size());
-    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContextsOut;
-    for (auto& bearerContext : bearerContexts)
-    {
-        // simple sanity check. If you ever need more than 4M teids
-        // throughout your simulation, you'll need to implement a smarter teid
-        // management algorithm.
-        NS_ABORT_IF(m_teidCount == 0xFFFFFFFF);
-        uint32_t teid = ++m_teidCount;
-
-        NS_LOG_DEBUG("  TEID " << teid);
-        m_enbByTeidMap[teid] = enbAddr;
-
-        GtpcCreateSessionRequestMessage::BearerContextToBeCreated bearerContextOut;
-        bearerContextOut.sgwS5uFteid.interfaceType = GtpcHeader::S5_SGW_GTPU;
-        bearerContextOut.sgwS5uFteid.teid = teid; // S5U SGW FTEID
-        bearerContextOut.sgwS5uFteid.addr = enbit->second.sgwAddr;
-        bearerContextOut.epsBearerId = bearerContext.epsBearerId;
-        bearerContextOut.bearerLevelQos = bearerContext.bearerLevelQos;
-        bearerContextOut.tft = bearerContext.tft;
-        bearerContextsOut.push_back(bearerContextOut);
-    }
-
-    msgOut.SetBearerContextsToBeCreated(bearerContextsOut);
+    msgOut.SetBearerContextsToBeCreated(
+        SetupSession(imsi, cellId, mmeS11Fteid, msg.GetBearerContextsToBeCreated()));
 
     msgOut.SetTeid(0);
     msgOut.ComputeMessageLength();
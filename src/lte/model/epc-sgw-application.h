@@ -95,6 +95,22 @@ class EpcSgwApplication : public Application
      */
     void AddEnb(uint16_t cellId, Ipv4Address enbAddr, Ipv4Address sgwAddr);
 
+    /**
+     * Set up the session of a UE which is connected without the attach
+     * procedure (see LteHelper::PreAttach), as upon the reception of a
+     * Create Session Request from the MME.
+     *
+     * \param imsi the unique identifier of the UE
+     * \param cellId the identifier of the serving cell
+     * \param bearerContexts the bearer contexts to be created
+     * \returns the bearer contexts which would be sent to the PGW in the
+     * Create Session Request, including the allocated S5-U TEIDs
+     */
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> PreAttachUe(
+        uint64_t imsi,
+        uint16_t cellId,
+        std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> bearerContexts);
+
   private:
     /**
      * Method to be assigned to the recv callback of the S11 socket.
@@ -148,6 +164,25 @@ class EpcSgwApplication : public Application
      */
     void SendToS1uSocket(Ptr<Packet> packet, Ipv4Address enbS1uAddress, uint32_t teid);
 
+    /**
+     * Set up the session of a UE upon a Create Session Request from the MME,
+     * or upon PreAttachUe(): store the MME S11 FTEID and allocate an S5-U
+     * TEID to each bearer.
+     *
+     * \param imsi the unique identifier of the UE, used as S5 SGW GTP-C TEID
+     * \param cellId the identifier of the serving cell
+     * \param mmeS11Fteid the S11 FTEID of the MME
+     * \param bearerContexts the bearer contexts to be created
+     * \returns the bearer contexts to be sent to the PGW in the Create Session
+     * Request, including the allocated S5-U TEIDs
+     */
+    std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated> SetupSession(
+        uint64_t imsi,
+        uint16_t cellId,
+        GtpcHeader::Fteid_t mmeS11Fteid,
+        const std::list<GtpcCreateSessionRequestMessage::BearerContextToBeCreated>&
+            bearerContexts);
+
     // Process messages received from the MME
 
     /**
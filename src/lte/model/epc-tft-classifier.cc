@@ -44,6 +44,36 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EpcTftClassifier");
 
+/// Maximum number of flows whose classification is cached
+static const std::size_t MAX_CLASSIFIED_FLOWS = 4096;
+
+bool
+EpcTftClassifier::FlowKey::operator==(const FlowKey& other) const
+{
+    return protocolNumber == other.protocolNumber && direction == other.direction &&
+           tos == other.tos && remotePort == other.remotePort && localPort == other.localPort &&
+           remoteAddress == other.remoteAddress && localAddress == other.localAddress;
+}
+
+std::size_t
+EpcTftClassifier::FlowKeyHash::operator()(const FlowKey& key) const
+{
+    // FNV-1a over the fields of the key
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+    mix(key.protocolNumber);
+    mix((static_cast<uint64_t>(key.direction) << 8) | key.tos);
+    mix((static_cast<uint64_t>(key.remotePort) << 16) | key.localPort);
+    for (std::size_t i = 0; i < key.remoteAddress.size(); i++)
+    {
+        mix((static_cast<uint64_t>(key.remoteAddress[i]) << 8) | key.localAddress[i]);
+    }
+    return static_cast<std::size_t>(hash);
+}
+
 EpcTftClassifier::EpcTftClassifier()
 {
     NS_LOG_FUNCTION(this);
@@ -54,6 +84,7 @@ EpcTftClassifier::Add(Ptr<EpcTft> tft, uint32_t id)
 {
     NS_LOG_FUNCTION(this << tft << id);
     m_tftMap[id] = tft;
+    m_classifiedFlows.clear();
 
     // simple sanity check: there shouldn't be more than 16 bearers (hence TFTs) per UE
     NS_ASSERT(m_tftMap.size() <= 16);
@@ -64,6 +95,7 @@ EpcTftClassifier::Delete(uint32_t id)
 {
     NS_LOG_FUNCTION(this << id);
     m_tftMap.erase(id);
+    m_classifiedFlows.clear();
 }
 
 uint32_t
@@ -262,66 +294,95 @@ EpcTftClassifier::Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t
         NS_ABORT_MSG("EpcTftClassifier::Classify - Unknown IP type...");
     }
 
+    FlowKey key;
+    key.protocolNumber = protocolNumber;
+    key.direction = direction;
+    key.tos = tos;
+    key.remotePort = remotePort;
+    key.localPort = localPort;
+    key.remoteAddress.fill(0);
+    key.localAddress.fill(0);
     if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
         NS_LOG_INFO("Classifying packet:"
                     << " localAddr=" << localAddressIpv4 << " remoteAddr=" << remoteAddressIpv4
                     << " localPort=" << localPort << " remotePort=" << remotePort << " tos=0x"
                     << (uint16_t)tos);
-
-        // now it is possible to classify the packet!
-        // we use a reverse iterator since filter priority is not implemented properly.
-        // This way, since the default bearer is expected to be added first, it will be evaluated
-        // last.
-        std::map<uint32_t, Ptr<EpcTft>>::const_reverse_iterator it;
-        NS_LOG_LOGIC("TFT MAP size: " << m_tftMap.size());
-
-        for (it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
-        {
-            NS_LOG_LOGIC("TFT id: " << it->first);
-            NS_LOG_LOGIC(" Ptr<EpcTft>: " << it->second);
-            Ptr<EpcTft> tft = it->second;
-            if (tft->Matches(direction,
-                             remoteAddressIpv4,
-                             localAddressIpv4,
-                             remotePort,
-                             localPort,
-                             tos))
-            {
-                NS_LOG_LOGIC("matches with TFT ID = " << it->first);
-                return it->first; // the id of the matching TFT
-            }
-        }
+        remoteAddressIpv4.Serialize(key.remoteAddress.data());
+        localAddressIpv4.Serialize(key.localAddress.data());
     }
-    else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
+    else
     {
         NS_LOG_INFO("Classifying packet:"
                     << " localAddr=" << localAddressIpv6 << " remoteAddr=" << remoteAddressIpv6
                     << " localPort=" << localPort << " remotePort=" << remotePort << " tos=0x"
                     << (uint16_t)tos);
+        remoteAddressIpv6.Serialize(key.remoteAddress.data());
+        localAddressIpv6.Serialize(key.localAddress.data());
+    }
 
-        // now it is possible to classify the packet!
-        // we use a reverse iterator since filter priority is not implemented properly.
-        // This way, since the default bearer is expected to be added first, it will be evaluated
-        // last.
-        std::map<uint32_t, Ptr<EpcTft>>::const_reverse_iterator it;
-        NS_LOG_LOGIC("TFT MAP size: " << m_tftMap.size());
+    auto flowIt = m_classifiedFlows.find(key);
+    if (flowIt != m_classifiedFlows.end())
+    {
+        NS_LOG_LOGIC("flow already classified with TFT ID = " << flowIt->second);
+        return flowIt->second;
+    }
+
+    uint32_t id =
+        MatchTfts(key, remoteAddressIpv4, localAddressIpv4, remoteAddressIpv6, localAddressIpv6);
+    if (m_classifiedFlows.size() >= MAX_CLASSIFIED_FLOWS)
+    {
+        m_classifiedFlows.clear();
+    }
+    m_classifiedFlows.emplace(key, id);
+    return id;
+}
+
+uint32_t
+EpcTftClassifier::MatchTfts(const FlowKey& key,
+                            Ipv4Address remoteAddressIpv4,
+                            Ipv4Address localAddressIpv4,
+                            Ipv6Address remoteAddressIpv6,
+                            Ipv6Address localAddressIpv6) const
+{
+    NS_LOG_FUNCTION(this);
+    auto direction = static_cast<EpcTft::Direction>(key.direction);
 
-        for (it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
+    // now it is possible to classify the packet!
+    // we use a reverse iterator since filter priority is not implemented properly.
+    // This way, since the default bearer is expected to be added first, it will be evaluated
+    // last.
+    std::map<uint32_t, Ptr<EpcTft>>::const_reverse_iterator it;
+    NS_LOG_LOGIC("TFT MAP size: " << m_tftMap.size());
+
+    for (it = m_tftMap.rbegin(); it != m_tftMap.rend(); ++it)
+    {
+        NS_LOG_LOGIC("TFT id: " << it->first);
+        NS_LOG_LOGIC(" Ptr<EpcTft>: " << it->second);
+        Ptr<EpcTft> tft = it->second;
+        bool matches;
+        if (key.protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
         {
-            NS_LOG_LOGIC("TFT id: " << it->first);
-            NS_LOG_LOGIC(" Ptr<EpcTft>: " << it->second);
-            Ptr<EpcTft> tft = it->second;
-            if (tft->Matches(direction,
-                             remoteAddressIpv6,
-                             localAddressIpv6,
-                             remotePort,
-                             localPort,
-                             tos))
-            {
-                NS_LOG_LOGIC("matches with TFT ID = " << it->first);
-                return it->first; // the id of the matching TFT
-            }
+            matches = tft->Matches(direction,
+                                   remoteAddressIpv4,
+                                   localAddressIpv4,
+                                   key.remotePort,
+                                   key.localPort,
+                                   key.tos);
+        }
+        else
+        {
+            matches = tft->Matches(direction,
+                                   remoteAddressIpv6,
+                                   localAddressIpv6,
+                                   key.remotePort,
+                                   key.localPort,
+                                   key.tos);
+        }
+        if (matches)
+        {
+            NS_LOG_LOGIC("matches with TFT ID = " << it->first);
+            return it->first; // the id of the matching TFT
         }
     }
     NS_LOG_LOGIC("no match");
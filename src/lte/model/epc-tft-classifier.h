@@ -24,7 +24,9 @@
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
 
+#include <array>
 #include <map>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -47,6 +49,11 @@ class Packet;
  *
  * When we cannot cache the port info, the TFT of the default bearer is used. This may happen
  * if there is reordering or losses of IP packets.
+ *
+ * The result of the classification of a flow, i.e., of the packets with the same direction,
+ * addresses, ports and type of service, is cached in a hash table, so that the TFTs are matched
+ * linearly only against the first packet of each flow. The cache is cleared whenever a TFT is
+ * added or deleted, hence a TFT must not be modified after having been added to the classifier.
  */
 class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
 {
@@ -82,8 +89,61 @@ class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
     uint32_t Classify(Ptr<Packet> p, EpcTft::Direction direction, uint16_t protocolNumber);
 
   protected:
+    /**
+     * \brief the fields of a packet the TFTs are matched against
+     */
+    struct FlowKey
+    {
+        uint16_t protocolNumber;               ///< the IP protocol (IPv4 or IPv6)
+        uint8_t direction;                     ///< the EPC TFT direction
+        uint8_t tos;                           ///< the type of service
+        uint16_t remotePort;                   ///< the remote port
+        uint16_t localPort;                    ///< the local port
+        std::array<uint8_t, 16> remoteAddress; ///< the remote address
+        std::array<uint8_t, 16> localAddress;  ///< the local address
+
+        /**
+         * \brief equality operator
+         * \param other the other flow key
+         * \return true if the two flow keys are equal
+         */
+        bool operator==(const FlowKey& other) const;
+    };
+
+    /**
+     * \brief hash function of a flow key
+     */
+    struct FlowKeyHash
+    {
+        /**
+         * \param key the flow key
+         * \return the hash of the flow key
+         */
+        std::size_t operator()(const FlowKey& key) const;
+    };
+
+    /**
+     * \brief match a flow linearly against the TFTs
+     *
+     * \param key the flow
+     * \param remoteAddressIpv4 the remote IPv4 address, if the flow is IPv4
+     * \param localAddressIpv4 the local IPv4 address, if the flow is IPv4
+     * \param remoteAddressIpv6 the remote IPv6 address, if the flow is IPv6
+     * \param localAddressIpv6 the local IPv6 address, if the flow is IPv6
+     * \return the identifier (>0) of the first TFT that matches with the flow; 0 if no TFT
+     * matched.
+     */
+    uint32_t MatchTfts(const FlowKey& key,
+                       Ipv4Address remoteAddressIpv4,
+                       Ipv4Address localAddressIpv4,
+                       Ipv6Address remoteAddressIpv6,
+                       Ipv6Address localAddressIpv6) const;
+
     std::map<uint32_t, Ptr<EpcTft>> m_tftMap; ///< TFT map
 
+    std::unordered_map<FlowKey, uint32_t, FlowKeyHash>
+        m_classifiedFlows; ///< identifiers of the TFTs matched by the flows already classified
+
     std::map<std::tuple<uint32_t, uint32_t, uint8_t, uint16_t>, std::pair<uint32_t, uint32_t>>
         m_classifiedIpv4Fragments; ///< Map with already classified IPv4 Fragments
                                    ///< An entry is added when the port info is available, i.e.
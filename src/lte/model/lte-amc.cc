@@ -599,12 +599,17 @@ LteAmc::CreateCqiFeedbacks(const SpectrumValue& sinr, uint8_t rbgSize)
             {
                 uint8_t mcs = 0;
                 TbStats_t tbStats;
+                HarqProcessInfoList_t harqInfoList;
+                double mib = 0.0;
                 while (mcs <= 28)
                 {
-                    HarqProcessInfoList_t harqInfoList;
+                    if ((mcs == 0) || (mcs == MI_QPSK_MAX_ID + 1) || (mcs == MI_16QAM_MAX_ID + 1))
+                    {
+                        // the MI of the RBG only changes with the modulation order
+                        mib = LteMiErrorModel::Mib(sinr, rbgMap, mcs);
+                    }
                     tbStats = LteMiErrorModel::GetTbDecodificationStats(
-                        sinr,
-                        rbgMap,
+                        mib,
                         (uint16_t)GetDlTbSizeFromMcs(mcs, rbgSize) / 8,
                         mcs,
                         harqInfoList);
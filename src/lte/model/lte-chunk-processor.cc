@@ -62,7 +62,14 @@ LteChunkProcessor::EvaluateChunk(const SpectrumValue& sinr, Time duration)
     {
         m_sumValues = Create<SpectrumValue>(sinr.GetSpectrumModel());
     }
-    (*m_sumValues) += sinr * duration.GetSeconds();
+    // accumulate in place, without a temporary SpectrumValue
+    NS_ASSERT(m_sumValues->GetValuesN() == sinr.GetValuesN());
+    double seconds = duration.GetSeconds();
+    auto sumIt = m_sumValues->ValuesBegin();
+    for (auto it = sinr.ConstValuesBegin(); it != sinr.ConstValuesEnd(); ++it, ++sumIt)
+    {
+        *sumIt += (*it) * seconds;
+    }
     m_totDuration += duration;
 }
 
@@ -302,6 +302,10 @@ UeManager::DoInitialize()
                                                        m_rnti);
         break;
 
+    case ATTACH_REQUEST:
+        // pre-attached UE, connected right away by LteEnbRrc::ConnectPreAttachedUe
+        break;
+
     default:
         NS_FATAL_ERROR("unexpected state " << ToString(m_state));
         break;
@@ -394,6 +398,52 @@ UeManager::InitialContextSetupRequest()
     }
 }
 
+LteRrcSap::RrcConnectionReconfiguration
+UeManager::PreAttach()
+{
+    NS_LOG_FUNCTION(this << m_rnti);
+    NS_ASSERT_MSG(m_state == ATTACH_REQUEST, "method unexpected in state " << ToString(m_state));
+
+    // without the EPC, this is when the data radio bearers are activated (see
+    // LteHelper::ActivateDataRadioBearer)
+    m_rrc->m_connectionEstablishedTrace(m_imsi,
+                                        m_rrc->ComponentCarrierToCellId(m_componentCarrierId),
+                                        m_rnti);
+
+    LteRrcSap::RrcConnectionReconfiguration msg = BuildRrcConnectionReconfiguration();
+    auto componentCarrier =
+        DynamicCast<ComponentCarrierEnb>(m_rrc->m_componentCarrierPhyConf.at(m_componentCarrierId));
+    msg.haveMobilityControlInfo = true;
+    msg.mobilityControlInfo.targetPhysCellId = componentCarrier->GetCellId();
+    msg.mobilityControlInfo.haveCarrierFreq = true;
+    msg.mobilityControlInfo.carrierFreq.dlCarrierFreq = componentCarrier->GetDlEarfcn();
+    msg.mobilityControlInfo.carrierFreq.ulCarrierFreq = componentCarrier->GetUlEarfcn();
+    msg.mobilityControlInfo.haveCarrierBandwidth = true;
+    msg.mobilityControlInfo.carrierBandwidth.dlBandwidth = componentCarrier->GetDlBandwidth();
+    msg.mobilityControlInfo.carrierBandwidth.ulBandwidth = componentCarrier->GetUlBandwidth();
+    msg.mobilityControlInfo.newUeIdentity = m_rnti;
+    msg.mobilityControlInfo.haveRachConfigDedicated = false;
+
+    LteEnbCmacSapProvider::RachConfig rc =
+        m_rrc->m_cmacSapProvider.at(m_componentCarrierId)->GetRachConfig();
+    msg.mobilityControlInfo.radioResourceConfigCommon.rachConfigCommon.preambleInfo
+        .numberOfRaPreambles = rc.numberOfRaPreambles;
+    msg.mobilityControlInfo.radioResourceConfigCommon.rachConfigCommon.raSupervisionInfo
+        .preambleTransMax = rc.preambleTransMax;
+    msg.mobilityControlInfo.radioResourceConfigCommon.rachConfigCommon.raSupervisionInfo
+        .raResponseWindowSize = rc.raResponseWindowSize;
+    msg.mobilityControlInfo.radioResourceConfigCommon.rachConfigCommon.txFailParam
+        .connEstFailCount = rc.connEstFailCount;
+
+    // the configuration is applied by the UE right away, hence no reconfiguration is pending
+    RecordDataRadioBearersToBeStarted();
+    StartDataRadioBearers();
+    m_pendingRrcConnectionReconfiguration = false;
+    m_pendingStartDataRadioBearers = false;
+    SwitchToState(CONNECTED_NORMALLY);
+    return msg;
+}
+
 void
 UeManager::SetupDataRadioBearer(EpsBearer bearer,
                                 uint8_t bearerId,
@@ -3241,6 +3291,22 @@ LteEnbRrc::DoSendLoadInformation(EpcX2Sap::LoadInformationParams params)
     m_x2SapProvider->SendLoadInformation(params);
 }
 
+uint16_t
+LteEnbRrc::AddPreAttachedUe(uint64_t imsi, uint8_t componentCarrierId)
+{
+    NS_LOG_FUNCTION(this << imsi << +componentCarrierId);
+    uint16_t rnti = AddUe(UeManager::ATTACH_REQUEST, componentCarrierId);
+    GetUeManager(rnti)->SetImsi(imsi);
+    return rnti;
+}
+
+LteRrcSap::RrcConnectionReconfiguration
+LteEnbRrc::ConnectPreAttachedUe(uint16_t rnti)
+{
+    NS_LOG_FUNCTION(this << rnti);
+    return GetUeManager(rnti)->PreAttach();
+}
+
 uint16_t
 LteEnbRrc::AddUe(UeManager::State state, uint8_t componentCarrierId)
 {
@@ -3523,24 +3589,7 @@ LteEnbRrc::SendSystemInformation()
 
     for (auto& it : m_componentCarrierPhyConf)
     {
-        uint8_t ccId = it.first;
-
-        LteRrcSap::SystemInformation si;
-        si.haveSib2 = true;
-        si.sib2.freqInfo.ulCarrierFreq = it.second->GetUlEarfcn();
-        si.sib2.freqInfo.ulBandwidth = it.second->GetUlBandwidth();
-        si.sib2.radioResourceConfigCommon.pdschConfigCommon.referenceSignalPower =
-            m_cphySapProvider.at(ccId)->GetReferenceSignalPower();
-        si.sib2.radioResourceConfigCommon.pdschConfigCommon.pb = 0;
-
-        LteEnbCmacSapProvider::RachConfig rc = m_cmacSapProvider.at(ccId)->GetRachConfig();
-        LteRrcSap::RachConfigCommon rachConfigCommon;
-        rachConfigCommon.preambleInfo.numberOfRaPreambles = rc.numberOfRaPreambles;
-        rachConfigCommon.raSupervisionInfo.preambleTransMax = rc.preambleTransMax;
-        rachConfigCommon.raSupervisionInfo.raResponseWindowSize = rc.raResponseWindowSize;
-        rachConfigCommon.txFailParam.connEstFailCount = rc.connEstFailCount;
-        si.sib2.radioResourceConfigCommon.rachConfigCommon = rachConfigCommon;
-
+        LteRrcSap::SystemInformation si = GetSystemInformation(it.first);
         m_rrcSapUser->SendSystemInformation(it.second->GetCellId(), si);
     }
 
@@ -3551,6 +3600,30 @@ LteEnbRrc::SendSystemInformation()
     Simulator::Schedule(m_systemInformationPeriodicity, &LteEnbRrc::SendSystemInformation, this);
 }
 
+LteRrcSap::SystemInformation
+LteEnbRrc::GetSystemInformation(uint8_t componentCarrierId)
+{
+    Ptr<ComponentCarrierBaseStation> componentCarrier =
+        m_componentCarrierPhyConf.at(componentCarrierId);
+    LteRrcSap::SystemInformation si;
+    si.haveSib2 = true;
+    si.sib2.freqInfo.ulCarrierFreq = componentCarrier->GetUlEarfcn();
+    si.sib2.freqInfo.ulBandwidth = componentCarrier->GetUlBandwidth();
+    si.sib2.radioResourceConfigCommon.pdschConfigCommon.referenceSignalPower =
+        m_cphySapProvider.at(componentCarrierId)->GetReferenceSignalPower();
+    si.sib2.radioResourceConfigCommon.pdschConfigCommon.pb = 0;
+
+    LteEnbCmacSapProvider::RachConfig rc =
+        m_cmacSapProvider.at(componentCarrierId)->GetRachConfig();
+    LteRrcSap::RachConfigCommon rachConfigCommon;
+    rachConfigCommon.preambleInfo.numberOfRaPreambles = rc.numberOfRaPreambles;
+    rachConfigCommon.raSupervisionInfo.preambleTransMax = rc.preambleTransMax;
+    rachConfigCommon.raSupervisionInfo.raResponseWindowSize = rc.raResponseWindowSize;
+    rachConfigCommon.txFailParam.connEstFailCount = rc.connEstFailCount;
+    si.sib2.radioResourceConfigCommon.rachConfigCommon = rachConfigCommon;
+    return si;
+}
+
 bool
 LteEnbRrc::IsRandomAccessCompleted(uint16_t rnti)
 {
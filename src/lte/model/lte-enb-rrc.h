@@ -142,6 +142,18 @@ class UeManager : public Object
      */
     void InitialContextSetupRequest();
 
+    /**
+     * Complete the connection of a UE added by LteEnbRrc::AddPreAttachedUe,
+     * as if the UE had completed the RRC connection establishment and the
+     * RRC connection reconfiguration which follows the attach procedure:
+     * fire the ConnectionEstablished trace, start the data radio bearers set
+     * up so far and switch to the CONNECTED_NORMALLY state.
+     *
+     * \return the RRC connection reconfiguration to be applied by the UE,
+     * with the mobility control information of the serving cell
+     */
+    LteRrcSap::RrcConnectionReconfiguration PreAttach();
+
     /**
      * Setup a new data radio bearer, including both the configuration
      * within the eNB and the necessary RRC signaling with the UE
@@ -894,6 +906,37 @@ class LteEnbRrc : public Object
      */
     Ptr<UeManager> GetUeManager(uint16_t rnti);
 
+    /**
+     * \brief Add a UE which is connected without the RRC connection
+     * establishment and, if the EPC is used, without the attach procedure
+     * (see LteHelper::PreAttach).
+     *
+     * The UeManager is created in the ATTACH_REQUEST state, i.e., as after the
+     * RRC connection establishment, so that the data radio bearers can be
+     * set up (e.g., by EpcHelper::PreAttachUe) before the connection is
+     * completed with ConnectPreAttachedUe.
+     *
+     * \param imsi the IMSI of the UE
+     * \param componentCarrierId the primary component carrier ID of the UE
+     * \return the RNTI allocated to the UE
+     */
+    uint16_t AddPreAttachedUe(uint64_t imsi, uint8_t componentCarrierId);
+
+    /**
+     * \brief Complete the connection of a UE added with AddPreAttachedUe.
+     *
+     * \param rnti the RNTI of the UE
+     * \return the RRC connection reconfiguration to be applied by the UE RRC
+     * (see LteUeRrc::PreAttach)
+     */
+    LteRrcSap::RrcConnectionReconfiguration ConnectPreAttachedUe(uint16_t rnti);
+
+    /**
+     * \param componentCarrierId the component carrier ID
+     * \return the System Information periodically broadcast on the component carrier
+     */
+    LteRrcSap::SystemInformation GetSystemInformation(uint8_t componentCarrierId);
+
     /**
      * \brief Add a new UE measurement reporting configuration
      * \param config the new reporting configuration
@@ -21,6 +21,7 @@
 
 #include "lte-chunk-processor.h"
 
+#include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/simulator.h>
 
@@ -29,6 +30,40 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("LteInterference");
 
+namespace
+{
+
+/**
+ * Add a PSD to a sum of PSDs, or subtract it, only over the range of RBs
+ * where the PSD is not null
+ *
+ * \param sum the sum of PSDs
+ * \param spd the PSD to add or to subtract
+ * \param sign 1 to add the PSD, -1 to subtract it
+ */
+void
+AccumulateActiveRbs(SpectrumValue& sum, const SpectrumValue& spd, double sign)
+{
+    NS_ASSERT(sum.GetValuesN() == spd.GetValuesN());
+    auto first = spd.ConstValuesBegin();
+    auto last = spd.ConstValuesEnd();
+    while (first != last && *first == 0.0)
+    {
+        ++first;
+    }
+    while (last != first && *(last - 1) == 0.0)
+    {
+        --last;
+    }
+    auto sumIt = sum.ValuesBegin() + (first - spd.ConstValuesBegin());
+    for (auto it = first; it != last; ++it, ++sumIt)
+    {
+        *sumIt += sign * (*it);
+    }
+}
+
+} // namespace
+
 LteInterference::LteInterference()
     : m_receiving(false),
       m_lastSignalId(0),
@@ -52,13 +87,30 @@ LteInterference::DoDispose()
     m_rxSignal = nullptr;
     m_allSignals = nullptr;
     m_noise = nullptr;
+    m_weakInterferers = nullptr;
+    m_weakInterferersEnergy = nullptr;
+    m_interf = nullptr;
+    m_sinr = nullptr;
     Object::DoDispose();
 }
 
 TypeId
 LteInterference::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LteInterference").SetParent<Object>().SetGroupName("Lte");
+    static TypeId tid =
+        TypeId("ns3::LteInterference")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddAttribute("InterfererPowerThreshold",
+                          "The received power (W) below which a signal which cannot be the "
+                          "signal being received is considered to be part of the noise floor: "
+                          "its power spectral density is added to the noise, averaged over each "
+                          "chunk, rather than starting a new chunk when the signal starts and "
+                          "ends. The default value of 0 evaluates a chunk between any two "
+                          "changes of the signals.",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&LteInterference::m_interfererPowerThreshold),
+                          MakeDoubleChecker<double>(0.0));
     return tid;
 }
 
@@ -72,6 +124,8 @@ LteInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
         m_rxSignal = rxPsd->Copy();
         m_lastChangeTime = Now();
         m_receiving = true;
+        (*m_weakInterferersEnergy) = 0.0;
+        m_lastWeakInterferersChangeTime = Now();
         for (std::list<Ptr<LteChunkProcessor>>::const_iterator it =
                  m_rsPowerChunkProcessorList.begin();
              it != m_rsPowerChunkProcessorList.end();
@@ -159,12 +213,37 @@ LteInterference::AddSignal(Ptr<const SpectrumValue> spd, const Time duration)
     Simulator::Schedule(duration, &LteInterference::DoSubtractSignal, this, spd, signalId);
 }
 
+void
+LteInterference::AddInterferer(Ptr<const SpectrumValue> spd, const Time duration)
+{
+    NS_LOG_FUNCTION(this << *spd << duration);
+    if (m_interfererPowerThreshold == 0 || Integral(*spd) >= m_interfererPowerThreshold)
+    {
+        AddSignal(spd, duration);
+        return;
+    }
+    NS_LOG_LOGIC("adding interferer below the power threshold to the noise");
+    IntegrateWeakInterferers();
+    AccumulateActiveRbs(*m_weakInterferers, *spd, 1.0);
+    uint32_t signalId = ++m_lastSignalId;
+    if (signalId == m_lastSignalIdBeforeReset)
+    {
+        // see AddSignal
+        m_lastSignalIdBeforeReset += 0x10000000;
+    }
+    Simulator::Schedule(duration,
+                        &LteInterference::DoSubtractWeakInterferer,
+                        this,
+                        spd,
+                        signalId);
+}
+
 void
 LteInterference::DoAddSignal(Ptr<const SpectrumValue> spd)
 {
     NS_LOG_FUNCTION(this << *spd);
     ConditionallyEvaluateChunk();
-    (*m_allSignals) += (*spd);
+    AccumulateActiveRbs(*m_allSignals, *spd, 1.0);
 }
 
 void
@@ -175,7 +254,23 @@ LteInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalI
     int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
     if (deltaSignalId > 0)
     {
-        (*m_allSignals) -= (*spd);
+        AccumulateActiveRbs(*m_allSignals, *spd, -1.0);
+    }
+    else
+    {
+        NS_LOG_INFO("ignoring signal scheduled for subtraction before last reset");
+    }
+}
+
+void
+LteInterference::DoSubtractWeakInterferer(Ptr<const SpectrumValue> spd, uint32_t signalId)
+{
+    NS_LOG_FUNCTION(this << *spd);
+    int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
+    if (deltaSignalId > 0)
+    {
+        IntegrateWeakInterferers();
+        AccumulateActiveRbs(*m_weakInterferers, *spd, -1.0);
     }
     else
     {
@@ -183,6 +278,23 @@ LteInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalI
     }
 }
 
+void
+LteInterference::IntegrateWeakInterferers()
+{
+    if (m_receiving)
+    {
+        double duration = (Now() - m_lastWeakInterferersChangeTime).GetSeconds();
+        auto weakIt = m_weakInterferers->ConstValuesBegin();
+        for (auto energyIt = m_weakInterferersEnergy->ValuesBegin();
+             energyIt != m_weakInterferersEnergy->ValuesEnd();
+             ++energyIt, ++weakIt)
+        {
+            *energyIt += *weakIt * duration;
+        }
+    }
+    m_lastWeakInterferersChangeTime = Now();
+}
+
 void
 LteInterference::ConditionallyEvaluateChunk()
 {
@@ -197,10 +309,25 @@ LteInterference::ConditionallyEvaluateChunk()
         NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
                           << " noise = " << *m_noise);
 
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
-
-        SpectrumValue sinr = (*m_rxSignal) / interf;
+        // compute the interference and the SINR in place, in a single pass; the
+        // interferers below the power threshold are averaged over the chunk
         Time duration = Now() - m_lastChangeTime;
+        IntegrateWeakInterferers();
+        double chunkSeconds = duration.GetSeconds();
+        auto allIt = m_allSignals->ConstValuesBegin();
+        auto rxIt = m_rxSignal->ConstValuesBegin();
+        auto noiseIt = m_noise->ConstValuesBegin();
+        auto weakIt = m_weakInterferersEnergy->ValuesBegin();
+        auto sinrIt = m_sinr->ValuesBegin();
+        for (auto interfIt = m_interf->ValuesBegin(); interfIt != m_interf->ValuesEnd();
+             ++interfIt, ++allIt, ++rxIt, ++noiseIt, ++weakIt, ++sinrIt)
+        {
+            *interfIt = *allIt - *rxIt + *noiseIt + *weakIt / chunkSeconds;
+            *sinrIt = *rxIt / *interfIt;
+            *weakIt = 0.0;
+        }
+        const SpectrumValue& interf = *m_interf;
+        const SpectrumValue& sinr = *m_sinr;
         for (std::list<Ptr<LteChunkProcessor>>::const_iterator it =
                  m_sinrChunkProcessorList.begin();
              it != m_sinrChunkProcessorList.end();
@@ -235,6 +362,10 @@ LteInterference::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
     // reset m_allSignals (will reset if already set previously)
     // this is needed since this method can potentially change the SpectrumModel
     m_allSignals = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_weakInterferers = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_weakInterferersEnergy = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_interf = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_sinr = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
     if (m_receiving == true)
     {
         // abort rx
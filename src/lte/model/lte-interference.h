@@ -101,6 +101,19 @@ class LteInterference : public Object
      */
     virtual void AddSignal(Ptr<const SpectrumValue> spd, const Time duration);
 
+    /**
+     * notify that a new signal, which cannot be the signal being RX
+     * (e.g., a signal from another cell), is being perceived in the
+     * medium. The signal is handled as by AddSignal, unless its power is
+     * below the InterfererPowerThreshold attribute, in which case it is
+     * considered to be part of the noise floor: it is added to the noise,
+     * averaged over each chunk, without starting a new chunk.
+     *
+     * @param spd the power spectral density of the new signal
+     * @param duration the duration of the new signal
+     */
+    virtual void AddInterferer(Ptr<const SpectrumValue> spd, const Time duration);
+
     /**
      *
      * @param noisePsd the Noise Power Spectral Density in power units
@@ -126,6 +139,18 @@ class LteInterference : public Object
      * @param signalId the signal ID
      */
     virtual void DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId);
+    /**
+     * Subtract an interferer below the power threshold from the noise
+     *
+     * @param spd the power spectral density of the interferer
+     * @param signalId the signal ID
+     */
+    void DoSubtractWeakInterferer(Ptr<const SpectrumValue> spd, uint32_t signalId);
+    /**
+     * Add the energy of the interferers below the power threshold since their
+     * last change to the energy of the current chunk
+     */
+    void IntegrateWeakInterferers();
 
     bool m_receiving{false}; ///< are we receiving?
 
@@ -142,6 +167,18 @@ class LteInterference : public Object
 
     Ptr<const SpectrumValue> m_noise{nullptr}; ///< the noise value
 
+    /// the sum of the power spectral densities of the interferers below the power threshold
+    Ptr<SpectrumValue> m_weakInterferers{nullptr};
+    /// the energy spectral density of these interferers during the current chunk
+    Ptr<SpectrumValue> m_weakInterferersEnergy{nullptr};
+    /// the time of the last change of these interferers
+    Time m_lastWeakInterferersChangeTime{Seconds(0)};
+
+    Ptr<SpectrumValue> m_interf{nullptr}; ///< the interference plus noise of the current chunk
+    Ptr<SpectrumValue> m_sinr{nullptr};   ///< the SINR of the current chunk
+
+    double m_interfererPowerThreshold{0}; ///< the power below which an interferer is noise
+
     Time m_lastChangeTime{Seconds(0)}; /**< the time of the last change in
                                         * m_TotalPower
                                         */
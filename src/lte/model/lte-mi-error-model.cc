@@ -903,6 +903,78 @@ static const double cEcrTable [9][38] = {
 
 // clang-format on
 
+/// MI map of a modulation order, whose SINR axis is uniformly spaced
+struct MiMap
+{
+    const double* mi;    ///< MI values
+    const double* axis;  ///< SINR values (linear units) of the MI values
+    uint16_t size;       ///< number of values
+    double scalingCoeff; ///< inverse of the spacing of the SINR axis
+};
+
+// since the values of the SINR axes are uniformly spaced, we have
+// index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
+// the scaling coefficient is always the same, so we compute it only once
+
+/// MI map of QPSK
+static const MiMap MiMapQpsk = {
+    MI_map_qpsk,
+    MI_map_qpsk_axis,
+    MI_MAP_QPSK_SIZE,
+    (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0])};
+
+/// MI map of 16QAM
+static const MiMap MiMap16qam = {
+    MI_map_16qam,
+    MI_map_16qam_axis,
+    MI_MAP_16QAM_SIZE,
+    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1] - MI_map_16qam_axis[0])};
+
+/// MI map of 64QAM
+static const MiMap MiMap64qam = {
+    MI_map_64qam,
+    MI_map_64qam_axis,
+    MI_MAP_64QAM_SIZE,
+    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1] - MI_map_64qam_axis[0])};
+
+/**
+ * \brief get the MI map of the modulation order of a MCS
+ * \param mcs the MCS
+ * \return the MI map
+ */
+static const MiMap&
+GetMiMap(uint8_t mcs)
+{
+    if (mcs <= MI_QPSK_MAX_ID)
+    {
+        return MiMapQpsk;
+    }
+    else if (mcs <= MI_16QAM_MAX_ID)
+    {
+        return MiMap16qam;
+    }
+    return MiMap64qam;
+}
+
+/**
+ * \brief map a SINR value to its MI
+ * \param miMap the MI map of the modulation order
+ * \param sinrLin the SINR in linear units
+ * \return the MI
+ */
+static inline double
+GetMi(const MiMap& miMap, double sinrLin)
+{
+    if (sinrLin > miMap.axis[miMap.size - 1])
+    {
+        return 1;
+    }
+    double sinrIndexDouble = (sinrLin - miMap.axis[0]) * miMap.scalingCoeff + 1;
+    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
+    NS_ASSERT_MSG(sinrIndex < miMap.size, "MI map out of data");
+    return miMap.mi[sinrIndex];
+}
+
 double
 LteMiErrorModel::Mib(const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
 {
@@ -910,79 +982,14 @@ LteMiErrorModel::Mib(const SpectrumValue& sinr, const std::vector<int>& map, uin
 
     double MI;
     double MIsum = 0.0;
+    // the modulation order is the same for all the RBs
+    const MiMap& miMap = GetMiMap(mcs);
 
     for (uint32_t i = 0; i < map.size(); i++)
     {
-        double sinrLin = sinr[map.at(i)];
-        if (mcs <= MI_QPSK_MAX_ID) // QPSK
-        {
-            if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1])
-            {
-                MI = 1;
-            }
-            else
-            {
-                // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-                // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                // the scaling coefficient is always the same, so we use a static const
-                // to speed up the calculation
-                static const double scalingCoeffQpsk =
-                    (MI_MAP_QPSK_SIZE - 1) /
-                    (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0]);
-                double sinrIndexDouble = (sinrLin - MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-                uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                NS_ASSERT_MSG(sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-                MI = MI_map_qpsk[sinrIndex];
-            }
-        }
-        else
-        {
-            if (mcs > MI_QPSK_MAX_ID && mcs <= MI_16QAM_MAX_ID) // 16-QAM
-            {
-                if (sinrLin > MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1])
-                {
-                    MI = 1;
-                }
-                else
-                {
-                    // since the values in MI_map_16QAM_axis are uniformly spaced, we have
-                    // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                    // the scaling coefficient is always the same, so we use a static const
-                    // to speed up the calculation
-                    static const double scalingCoeff16qam =
-                        (MI_MAP_16QAM_SIZE - 1) /
-                        (MI_map_16qam_axis[MI_MAP_16QAM_SIZE - 1] - MI_map_16qam_axis[0]);
-                    double sinrIndexDouble =
-                        (sinrLin - MI_map_16qam_axis[0]) * scalingCoeff16qam + 1;
-                    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                    NS_ASSERT_MSG(sinrIndex < MI_MAP_16QAM_SIZE, "MI map out of data");
-                    MI = MI_map_16qam[sinrIndex];
-                }
-            }
-            else // 64-QAM
-            {
-                if (sinrLin > MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1])
-                {
-                    MI = 1;
-                }
-                else
-                {
-                    // since the values in MI_map_64QAM_axis are uniformly spaced, we have
-                    // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                    // the scaling coefficient is always the same, so we use a static const
-                    // to speed up the calculation
-                    static const double scalingCoeff64qam =
-                        (MI_MAP_64QAM_SIZE - 1) /
-                        (MI_map_64qam_axis[MI_MAP_64QAM_SIZE - 1] - MI_map_64qam_axis[0]);
-                    double sinrIndexDouble =
-                        (sinrLin - MI_map_64qam_axis[0]) * scalingCoeff64qam + 1;
-                    uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-                    NS_ASSERT_MSG(sinrIndex < MI_MAP_64QAM_SIZE, "MI map out of data");
-                    MI = MI_map_64qam[sinrIndex];
-                }
-            }
-        }
-        NS_LOG_LOGIC(" RB " << map.at(i) << "Minimum SNR = " << 10 * std::log10(sinrLin) << " dB, "
+        double sinrLin = sinr[map[i]];
+        MI = GetMi(miMap, sinrLin);
+        NS_LOG_LOGIC(" RB " << map[i] << "Minimum SNR = " << 10 * std::log10(sinrLin) << " dB, "
                             << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
         MIsum += MI;
     }
@@ -1047,25 +1054,7 @@ LteMiErrorModel::GetPcfichPdcchError(const SpectrumValue& sinr)
     NS_ASSERT(sinrIt != sinr.ConstValuesEnd());
     while (sinrIt != sinr.ConstValuesEnd())
     {
-        double sinrLin = *sinrIt;
-        if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1])
-        {
-            MI = 1;
-        }
-        else
-        {
-            // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-            // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-            // the scaling coefficient is always the same, so we use a static const
-            // to speed up the calculation
-            static const double scalingCoeffQpsk =
-                (MI_MAP_QPSK_SIZE - 1) /
-                (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1] - MI_map_qpsk_axis[0]);
-            double sinrIndexDouble = (sinrLin - MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-            uint32_t sinrIndex = std::max(0.0, std::floor(sinrIndexDouble));
-            NS_ASSERT_MSG(sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-            MI = MI_map_qpsk[sinrIndex];
-        }
+        MI = GetMi(MiMapQpsk, *sinrIt);
         MIsum += MI;
         sinrIt++;
         rb++;
@@ -1130,11 +1119,21 @@ LteMiErrorModel::GetTbDecodificationStats(const SpectrumValue& sinr,
                                           const std::vector<int>& map,
                                           uint16_t size,
                                           uint8_t mcs,
-                                          HarqProcessInfoList_t miHistory)
+                                          const HarqProcessInfoList_t& miHistory)
 {
     NS_LOG_FUNCTION(sinr << &map << (uint32_t)size << (uint32_t)mcs);
 
-    double tbMi = Mib(sinr, map, mcs);
+    return GetTbDecodificationStats(Mib(sinr, map, mcs), size, mcs, miHistory);
+}
+
+TbStats_t
+LteMiErrorModel::GetTbDecodificationStats(double tbMi,
+                                          uint16_t size,
+                                          uint8_t mcs,
+                                          const HarqProcessInfoList_t& miHistory)
+{
+    NS_LOG_FUNCTION(tbMi << (uint32_t)size << (uint32_t)mcs);
+
     double MI = 0.0;
     double Reff = 0.0;
     NS_ASSERT(mcs < 29);
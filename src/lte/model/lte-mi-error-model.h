@@ -107,7 +107,25 @@ class LteMiErrorModel
                                               const std::vector<int>& map,
                                               uint16_t size,
                                               uint8_t mcs,
-                                              HarqProcessInfoList_t miHistory);
+                                              const HarqProcessInfoList_t& miHistory);
+
+    /**
+     * \brief run the error-model algorithm for a TB whose mmib is already known
+     *
+     * The mmib only depends on the modulation order of the MCS: this allows
+     * to evaluate several MCSs of the same modulation over the same RBs
+     * without mapping their SINR again.
+     *
+     * \param tbMi the mmib of the TB, as returned by Mib
+     * \param size the size in bytes of the TB
+     * \param mcs the MCS of the TB
+     * \param miHistory MI of past transmissions (in case of retx)
+     * \return the TB error rate and MI
+     */
+    static TbStats_t GetTbDecodificationStats(double tbMi,
+                                              uint16_t size,
+                                              uint8_t mcs,
+                                              const HarqProcessInfoList_t& miHistory);
 
     /**
      * \brief run the error-model algorithm for the specified PCFICH+PDCCH channels
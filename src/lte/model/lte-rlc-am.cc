@@ -484,7 +484,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     Ptr<Packet> firstSegment = m_txonBuffer.begin()->m_pdu->Copy();
     m_txonBufferSize -= m_txonBuffer.begin()->m_pdu->GetSize();
     NS_LOG_LOGIC("txBufferSize      = " << m_txonBufferSize);
-    m_txonBuffer.erase(m_txonBuffer.begin());
+    m_txonBuffer.pop_front();
 
     while (firstSegment && (firstSegment->GetSize() > 0) && (nextSegmentSize > 0))
     {
@@ -533,7 +533,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             {
                 firstSegment->AddPacketTag(oldTag);
 
-                m_txonBuffer.insert(m_txonBuffer.begin(), TxPdu(firstSegment, firstSegmentTime));
+                m_txonBuffer.emplace_front(firstSegment, firstSegmentTime);
                 m_txonBufferSize += m_txonBuffer.begin()->m_pdu->GetSize();
 
                 NS_LOG_LOGIC("    Txon buffer: Give back the remaining segment");
@@ -640,7 +640,7 @@ LteRlcAm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             firstSegment = m_txonBuffer.begin()->m_pdu->Copy();
             firstSegmentTime = m_txonBuffer.begin()->m_waitingSince;
             m_txonBufferSize -= m_txonBuffer.begin()->m_pdu->GetSize();
-            m_txonBuffer.erase(m_txonBuffer.begin());
+            m_txonBuffer.pop_front();
             NS_LOG_LOGIC("        txBufferSize = " << m_txonBufferSize);
         }
     }
@@ -1671,6 +1671,8 @@ LteRlcAm::DoReportBufferStatus()
         r.statusPduSize = 0;
     }
 
+    m_bufferSizeTrace(m_rnti, m_lcid, r.txQueueSize, r.retxQueueSize);
+
     if (r.txQueueSize != 0 || r.retxQueueSize != 0 || r.statusPduSize != 0)
     {
         NS_LOG_INFO("Send ReportBufferStatus: " << r.txQueueSize << ", " << r.txQueueHolDelay
@@ -24,6 +24,7 @@
 #include <ns3/lte-rlc-sequence-number.h>
 #include <ns3/lte-rlc.h>
 
+#include <deque>
 #include <map>
 #include <vector>
 
@@ -129,7 +130,7 @@ class LteRlcAm : public LteRlc
         Time m_waitingSince; ///< Layer arrival time
     };
 
-    std::vector<TxPdu> m_txonBuffer; ///< Transmission buffer
+    std::deque<TxPdu> m_txonBuffer; ///< Transmission buffer
 
     /// RetxPdu structure
     struct RetxPdu
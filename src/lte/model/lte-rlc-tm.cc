@@ -129,7 +129,7 @@ LteRlcTm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     }
 
     m_txBufferSize -= packet->GetSize();
-    m_txBuffer.erase(m_txBuffer.begin());
+    m_txBuffer.pop_front();
 
     m_txPdu(m_rnti, m_lcid, packet->GetSize());
 
@@ -194,6 +194,8 @@ LteRlcTm::DoReportBufferStatus()
     r.retxQueueHolDelay = 0;
     r.statusPduSize = 0;
 
+    m_bufferSizeTrace(m_rnti, m_lcid, r.txQueueSize, r.retxQueueSize);
+
     NS_LOG_LOGIC("Send ReportBufferStatus = " << r.txQueueSize << ", " << r.txQueueHolDelay);
     m_macSapProvider->ReportBufferStatus(r);
 }
@@ -60,7 +60,8 @@ LteRlcUm::GetTypeId()
             .SetGroupName("Lte")
             .AddConstructor<LteRlcUm>()
             .AddAttribute("MaxTxBufferSize",
-                          "Maximum Size of the Transmission Buffer (in Bytes)",
+                          "Maximum Size of the Transmission Buffer (in Bytes).  If zero is "
+                          "configured, the buffer is unlimited.",
                           UintegerValue(10 * 1024),
                           MakeUintegerAccessor(&LteRlcUm::m_maxTxBufferSize),
                           MakeUintegerChecker<uint32_t>())
@@ -91,7 +92,7 @@ LteRlcUm::DoTransmitPdcpPdu(Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this << m_rnti << (uint32_t)m_lcid << p->GetSize());
 
-    if (m_txBufferSize + p->GetSize() <= m_maxTxBufferSize)
+    if (m_txBufferSize + p->GetSize() <= m_maxTxBufferSize || (m_maxTxBufferSize == 0))
     {
         /** Store PDCP PDU */
         LteRlcSduStatusTag tag;
@@ -162,7 +163,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
     NS_LOG_LOGIC("Remove SDU from TxBuffer");
     m_txBufferSize -= firstSegment->GetSize();
     NS_LOG_LOGIC("txBufferSize      = " << m_txBufferSize);
-    m_txBuffer.erase(m_txBuffer.begin());
+    m_txBuffer.pop_front();
 
     while (firstSegment && (firstSegment->GetSize() > 0) && (nextSegmentSize > 0))
     {
@@ -211,7 +212,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             {
                 firstSegment->AddPacketTag(oldTag);
 
-                m_txBuffer.insert(m_txBuffer.begin(), TxPdu(firstSegment, firstSegmentTime));
+                m_txBuffer.emplace_front(firstSegment, firstSegmentTime);
                 m_txBufferSize += m_txBuffer.begin()->m_pdu->GetSize();
 
                 NS_LOG_LOGIC("    TX buffer: Give back the remaining segment");
@@ -317,7 +318,7 @@ LteRlcUm::DoNotifyTxOpportunity(LteMacSapUser::TxOpportunityParameters txOpParam
             firstSegment = m_txBuffer.begin()->m_pdu->Copy();
             firstSegmentTime = m_txBuffer.begin()->m_waitingSince;
             m_txBufferSize -= firstSegment->GetSize();
-            m_txBuffer.erase(m_txBuffer.begin());
+            m_txBuffer.pop_front();
             NS_LOG_LOGIC("        txBufferSize = " << m_txBufferSize);
         }
     }
@@ -1155,6 +1156,8 @@ LteRlcUm::DoReportBufferStatus()
     r.retxQueueHolDelay = 0;
     r.statusPduSize = 0;
 
+    m_bufferSizeTrace(m_rnti, m_lcid, r.txQueueSize, r.retxQueueSize);
+
     NS_LOG_LOGIC("Send ReportBufferStatus = " << r.txQueueSize << ", " << r.txQueueHolDelay);
     m_macSapProvider->ReportBufferStatus(r);
 }
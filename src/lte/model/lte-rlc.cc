@@ -118,7 +118,12 @@ LteRlc::GetTypeId()
                                             "Trace source indicating a packet "
                                             "has been dropped before transmission",
                                             MakeTraceSourceAccessor(&LteRlc::m_txDropTrace),
-                                            "ns3::Packet::TracedCallback");
+                                            "ns3::Packet::TracedCallback")
+                            .AddTraceSource("BufferSize",
+                                            "Size of the transmission and retransmission "
+                                            "buffers, when reported to the MAC.",
+                                            MakeTraceSourceAccessor(&LteRlc::m_bufferSizeTrace),
+                                            "ns3::LteRlc::BufferSizeTracedCallback");
     return tid;
 }
 
@@ -127,6 +127,22 @@ class LteRlc : public Object // SimpleRefCount<LteRlc>
                                           uint32_t bytes,
                                           uint64_t delay);
 
+    /**
+     * TracedCallback signature for the buffer size reports.
+     *
+     * \param [in] rnti C-RNTI of the sending RLC instance.
+     * \param [in] lcid The logical channel id corresponding to
+     *             the sending RLC instance.
+     * \param [in] txBytes The number of bytes waiting for a first transmission.
+     * \param [in] retxBytes The size of the retransmission queue reported to
+     *             the MAC: in RLC AM, the bytes to be retransmitted and those
+     *             transmitted and not yet acknowledged; zero in RLC UM and TM.
+     */
+    typedef void (*BufferSizeTracedCallback)(uint16_t rnti,
+                                             uint8_t lcid,
+                                             uint32_t txBytes,
+                                             uint32_t retxBytes);
+
     /// \todo MRE What is the sense to duplicate all the interfaces here???
     // NB to avoid the use of multiple inheritance
 
@@ -179,6 +195,11 @@ class LteRlc : public Object // SimpleRefCount<LteRlc>
      * transmission.
      */
     TracedCallback<Ptr<const Packet>> m_txDropTrace;
+    /**
+     * The trace source fired when the RLC reports the size of its
+     * buffers to the MAC.
+     */
+    TracedCallback<uint16_t, uint8_t, uint32_t, uint32_t> m_bufferSizeTrace;
 };
 
 /**
@@ -230,9 +230,16 @@ LteUeRrcProtocolIdeal::SetEnbRrcSapProvider()
         }
     }
     NS_ASSERT_MSG(found, " Unable to find eNB with CellId =" << cellId);
-    m_enbRrcSapProvider = enbDev->GetRrc()->GetLteEnbRrcSapProvider();
-    Ptr<LteEnbRrcProtocolIdeal> enbRrcProtocolIdeal =
-        enbDev->GetRrc()->GetObject<LteEnbRrcProtocolIdeal>();
+    SetEnbRrc(enbDev->GetRrc());
+}
+
+void
+LteUeRrcProtocolIdeal::SetEnbRrc(Ptr<LteEnbRrc> enbRrc)
+{
+    NS_LOG_FUNCTION(this << enbRrc);
+    m_rnti = m_rrc->GetRnti();
+    m_enbRrcSapProvider = enbRrc->GetLteEnbRrcSapProvider();
+    Ptr<LteEnbRrcProtocolIdeal> enbRrcProtocolIdeal = enbRrc->GetObject<LteEnbRrcProtocolIdeal>();
     enbRrcProtocolIdeal->SetUeRrcSapProvider(m_rnti, m_ueRrcSapProvider);
 }
 
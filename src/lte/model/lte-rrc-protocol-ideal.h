@@ -33,6 +33,7 @@ namespace ns3
 class LteUeRrcSapProvider;
 class LteUeRrcSapUser;
 class LteEnbRrcSapProvider;
+class LteEnbRrc;
 class LteUeRrc;
 
 /**
@@ -80,6 +81,15 @@ class LteUeRrcProtocolIdeal : public Object
      */
     void SetUeRrc(Ptr<LteUeRrc> rrc);
 
+    /**
+     * Set the eNB RRC peer, as done upon the transmission of the first RRC
+     * message to the eNB, for a UE connected without signaling (see
+     * LteHelper::PreAttach)
+     *
+     * \param enbRrc the RRC of the eNB the UE is connected to
+     */
+    void SetEnbRrc(Ptr<LteEnbRrc> enbRrc);
+
   private:
     // methods forwarded from LteUeRrcSapUser
     /**
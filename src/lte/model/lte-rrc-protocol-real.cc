@@ -25,12 +25,16 @@
 #include "lte-ue-net-device.h"
 #include "lte-ue-rrc.h"
 
+#include <ns3/boolean.h>
 #include <ns3/fatal-error.h>
 #include <ns3/log.h>
 #include <ns3/node-list.h>
 #include <ns3/node.h>
 #include <ns3/nstime.h>
 #include <ns3/simulator.h>
+#include <ns3/tag.h>
+
+#include <any>
 
 namespace ns3
 {
@@ -40,11 +44,210 @@ NS_LOG_COMPONENT_DEFINE("LteRrcProtocolReal");
 /// RRC real message delay
 const Time RRC_REAL_MSG_DELAY = MilliSeconds(0);
 
+/**
+ * \ingroup lte
+ *
+ * Tag added to the bytes of a packet carrying an RRC message whose decoding
+ * is skipped, holding the key of the message in the LteEnbRrcProtocolReal
+ * which stores it. Being a byte tag, it follows the bytes of the message
+ * through the segmentation and concatenation done by the RLC.
+ */
+class RrcMessageInTransitTag : public Tag
+{
+  public:
+    RrcMessageInTransitTag();
+    /**
+     * Constructor
+     *
+     * \param cellId the cell ID of the eNB storing the message
+     * \param key the key of the message
+     */
+    RrcMessageInTransitTag(uint16_t cellId, uint32_t key);
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(TagBuffer i) const override;
+    void Deserialize(TagBuffer i) override;
+    void Print(std::ostream& os) const override;
+
+    /**
+     * \return the cell ID of the eNB storing the message
+     */
+    uint16_t GetCellId() const;
+    /**
+     * \return the key of the message
+     */
+    uint32_t GetKey() const;
+
+  private:
+    uint16_t m_cellId; ///< the cell ID of the eNB storing the message
+    uint32_t m_key;    ///< the key of the message
+};
+
+NS_OBJECT_ENSURE_REGISTERED(RrcMessageInTransitTag);
+
+RrcMessageInTransitTag::RrcMessageInTransitTag()
+    : m_cellId(0),
+      m_key(0)
+{
+}
+
+RrcMessageInTransitTag::RrcMessageInTransitTag(uint16_t cellId, uint32_t key)
+    : m_cellId(cellId),
+      m_key(key)
+{
+}
+
+TypeId
+RrcMessageInTransitTag::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::RrcMessageInTransitTag")
+                            .SetParent<Tag>()
+                            .SetGroupName("Lte")
+                            .AddConstructor<RrcMessageInTransitTag>();
+    return tid;
+}
+
+TypeId
+RrcMessageInTransitTag::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+RrcMessageInTransitTag::GetSerializedSize() const
+{
+    return 6;
+}
+
+void
+RrcMessageInTransitTag::Serialize(TagBuffer i) const
+{
+    i.WriteU16(m_cellId);
+    i.WriteU32(m_key);
+}
+
+void
+RrcMessageInTransitTag::Deserialize(TagBuffer i)
+{
+    m_cellId = i.ReadU16();
+    m_key = i.ReadU32();
+}
+
+void
+RrcMessageInTransitTag::Print(std::ostream& os) const
+{
+    os << "cellId=" << m_cellId << " key=" << m_key;
+}
+
+uint16_t
+RrcMessageInTransitTag::GetCellId() const
+{
+    return m_cellId;
+}
+
+uint32_t
+RrcMessageInTransitTag::GetKey() const
+{
+    return m_key;
+}
+
+/**
+ * \return the RRC protocols of the eNBs, indexed by the ID of their cell
+ */
+static std::map<uint16_t, LteEnbRrcProtocolReal*>&
+GetEnbRrcProtocols()
+{
+    static std::map<uint16_t, LteEnbRrcProtocolReal*> enbRrcProtocols;
+    return enbRrcProtocols;
+}
+
+/**
+ * Find the RRC protocol of the eNB serving a cell.
+ *
+ * \param cellId the cell ID
+ * \return the RRC protocol of the eNB
+ */
+static Ptr<LteEnbRrcProtocolReal>
+FindEnbRrcProtocol(uint16_t cellId)
+{
+    auto& enbRrcProtocols = GetEnbRrcProtocols();
+    auto it = enbRrcProtocols.find(cellId);
+    NS_ABORT_MSG_IF(it == enbRrcProtocols.end(), "Unable to find eNB with CellId =" << cellId);
+    return it->second;
+}
+
+/**
+ * Create the packet carrying an RRC message.
+ *
+ * If the decoding is skipped, the message is stored by the RRC protocol of
+ * the eNB, and the packet has the size of the encoded message, its bytes
+ * being tagged with a RrcMessageInTransitTag.
+ *
+ * \tparam H \deduced the RRC header type of the message
+ * \tparam M \deduced the message type
+ * \param header the RRC header of the message
+ * \param msg the message
+ * \param store the RRC protocol of the eNB storing the message, or nullptr
+ *        if the decoding is not skipped
+ * \param rnti the RNTI of the UE the message relates to
+ * \return the packet
+ */
+template <class H, class M>
+static Ptr<Packet>
+CreateRrcPacket(H& header, const M& msg, LteEnbRrcProtocolReal* store, uint16_t rnti)
+{
+    header.SetMessage(msg);
+    if (store == nullptr)
+    {
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(header);
+        return packet;
+    }
+    Ptr<Packet> packet = Create<Packet>(header.GetSerializedSize());
+    packet->AddByteTag(
+        RrcMessageInTransitTag(store->GetCellId(), store->StoreMessageInTransit(rnti, msg)));
+    return packet;
+}
+
+/**
+ * Retrieve the RRC message carried by a packet created by CreateRrcPacket
+ * with the decoding skipped.
+ *
+ * \param p the packet
+ * \param [out] msg the message
+ * \param store the RRC protocol of the eNB which most likely stores the
+ *        message, or nullptr
+ * \return false if the packet carries an encoded message
+ */
+static bool
+GetRrcMessageInTransit(Ptr<const Packet> p, std::any& msg, Ptr<LteEnbRrcProtocolReal> store)
+{
+    RrcMessageInTransitTag tag;
+    if (!p->FindFirstMatchingByteTag(tag))
+    {
+        return false;
+    }
+    if (!store || store->GetCellId() != tag.GetCellId())
+    {
+        // e.g., handover preparation information sent by another eNB
+        store = FindEnbRrcProtocol(tag.GetCellId());
+    }
+    msg = store->RetrieveMessageInTransit(tag.GetKey());
+    return true;
+}
+
 NS_OBJECT_ENSURE_REGISTERED(LteUeRrcProtocolReal);
 
 LteUeRrcProtocolReal::LteUeRrcProtocolReal()
     : m_ueRrcSapProvider(nullptr),
-      m_enbRrcSapProvider(nullptr)
+      m_enbRrcSapProvider(nullptr),
+      m_skipDecoding(false)
 {
     m_ueRrcSapUser = new MemberLteUeRrcSapUser<LteUeRrcProtocolReal>(this);
     m_completeSetupParameters.srb0SapUser =
@@ -65,15 +268,24 @@ LteUeRrcProtocolReal::DoDispose()
     delete m_completeSetupParameters.srb0SapUser;
     delete m_completeSetupParameters.srb1SapUser;
     m_rrc = nullptr;
+    m_enbRrcProtocol = nullptr;
 }
 
 TypeId
 LteUeRrcProtocolReal::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LteUeRrcProtocolReal")
-                            .SetParent<Object>()
-                            .SetGroupName("Lte")
-                            .AddConstructor<LteUeRrcProtocolReal>();
+    static TypeId tid =
+        TypeId("ns3::LteUeRrcProtocolReal")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddConstructor<LteUeRrcProtocolReal>()
+            .AddAttribute("SkipDecoding",
+                          "If true, the RRC messages are transmitted in packets of the size of "
+                          "their encoding, but they are passed to the receiving RRC without "
+                          "being decoded.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteUeRrcProtocolReal::m_skipDecoding),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -113,12 +325,9 @@ LteUeRrcProtocolReal::DoSendRrcConnectionRequest(LteRrcSap::RrcConnectionRequest
     m_rnti = m_rrc->GetRnti();
     SetEnbRrcSapProvider();
 
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionRequestHeader rrcConnectionRequestHeader;
-    rrcConnectionRequestHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionRequestHeader);
+    Ptr<Packet> packet =
+        CreateRrcPacket(rrcConnectionRequestHeader, msg, GetMessageStore(), m_rrc->GetRnti());
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -132,12 +341,11 @@ void
 LteUeRrcProtocolReal::DoSendRrcConnectionSetupCompleted(
     LteRrcSap::RrcConnectionSetupCompleted msg) const
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionSetupCompleteHeader rrcConnectionSetupCompleteHeader;
-    rrcConnectionSetupCompleteHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionSetupCompleteHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionSetupCompleteHeader,
+                                         msg,
+                                         GetMessageStore(),
+                                         m_rrc->GetRnti());
 
     LtePdcpSapProvider::TransmitPdcpSduParameters transmitPdcpSduParameters;
     transmitPdcpSduParameters.pdcpSdu = packet;
@@ -159,12 +367,11 @@ LteUeRrcProtocolReal::DoSendRrcConnectionReconfigurationCompleted(
     m_rnti = m_rrc->GetRnti();
     SetEnbRrcSapProvider();
 
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReconfigurationCompleteHeader rrcConnectionReconfigurationCompleteHeader;
-    rrcConnectionReconfigurationCompleteHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReconfigurationCompleteHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionReconfigurationCompleteHeader,
+                                         msg,
+                                         GetMessageStore(),
+                                         m_rrc->GetRnti());
 
     LtePdcpSapProvider::TransmitPdcpSduParameters transmitPdcpSduParameters;
     transmitPdcpSduParameters.pdcpSdu = packet;
@@ -182,12 +389,9 @@ LteUeRrcProtocolReal::DoSendMeasurementReport(LteRrcSap::MeasurementReport msg)
     m_rnti = m_rrc->GetRnti();
     SetEnbRrcSapProvider();
 
-    Ptr<Packet> packet = Create<Packet>();
-
     MeasurementReportHeader measurementReportHeader;
-    measurementReportHeader.SetMessage(msg);
-
-    packet->AddHeader(measurementReportHeader);
+    Ptr<Packet> packet =
+        CreateRrcPacket(measurementReportHeader, msg, GetMessageStore(), m_rrc->GetRnti());
 
     LtePdcpSapProvider::TransmitPdcpSduParameters transmitPdcpSduParameters;
     transmitPdcpSduParameters.pdcpSdu = packet;
@@ -223,12 +427,11 @@ void
 LteUeRrcProtocolReal::DoSendRrcConnectionReestablishmentRequest(
     LteRrcSap::RrcConnectionReestablishmentRequest msg) const
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReestablishmentRequestHeader rrcConnectionReestablishmentRequestHeader;
-    rrcConnectionReestablishmentRequestHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReestablishmentRequestHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionReestablishmentRequestHeader,
+                                         msg,
+                                         GetMessageStore(),
+                                         m_rrc->GetRnti());
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -242,12 +445,11 @@ void
 LteUeRrcProtocolReal::DoSendRrcConnectionReestablishmentComplete(
     LteRrcSap::RrcConnectionReestablishmentComplete msg) const
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReestablishmentCompleteHeader rrcConnectionReestablishmentCompleteHeader;
-    rrcConnectionReestablishmentCompleteHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReestablishmentCompleteHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionReestablishmentCompleteHeader,
+                                         msg,
+                                         GetMessageStore(),
+                                         m_rrc->GetRnti());
 
     LtePdcpSapProvider::TransmitPdcpSduParameters transmitPdcpSduParameters;
     transmitPdcpSduParameters.pdcpSdu = packet;
@@ -292,15 +494,52 @@ LteUeRrcProtocolReal::SetEnbRrcSapProvider()
         }
     }
     NS_ASSERT_MSG(found, " Unable to find eNB with CellId =" << cellId);
-    m_enbRrcSapProvider = enbDev->GetRrc()->GetLteEnbRrcSapProvider();
-    Ptr<LteEnbRrcProtocolReal> enbRrcProtocolReal =
-        enbDev->GetRrc()->GetObject<LteEnbRrcProtocolReal>();
-    enbRrcProtocolReal->SetUeRrcSapProvider(m_rnti, m_ueRrcSapProvider);
+    SetEnbRrc(enbDev->GetRrc());
+}
+
+void
+LteUeRrcProtocolReal::SetEnbRrc(Ptr<LteEnbRrc> enbRrc)
+{
+    NS_LOG_FUNCTION(this << enbRrc);
+    m_rnti = m_rrc->GetRnti();
+    m_enbRrcSapProvider = enbRrc->GetLteEnbRrcSapProvider();
+    m_enbRrcProtocol = enbRrc->GetObject<LteEnbRrcProtocolReal>();
+    m_enbRrcProtocol->SetUeRrcSapProvider(m_rnti, m_ueRrcSapProvider);
+}
+
+LteEnbRrcProtocolReal*
+LteUeRrcProtocolReal::GetMessageStore() const
+{
+    if (!m_skipDecoding)
+    {
+        return nullptr;
+    }
+    NS_ASSERT_MSG(m_enbRrcProtocol, "the eNB of the UE is unknown");
+    return PeekPointer(m_enbRrcProtocol);
 }
 
 void
 LteUeRrcProtocolReal::DoReceivePdcpPdu(Ptr<Packet> p)
 {
+    std::any msgInTransit;
+    if (GetRrcMessageInTransit(p, msgInTransit, m_enbRrcProtocol))
+    {
+        if (auto msg = std::any_cast<LteRrcSap::RrcConnectionReestablishment>(&msgInTransit))
+        {
+            m_ueRrcSapProvider->RecvRrcConnectionReestablishment(*msg);
+        }
+        else if (auto msg = std::any_cast<LteRrcSap::RrcConnectionReject>(&msgInTransit))
+        {
+            m_ueRrcSapProvider->RecvRrcConnectionReject(*msg);
+        }
+        else if (auto msg = std::any_cast<LteRrcSap::RrcConnectionSetup>(&msgInTransit))
+        {
+            m_ueRrcSapProvider->RecvRrcConnectionSetup(*msg);
+        }
+        // RrcConnectionReestablishmentReject is not handled, as below
+        return;
+    }
+
     // Get type of message received
     RrcDlCcchMessage rrcDlCcchMessage;
     p->PeekHeader(rrcDlCcchMessage);
@@ -352,6 +591,17 @@ LteUeRrcProtocolReal::DoReceivePdcpPdu(Ptr<Packet> p)
 void
 LteUeRrcProtocolReal::DoReceivePdcpSdu(LtePdcpSapUser::ReceivePdcpSduParameters params)
 {
+    std::any msgInTransit;
+    if (GetRrcMessageInTransit(params.pdcpSdu, msgInTransit, m_enbRrcProtocol))
+    {
+        if (auto msg = std::any_cast<LteRrcSap::RrcConnectionReconfiguration>(&msgInTransit))
+        {
+            m_ueRrcSapProvider->RecvRrcConnectionReconfiguration(*msg);
+        }
+        // RrcConnectionRelease is not handled, as below
+        return;
+    }
+
     // Get type of message received
     RrcDlDcchMessage rrcDlDcchMessage;
     params.pdcpSdu->PeekHeader(rrcDlDcchMessage);
@@ -383,7 +633,10 @@ LteUeRrcProtocolReal::DoReceivePdcpSdu(LtePdcpSapUser::ReceivePdcpSduParameters
 NS_OBJECT_ENSURE_REGISTERED(LteEnbRrcProtocolReal);
 
 LteEnbRrcProtocolReal::LteEnbRrcProtocolReal()
-    : m_enbRrcSapProvider(nullptr)
+    : m_cellId(0),
+      m_enbRrcSapProvider(nullptr),
+      m_skipDecoding(false),
+      m_nextMessageKey(0)
 {
     NS_LOG_FUNCTION(this);
     m_enbRrcSapUser = new MemberLteEnbRrcSapUser<LteEnbRrcProtocolReal>(this);
@@ -408,15 +661,30 @@ LteEnbRrcProtocolReal::DoDispose()
         delete it->second.srb1SapUser;
     }
     m_completeSetupUeParametersMap.clear();
+    m_messagesInTransit.clear();
+    auto& enbRrcProtocols = GetEnbRrcProtocols();
+    auto it = enbRrcProtocols.find(m_cellId);
+    if (it != enbRrcProtocols.end() && it->second == this)
+    {
+        enbRrcProtocols.erase(it);
+    }
 }
 
 TypeId
 LteEnbRrcProtocolReal::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LteEnbRrcProtocolReal")
-                            .SetParent<Object>()
-                            .SetGroupName("Lte")
-                            .AddConstructor<LteEnbRrcProtocolReal>();
+    static TypeId tid =
+        TypeId("ns3::LteEnbRrcProtocolReal")
+            .SetParent<Object>()
+            .SetGroupName("Lte")
+            .AddConstructor<LteEnbRrcProtocolReal>()
+            .AddAttribute("SkipDecoding",
+                          "If true, the RRC messages are transmitted in packets of the size of "
+                          "their encoding, but they are passed to the receiving RRC without "
+                          "being decoded.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteEnbRrcProtocolReal::m_skipDecoding),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -435,7 +703,51 @@ LteEnbRrcProtocolReal::GetLteEnbRrcSapUser()
 void
 LteEnbRrcProtocolReal::SetCellId(uint16_t cellId)
 {
+    auto& enbRrcProtocols = GetEnbRrcProtocols();
+    auto it = enbRrcProtocols.find(m_cellId);
+    if (it != enbRrcProtocols.end() && it->second == this)
+    {
+        enbRrcProtocols.erase(it);
+    }
     m_cellId = cellId;
+    enbRrcProtocols[cellId] = this;
+}
+
+uint16_t
+LteEnbRrcProtocolReal::GetCellId() const
+{
+    return m_cellId;
+}
+
+uint32_t
+LteEnbRrcProtocolReal::StoreMessageInTransit(uint16_t rnti, std::any msg)
+{
+    uint32_t key = m_nextMessageKey++;
+    m_messagesInTransit[key] = {rnti, std::move(msg)};
+    return key;
+}
+
+std::any
+LteEnbRrcProtocolReal::RetrieveMessageInTransit(uint32_t key)
+{
+    auto it = m_messagesInTransit.find(key);
+    NS_ABORT_MSG_IF(it == m_messagesInTransit.end(),
+                    "no RRC message with key " << key << " in cell " << m_cellId);
+    std::any msg = std::move(it->second.msg);
+    m_messagesInTransit.erase(it);
+    return msg;
+}
+
+std::size_t
+LteEnbRrcProtocolReal::GetNMessagesInTransit() const
+{
+    return m_messagesInTransit.size();
+}
+
+LteEnbRrcProtocolReal*
+LteEnbRrcProtocolReal::GetMessageStore()
+{
+    return m_skipDecoding ? this : nullptr;
 }
 
 LteUeRrcSapProvider*
@@ -534,6 +846,18 @@ LteEnbRrcProtocolReal::DoRemoveUe(uint16_t rnti)
     m_completeSetupUeParametersMap.erase(it);
     m_enbRrcSapProviderMap.erase(rnti);
     m_setupUeParametersMap.erase(rnti);
+    // the messages still in transit to or from the UE will not be received
+    for (auto msgIt = m_messagesInTransit.begin(); msgIt != m_messagesInTransit.end();)
+    {
+        if (msgIt->second.rnti == rnti)
+        {
+            msgIt = m_messagesInTransit.erase(msgIt);
+        }
+        else
+        {
+            ++msgIt;
+        }
+    }
 }
 
 void
@@ -572,12 +896,8 @@ LteEnbRrcProtocolReal::DoSendSystemInformation(uint16_t cellId, LteRrcSap::Syste
 void
 LteEnbRrcProtocolReal::DoSendRrcConnectionSetup(uint16_t rnti, LteRrcSap::RrcConnectionSetup msg)
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionSetupHeader rrcConnectionSetupHeader;
-    rrcConnectionSetupHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionSetupHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionSetupHeader, msg, GetMessageStore(), rnti);
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -590,12 +910,8 @@ LteEnbRrcProtocolReal::DoSendRrcConnectionSetup(uint16_t rnti, LteRrcSap::RrcCon
 void
 LteEnbRrcProtocolReal::DoSendRrcConnectionReject(uint16_t rnti, LteRrcSap::RrcConnectionReject msg)
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionRejectHeader rrcConnectionRejectHeader;
-    rrcConnectionRejectHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionRejectHeader);
+    Ptr<Packet> packet = CreateRrcPacket(rrcConnectionRejectHeader, msg, GetMessageStore(), rnti);
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -610,12 +926,9 @@ LteEnbRrcProtocolReal::DoSendRrcConnectionReconfiguration(
     uint16_t rnti,
     LteRrcSap::RrcConnectionReconfiguration msg)
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReconfigurationHeader rrcConnectionReconfigurationHeader;
-    rrcConnectionReconfigurationHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReconfigurationHeader);
+    Ptr<Packet> packet =
+        CreateRrcPacket(rrcConnectionReconfigurationHeader, msg, GetMessageStore(), rnti);
 
     LtePdcpSapProvider::TransmitPdcpSduParameters transmitPdcpSduParameters;
     transmitPdcpSduParameters.pdcpSdu = packet;
@@ -630,12 +943,9 @@ LteEnbRrcProtocolReal::DoSendRrcConnectionReestablishment(
     uint16_t rnti,
     LteRrcSap::RrcConnectionReestablishment msg)
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReestablishmentHeader rrcConnectionReestablishmentHeader;
-    rrcConnectionReestablishmentHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReestablishmentHeader);
+    Ptr<Packet> packet =
+        CreateRrcPacket(rrcConnectionReestablishmentHeader, msg, GetMessageStore(), rnti);
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -650,12 +960,9 @@ LteEnbRrcProtocolReal::DoSendRrcConnectionReestablishmentReject(
     uint16_t rnti,
     LteRrcSap::RrcConnectionReestablishmentReject msg)
 {
-    Ptr<Packet> packet = Create<Packet>();
-
     RrcConnectionReestablishmentRejectHeader rrcConnectionReestablishmentRejectHeader;
-    rrcConnectionReestablishmentRejectHeader.SetMessage(msg);
-
-    packet->AddHeader(rrcConnectionReestablishmentRejectHeader);
+    Ptr<Packet> packet =
+        CreateRrcPacket(rrcConnectionReestablishmentRejectHeader, msg, GetMessageStore(), rnti);
 
     LteRlcSapProvider::TransmitPdcpPduParameters transmitPdcpPduParameters;
     transmitPdcpPduParameters.pdcpPdu = packet;
@@ -703,6 +1010,21 @@ LteEnbRrcProtocolReal::DoSendRrcConnectionRelease(uint16_t rnti,
 void
 LteEnbRrcProtocolReal::DoReceivePdcpPdu(uint16_t rnti, Ptr<Packet> p)
 {
+    std::any msgInTransit;
+    if (GetRrcMessageInTransit(p, msgInTransit, this))
+    {
+        if (auto msg =
+                std::any_cast<LteRrcSap::RrcConnectionReestablishmentRequest>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvRrcConnectionReestablishmentRequest(rnti, *msg);
+        }
+        else if (auto msg = std::any_cast<LteRrcSap::RrcConnectionRequest>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvRrcConnectionRequest(rnti, *msg);
+        }
+        return;
+    }
+
     // Get type of message received
     RrcUlCcchMessage rrcUlCcchMessage;
     p->PeekHeader(rrcUlCcchMessage);
@@ -735,6 +1057,30 @@ LteEnbRrcProtocolReal::DoReceivePdcpPdu(uint16_t rnti, Ptr<Packet> p)
 void
 LteEnbRrcProtocolReal::DoReceivePdcpSdu(LtePdcpSapUser::ReceivePdcpSduParameters params)
 {
+    std::any msgInTransit;
+    if (GetRrcMessageInTransit(params.pdcpSdu, msgInTransit, this))
+    {
+        if (auto msg = std::any_cast<LteRrcSap::MeasurementReport>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvMeasurementReport(params.rnti, *msg);
+        }
+        else if (auto msg =
+                     std::any_cast<LteRrcSap::RrcConnectionReconfigurationCompleted>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvRrcConnectionReconfigurationCompleted(params.rnti, *msg);
+        }
+        else if (auto msg =
+                     std::any_cast<LteRrcSap::RrcConnectionReestablishmentComplete>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvRrcConnectionReestablishmentComplete(params.rnti, *msg);
+        }
+        else if (auto msg = std::any_cast<LteRrcSap::RrcConnectionSetupCompleted>(&msgInTransit))
+        {
+            m_enbRrcSapProvider->RecvRrcConnectionSetupCompleted(params.rnti, *msg);
+        }
+        return;
+    }
+
     // Get type of message received
     RrcUlDcchMessage rrcUlDcchMessage;
     params.pdcpSdu->PeekHeader(rrcUlDcchMessage);
@@ -788,6 +1134,8 @@ Ptr<Packet>
 LteEnbRrcProtocolReal::DoEncodeHandoverPreparationInformation(
     LteRrcSap::HandoverPreparationInfo msg)
 {
+    // always encoded: the target eNB does not decode this message, so it
+    // would stay in the message store if the handover were rejected
     HandoverPreparationInfoHeader h;
     h.SetMessage(msg);
 
@@ -809,15 +1157,17 @@ Ptr<Packet>
 LteEnbRrcProtocolReal::DoEncodeHandoverCommand(LteRrcSap::RrcConnectionReconfiguration msg)
 {
     RrcConnectionReconfigurationHeader h;
-    h.SetMessage(msg);
-    Ptr<Packet> p = Create<Packet>();
-    p->AddHeader(h);
-    return p;
+    return CreateRrcPacket(h, msg, GetMessageStore(), msg.mobilityControlInfo.newUeIdentity);
 }
 
 LteRrcSap::RrcConnectionReconfiguration
 LteEnbRrcProtocolReal::DoDecodeHandoverCommand(Ptr<Packet> p)
 {
+    std::any msgInTransit;
+    if (GetRrcMessageInTransit(p, msgInTransit, this))
+    {
+        return std::any_cast<LteRrcSap::RrcConnectionReconfiguration>(msgInTransit);
+    }
     RrcConnectionReconfigurationHeader h;
     p->RemoveHeader(h);
     LteRrcSap::RrcConnectionReconfiguration msg = h.GetMessage();
@@ -28,6 +28,7 @@
 #include <ns3/object.h>
 #include <ns3/ptr.h>
 
+#include <any>
 #include <map>
 #include <stdint.h>
 
@@ -37,7 +38,9 @@ namespace ns3
 class LteUeRrcSapProvider;
 class LteUeRrcSapUser;
 class LteEnbRrcSapProvider;
+class LteEnbRrc;
 class LteUeRrc;
+class LteEnbRrcProtocolReal;
 
 /**
  * \ingroup lte
@@ -89,6 +92,15 @@ class LteUeRrcProtocolReal : public Object
      */
     void SetUeRrc(Ptr<LteUeRrc> rrc);
 
+    /**
+     * Set the eNB RRC peer, as done upon the transmission of the first RRC
+     * message to the eNB, for a UE connected without signaling (see
+     * LteHelper::PreAttach)
+     *
+     * \param enbRrc the RRC of the eNB the UE is connected to
+     */
+    void SetEnbRrc(Ptr<LteEnbRrc> enbRrc);
+
   private:
     // methods forwarded from LteUeRrcSapUser
     /**
@@ -149,6 +161,11 @@ class LteUeRrcProtocolReal : public Object
 
     /// Set ENB RRC SAP provider
     void SetEnbRrcSapProvider();
+    /**
+     * \return the RRC protocol of the eNB storing the messages sent by the
+     * UE, or nullptr if their decoding is not skipped
+     */
+    LteEnbRrcProtocolReal* GetMessageStore() const;
     /**
      * Receive PDCP PDU function
      *
@@ -162,15 +179,17 @@ class LteUeRrcProtocolReal : public Object
      */
     void DoReceivePdcpSdu(LtePdcpSapUser::ReceivePdcpSduParameters params);
 
-    Ptr<LteUeRrc> m_rrc;                       ///< the RRC
-    uint16_t m_rnti;                           ///< the RNTI
-    LteUeRrcSapProvider* m_ueRrcSapProvider;   ///< UE RRC SAP provider
-    LteUeRrcSapUser* m_ueRrcSapUser;           ///< UE RRC SAP user
-    LteEnbRrcSapProvider* m_enbRrcSapProvider; ///< ENB RRC SAP provider
+    Ptr<LteUeRrc> m_rrc;                         ///< the RRC
+    uint16_t m_rnti;                             ///< the RNTI
+    LteUeRrcSapProvider* m_ueRrcSapProvider;     ///< UE RRC SAP provider
+    LteUeRrcSapUser* m_ueRrcSapUser;             ///< UE RRC SAP user
+    LteEnbRrcSapProvider* m_enbRrcSapProvider;   ///< ENB RRC SAP provider
+    Ptr<LteEnbRrcProtocolReal> m_enbRrcProtocol; ///< RRC protocol of the eNB
 
     LteUeRrcSapUser::SetupParameters m_setupParameters; ///< setup parameters
     LteUeRrcSapProvider::CompleteSetupParameters
         m_completeSetupParameters; ///< complete setup parameters
+    bool m_skipDecoding;           ///< the SkipDecoding attribute
 };
 
 /**
@@ -222,6 +241,33 @@ class LteEnbRrcProtocolReal : public Object
      * \param cellId the cell ID
      */
     void SetCellId(uint16_t cellId);
+    /**
+     * Get cell ID function
+     *
+     * \returns the cell ID
+     */
+    uint16_t GetCellId() const;
+
+    /**
+     * Store an RRC message whose decoding is skipped, until it is received
+     *
+     * \param rnti the RNTI of the UE the message relates to
+     * \param msg the message
+     * \returns the key of the message
+     */
+    uint32_t StoreMessageInTransit(uint16_t rnti, std::any msg);
+    /**
+     * Remove a message stored by StoreMessageInTransit()
+     *
+     * \param key the key of the message
+     * \returns the message
+     */
+    std::any RetrieveMessageInTransit(uint32_t key);
+    /**
+     * \returns the number of stored messages whose decoding is skipped, which
+     * were not received yet
+     */
+    std::size_t GetNMessagesInTransit() const;
 
     /**
      * Get UE RRC SAP provider function
@@ -355,6 +401,11 @@ class LteEnbRrcProtocolReal : public Object
      * \param p the packet
      */
     void DoReceivePdcpPdu(uint16_t rnti, Ptr<Packet> p);
+    /**
+     * \return this object if the decoding of the messages is skipped, nullptr
+     * otherwise
+     */
+    LteEnbRrcProtocolReal* GetMessageStore();
 
     uint16_t m_rnti;                                                 ///< the RNTI
     uint16_t m_cellId;                                               ///< the cell ID
@@ -365,6 +416,18 @@ class LteEnbRrcProtocolReal : public Object
         m_setupUeParametersMap; ///< setup UE parameters map
     std::map<uint16_t, LteEnbRrcSapProvider::CompleteSetupUeParameters>
         m_completeSetupUeParametersMap; ///< complete setup UE parameters map
+    bool m_skipDecoding;                ///< the SkipDecoding attribute
+
+    /// RRC message whose decoding is skipped
+    struct MessageInTransit
+    {
+        uint16_t rnti; ///< the RNTI of the UE the message relates to
+        std::any msg;  ///< the message
+    };
+
+    /// messages sent to or by the UEs of the cell whose decoding is skipped, indexed by key
+    std::map<uint32_t, MessageInTransit> m_messagesInTransit;
+    uint32_t m_nextMessageKey; ///< key of the next message whose decoding is skipped
 };
 
 /// RealProtocolRlcSapUser class
@@ -632,26 +632,49 @@ LteSpectrumPhy::StartRx(Ptr<SpectrumSignalParameters> spectrumRxParams)
         DynamicCast<LteSpectrumSignalParametersDlCtrlFrame>(spectrumRxParams);
     Ptr<LteSpectrumSignalParametersUlSrsFrame> lteUlSrsRxParams =
         DynamicCast<LteSpectrumSignalParametersUlSrsFrame>(spectrumRxParams);
+    // only the signals of the cell we are synchronized with can be received,
+    // the signals of the other cells are interferers
     if (lteDataRxParams)
     {
-        m_interferenceData->AddSignal(rxPsd, duration);
+        if (lteDataRxParams->cellId == m_cellId)
+        {
+            m_interferenceData->AddSignal(rxPsd, duration);
+        }
+        else
+        {
+            m_interferenceData->AddInterferer(rxPsd, duration);
+        }
         StartRxData(lteDataRxParams);
     }
     else if (lteDlCtrlRxParams)
     {
-        m_interferenceCtrl->AddSignal(rxPsd, duration);
+        if (lteDlCtrlRxParams->cellId == m_cellId)
+        {
+            m_interferenceCtrl->AddSignal(rxPsd, duration);
+        }
+        else
+        {
+            m_interferenceCtrl->AddInterferer(rxPsd, duration);
+        }
         StartRxDlCtrl(lteDlCtrlRxParams);
     }
     else if (lteUlSrsRxParams)
     {
-        m_interferenceCtrl->AddSignal(rxPsd, duration);
+        if (lteUlSrsRxParams->cellId == m_cellId)
+        {
+            m_interferenceCtrl->AddSignal(rxPsd, duration);
+        }
+        else
+        {
+            m_interferenceCtrl->AddInterferer(rxPsd, duration);
+        }
         StartRxUlSrs(lteUlSrsRxParams);
     }
     else
     {
         // other type of signal (could be 3G, GSM, whatever) -> interference
-        m_interferenceData->AddSignal(rxPsd, duration);
-        m_interferenceCtrl->AddSignal(rxPsd, duration);
+        m_interferenceData->AddInterferer(rxPsd, duration);
+        m_interferenceCtrl->AddInterferer(rxPsd, duration);
     }
 }
 
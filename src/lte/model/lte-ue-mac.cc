@@ -188,6 +188,7 @@ class UeMemberLteUePhySapUser : public LteUePhySapUser
     void ReceivePhyPdu(Ptr<Packet> p) override;
     void SubframeIndication(uint32_t frameNo, uint32_t subframeNo) override;
     void ReceiveLteControlMessage(Ptr<LteControlMessage> msg) override;
+    bool NeedsSubframeIndication() override;
 
   private:
     LteUeMac* m_mac; ///< the UE MAC
@@ -216,6 +217,12 @@ UeMemberLteUePhySapUser::ReceiveLteControlMessage(Ptr<LteControlMessage> msg)
     m_mac->DoReceiveLteControlMessage(msg);
 }
 
+bool
+UeMemberLteUePhySapUser::NeedsSubframeIndication()
+{
+    return m_mac->DoNeedsSubframeIndication();
+}
+
 //////////////////////////////////////////////////////////
 // LteUeMac methods
 ///////////////////////////////////////////////////////////
@@ -245,6 +252,8 @@ LteUeMac::LteUeMac()
       m_rnti(0),
       m_imsi(0),
       m_rachConfigured(false),
+      m_frameNo(0),
+      m_subframeNo(0),
       m_waitingForRaResponse(false)
 
 {
@@ -348,6 +357,8 @@ LteUeMac::DoReportBufferStatus(LteMacSapProvider::ReportBufferStatusParameters p
             std::pair<uint8_t, LteMacSapProvider::ReportBufferStatusParameters>(params.lcid,
                                                                                 params));
     }
+    // the PHY might have suspended the subframe indications if we were idle
+    m_uePhySapProvider->ResumeSubframeIndication();
     m_freshUlBsr = true;
 }
 
@@ -425,6 +436,7 @@ LteUeMac::SendRaPreamble(bool contention)
     // bypass the m_ulConfigured flag. This is reasonable, since In fact
     // the RACH preamble is sent on 6RB bandwidth so the uplink
     // bandwidth does not need to be configured.
+    m_uePhySapProvider->ResumeSubframeIndication(); // for an up to date m_subframeNo
     NS_ASSERT(m_subframeNo > 0); // sanity check for subframe starting at 1
     m_raRnti = m_subframeNo - 1;
     m_uePhySapProvider->SendRachPreamble(m_raPreambleId, m_raRnti);
@@ -891,13 +903,13 @@ LteUeMac::DoReceiveLteControlMessage(Ptr<LteControlMessage> msg)
 }
 
 void
-LteUeMac::RefreshHarqProcessesPacketBuffer()
+LteUeMac::RefreshHarqProcessesPacketBuffer(uint32_t subframes)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << subframes);
 
     for (std::size_t i = 0; i < m_miUlHarqProcessesPacketTimer.size(); i++)
     {
-        if (m_miUlHarqProcessesPacketTimer.at(i) == 0)
+        if (m_miUlHarqProcessesPacketTimer.at(i) < subframes)
         {
             if (m_miUlHarqProcessesPacket.at(i)->GetSize() > 0)
             {
@@ -906,10 +918,11 @@ LteUeMac::RefreshHarqProcessesPacketBuffer()
                 Ptr<PacketBurst> emptyPb = CreateObject<PacketBurst>();
                 m_miUlHarqProcessesPacket.at(i) = emptyPb;
             }
+            m_miUlHarqProcessesPacketTimer.at(i) = 0;
         }
         else
         {
-            m_miUlHarqProcessesPacketTimer.at(i)--;
+            m_miUlHarqProcessesPacketTimer.at(i) -= subframes;
         }
     }
 }
@@ -918,9 +931,16 @@ void
 LteUeMac::DoSubframeIndication(uint32_t frameNo, uint32_t subframeNo)
 {
     NS_LOG_FUNCTION(this);
+    // more than one subframe elapsed if the PHY suspended the subframe
+    // indications while the UE was idle
+    uint32_t subframes = 1;
+    if (m_frameNo > 0)
+    {
+        subframes = (frameNo - m_frameNo) * 10 + subframeNo - m_subframeNo;
+    }
     m_frameNo = frameNo;
     m_subframeNo = subframeNo;
-    RefreshHarqProcessesPacketBuffer();
+    RefreshHarqProcessesPacketBuffer(subframes);
     if ((Simulator::Now() >= m_bsrLast + m_bsrPeriodicity) && (m_freshUlBsr == true))
     {
         if (m_componentCarrierId == 0)
@@ -931,7 +951,13 @@ LteUeMac::DoSubframeIndication(uint32_t frameNo, uint32_t subframeNo)
         m_bsrLast = Simulator::Now();
         m_freshUlBsr = false;
     }
-    m_harqProcessId = (m_harqProcessId + 1) % HARQ_PERIOD;
+    m_harqProcessId = (m_harqProcessId + subframes) % HARQ_PERIOD;
+}
+
+bool
+LteUeMac::DoNeedsSubframeIndication() const
+{
+    return m_freshUlBsr;
 }
 
 int64_t
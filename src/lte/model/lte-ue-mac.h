@@ -212,6 +212,12 @@ class LteUeMac : public Object
      * \param msg the LTE control message
      */
     void DoReceiveLteControlMessage(Ptr<LteControlMessage> msg);
+    /**
+     * Check whether the MAC has some work pending for the next subframe
+     *
+     * \return true if a BSR has to be sent
+     */
+    bool DoNeedsSubframeIndication() const;
 
     // internal methods
     /// Randomly select and send RA preamble function
@@ -238,8 +244,12 @@ class LteUeMac : public Object
     void RaResponseTimeout(bool contention);
     /// Send report buffer status
     void SendReportBufferStatus();
-    /// Refresh HARQ processes packet buffer function
-    void RefreshHarqProcessesPacketBuffer();
+    /**
+     * Refresh HARQ processes packet buffer function
+     *
+     * \param subframes number of subframes elapsed since the last refresh
+     */
+    void RefreshHarqProcessesPacketBuffer(uint32_t subframes);
 
     /// component carrier Id --> used to address sap
     uint8_t m_componentCarrierId;
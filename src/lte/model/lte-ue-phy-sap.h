@@ -65,6 +65,15 @@ class LteUePhySapProvider
      * establishment.
      */
     virtual void NotifyConnectionSuccessful() = 0;
+
+    /**
+     * \brief Notify the PHY that the MAC needs the subframe indications
+     *
+     * If the PHY suspended the subframe indications because the UE was
+     * idle, the indication of the current subframe is delivered to the MAC
+     * (if not done yet) before this function returns.
+     */
+    virtual void ResumeSubframeIndication() = 0;
 };
 
 /**
@@ -102,6 +111,14 @@ class LteUePhySapUser
      * \param msg the Ideal Control Message to receive
      */
     virtual void ReceiveLteControlMessage(Ptr<LteControlMessage> msg) = 0;
+
+    /**
+     * \brief Ask the MAC whether it has some work pending for the next subframe
+     *
+     * \return true if the MAC needs the indication of the next subframe
+     *         (e.g., to send a BSR)
+     */
+    virtual bool NeedsSubframeIndication() = 0;
 };
 
 } // namespace ns3
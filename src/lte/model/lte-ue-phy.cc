@@ -87,6 +87,7 @@ class UeMemberLteUePhySapProvider : public LteUePhySapProvider
     void SendLteControlMessage(Ptr<LteControlMessage> msg) override;
     void SendRachPreamble(uint32_t prachId, uint32_t raRnti) override;
     void NotifyConnectionSuccessful() override;
+    void ResumeSubframeIndication() override;
 
   private:
     LteUePhy* m_phy; ///< the Phy
@@ -121,6 +122,12 @@ UeMemberLteUePhySapProvider::NotifyConnectionSuccessful()
     m_phy->DoNotifyConnectionSuccessful();
 }
 
+void
+UeMemberLteUePhySapProvider::ResumeSubframeIndication()
+{
+    m_phy->DoResumeSubframeIndication();
+}
+
 ////////////////////////////////////////
 // LteUePhy methods
 ////////////////////////////////////////
@@ -162,6 +169,9 @@ LteUePhy::LteUePhy(Ptr<LteSpectrumPhy> dlPhy, Ptr<LteSpectrumPhy> ulPhy)
       m_ueMeasurementsFilterPeriod(MilliSeconds(200)),
       m_ueMeasurementsFilterLast(MilliSeconds(0)),
       m_rsrpSinrSampleCounter(0),
+      m_subframesSuspended(false),
+      m_nextFrameNo(0),
+      m_nextSubframeNo(0),
       m_imsi(0)
 {
     m_amc = CreateObject<LteAmc>();
@@ -346,6 +356,16 @@ LteUePhy::GetTypeId()
                           "If true, RLF detection will be enabled.",
                           BooleanValue(true),
                           MakeBooleanAccessor(&LteUePhy::m_enableRlfDetection),
+                          MakeBooleanChecker())
+            .AddAttribute("EnableIdleSubframeSkipping",
+                          "If true, the subframe indications are suspended while the UE has "
+                          "nothing to transmit, and resumed upon DL/UL grants, DL data, "
+                          "control messages, RACH, new data in the RLC buffers and SRS "
+                          "occasions. CQI and UE measurements are not affected, but the "
+                          "ReportPowerSpectralDensity trace is not fired in the skipped "
+                          "subframes.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteUePhy::m_enableIdleSubframeSkipping),
                           MakeBooleanChecker());
     return tid;
 }
@@ -489,12 +509,14 @@ LteUePhy::DoSendMacPdu(Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this);
 
+    DoResumeSubframeIndication();
     SetMacPdu(p);
 }
 
 void
 LteUePhy::PhyPduReceived(Ptr<Packet> p)
 {
+    DoResumeSubframeIndication();
     m_uePhySapUser->ReceivePhyPdu(p);
 }
 
@@ -561,6 +583,7 @@ LteUePhy::GenerateCtrlCqiReport(const SpectrumValue& sinr)
     {
         return;
     }
+    UpdateSuspendedSubframe();
     m_ctrlSinrForRlf = sinr;
     GenerateCqiRsrpRsrq(sinr);
 }
@@ -749,6 +772,7 @@ LteUePhy::GenerateMixedCqiReport(const SpectrumValue& sinr)
     }
 
     NS_ASSERT(m_state != CELL_SEARCH);
+    UpdateSuspendedSubframe();
     // NOTE: The SINR received by this method is
     // based on CTRL, which is not used to compute
     // PDSCH (i.e., data) based SINR. It is used
@@ -799,6 +823,7 @@ void
 LteUePhy::ReportInterference(const SpectrumValue& interf)
 {
     NS_LOG_FUNCTION(this << interf);
+    UpdateSuspendedSubframe();
     m_rsInterferencePowerUpdated = true;
     m_rsInterferencePower = interf;
 }
@@ -816,6 +841,7 @@ void
 LteUePhy::ReportRsReceivedPower(const SpectrumValue& power)
 {
     NS_LOG_FUNCTION(this << power);
+    UpdateSuspendedSubframe();
     m_rsReceivedPowerUpdated = true;
     m_rsReceivedPower = power;
 
@@ -996,6 +1022,7 @@ LteUePhy::DoSendLteControlMessage(Ptr<LteControlMessage> msg)
 {
     NS_LOG_FUNCTION(this << msg);
 
+    DoResumeSubframeIndication();
     SetControlMessages(msg);
 }
 
@@ -1005,6 +1032,7 @@ LteUePhy::DoSendRachPreamble(uint32_t raPreambleId, uint32_t raRnti)
     NS_LOG_FUNCTION(this << raPreambleId);
 
     // unlike other control messages, RACH preamble is sent ASAP
+    DoResumeSubframeIndication();
     Ptr<RachPreambleLteControlMessage> msg = Create<RachPreambleLteControlMessage>();
     msg->SetRapId(raPreambleId);
     m_raPreambleId = raPreambleId;
@@ -1132,6 +1160,7 @@ LteUePhy::ReceiveLteControlMessageList(std::list<Ptr<LteControlMessage>> msgList
             params.m_ccId = m_componentCarrierId;
             m_ulPhyTransmission(params);
             // pass the info to the MAC
+            DoResumeSubframeIndication();
             m_uePhySapUser->ReceiveLteControlMessage(msg);
         }
         else if (msg->GetMessageType() == LteControlMessage::RAR)
@@ -1162,6 +1191,7 @@ LteUePhy::ReceiveLteControlMessageList(std::list<Ptr<LteControlMessage>> msgList
 
                         QueueSubChannelsForTransmission(ulRb);
                         // pass the info to the MAC
+                        DoResumeSubframeIndication();
                         m_uePhySapUser->ReceiveLteControlMessage(msg);
                         // reset RACH variables with out of range values
                         m_raPreambleId = 255;
@@ -1187,6 +1217,7 @@ LteUePhy::ReceiveLteControlMessageList(std::list<Ptr<LteControlMessage>> msgList
         else
         {
             // pass the message to UE-MAC
+            DoResumeSubframeIndication();
             m_uePhySapUser->ReceiveLteControlMessage(msg);
         }
     }
@@ -1197,6 +1228,7 @@ LteUePhy::ReceivePss(uint16_t cellId, Ptr<SpectrumValue> p)
 {
     NS_LOG_FUNCTION(this << cellId << (*p));
 
+    UpdateSuspendedSubframe();
     double sum = 0.0;
     uint16_t nRB = 0;
     Values::const_iterator itPi;
@@ -1249,6 +1281,7 @@ LteUePhy::ReceivePss(uint16_t cellId, Ptr<SpectrumValue> p)
 void
 LteUePhy::QueueSubChannelsForTransmission(std::vector<int> rbMap)
 {
+    DoResumeSubframeIndication();
     m_subChannelsForTransmissionQueue.at(m_macChTtiDelay - 1) = rbMap;
 }
 
@@ -1259,6 +1292,9 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
 
     NS_ASSERT_MSG(frameNo > 0, "the SRS index check code assumes that frameNo starts at 1");
 
+    // woken up by m_subframeWakeEvent
+    m_subframesSuspended = false;
+
     // refresh internal variables
     m_rsReceivedPowerUpdated = false;
     m_rsInterferencePowerUpdated = false;
@@ -1331,6 +1367,7 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
 
     // trigger the MAC
     m_uePhySapUser->SubframeIndication(frameNo, subframeNo);
+    m_lastMacSubframeStart = Simulator::Now();
 
     m_subframeNo = subframeNo;
     ++subframeNo;
@@ -1340,6 +1377,12 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
         subframeNo = 1;
     }
 
+    if (m_enableIdleSubframeSkipping && IsIdle())
+    {
+        SuspendSubframeIndication(frameNo, subframeNo);
+        return;
+    }
+
     // schedule next subframe indication
     Simulator::Schedule(Seconds(GetTti()),
                         &LteUePhy::SubframeIndication,
@@ -1348,6 +1391,118 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
                         subframeNo);
 }
 
+bool
+LteUePhy::IsIdle() const
+{
+    for (const auto& pb : m_packetBurstQueue)
+    {
+        if (pb->GetNPackets() > 0)
+        {
+            return false;
+        }
+    }
+    for (const auto& ctrlMsg : m_controlMessagesQueue)
+    {
+        if (!ctrlMsg.empty())
+        {
+            return false;
+        }
+    }
+    for (const auto& rbMap : m_subChannelsForTransmissionQueue)
+    {
+        if (!rbMap.empty())
+        {
+            return false;
+        }
+    }
+    return !m_uePhySapUser->NeedsSubframeIndication();
+}
+
+void
+LteUePhy::SuspendSubframeIndication(uint32_t frameNo, uint32_t subframeNo)
+{
+    NS_LOG_FUNCTION(this << frameNo << subframeNo);
+
+    m_subframesSuspended = true;
+    m_nextFrameNo = frameNo;
+    m_nextSubframeNo = subframeNo;
+    m_nextSubframeStart = Simulator::Now() + Seconds(GetTti());
+
+    if (m_ulConfigured && m_srsConfigured)
+    {
+        // wake up at the next subframe satisfying the SRS index check
+        // done in SubframeIndication ()
+        uint32_t index = (frameNo - 1) * 10 + (subframeNo - 1);
+        uint32_t wait =
+            (m_srsSubframeOffset + m_srsPeriodicity - index % m_srsPeriodicity) % m_srsPeriodicity;
+        index += wait;
+        m_subframeWakeEvent = Simulator::Schedule(Seconds(GetTti()) * (wait + 1),
+                                                  &LteUePhy::SubframeIndication,
+                                                  this,
+                                                  index / 10 + 1,
+                                                  index % 10 + 1);
+    }
+}
+
+void
+LteUePhy::UpdateSuspendedSubframe()
+{
+    if (!m_subframesSuspended || Simulator::Now() < m_nextSubframeStart)
+    {
+        return;
+    }
+    while (Simulator::Now() >= m_nextSubframeStart)
+    {
+        m_nextSubframeStart += Seconds(GetTti());
+        ++m_nextSubframeNo;
+        if (m_nextSubframeNo > 10)
+        {
+            ++m_nextFrameNo;
+            m_nextSubframeNo = 1;
+        }
+    }
+    // refresh internal variables, as done by SubframeIndication ()
+    m_rsReceivedPowerUpdated = false;
+    m_rsInterferencePowerUpdated = false;
+    m_pssReceived = false;
+}
+
+void
+LteUePhy::DoResumeSubframeIndication()
+{
+    if (!m_subframesSuspended)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+
+    UpdateSuspendedSubframe();
+    m_subframesSuspended = false;
+    m_subframeWakeEvent.Cancel();
+
+    // notify the MAC of the current subframe, if it started while suspended
+    Time currentSubframeStart = m_nextSubframeStart - Seconds(GetTti());
+    if (currentSubframeStart > m_lastMacSubframeStart)
+    {
+        uint32_t frameNo = m_nextFrameNo;
+        uint32_t subframeNo = m_nextSubframeNo - 1;
+        if (subframeNo == 0)
+        {
+            --frameNo;
+            subframeNo = 10;
+        }
+        m_uePhySapUser->SubframeIndication(frameNo, subframeNo);
+        m_lastMacSubframeStart = currentSubframeStart;
+        m_subframeNo = subframeNo;
+    }
+
+    Simulator::Schedule(m_nextSubframeStart - Simulator::Now(),
+                        &LteUePhy::SubframeIndication,
+                        this,
+                        m_nextFrameNo,
+                        m_nextSubframeNo);
+}
+
 void
 LteUePhy::SendSrs()
 {
@@ -1509,6 +1664,8 @@ LteUePhy::DoConfigureUplink(uint32_t ulEarfcn, uint16_t ulBandwidth)
     m_ulEarfcn = ulEarfcn;
     m_ulBandwidth = ulBandwidth;
     m_ulConfigured = true;
+    // the SRS wake up of suspended subframe indications depends on it
+    DoResumeSubframeIndication();
 }
 
 void
@@ -1549,6 +1706,8 @@ LteUePhy::DoSetSrsConfigurationIndex(uint16_t srcCi)
     m_srsStartTime = Simulator::Now() + MilliSeconds(0);
     NS_LOG_DEBUG(this << " UE SRS P " << m_srsPeriodicity << " RNTI " << m_rnti << " offset "
                       << m_srsSubframeOffset << " cellId " << m_cellId << " CI " << srcCi);
+    // the SRS wake up of suspended subframe indications depends on it
+    DoResumeSubframeIndication();
 }
 
 void
@@ -1765,6 +1924,7 @@ LteUePhy::EnqueueDlHarqFeedback(DlInfoListElement_s m)
     // get the feedback from LteSpectrumPhy and send it through ideal PUCCH to eNB
     Ptr<DlHarqFeedbackLteControlMessage> msg = Create<DlHarqFeedbackLteControlMessage>();
     msg->SetDlHarqFeedback(m);
+    DoResumeSubframeIndication();
     SetControlMessages(msg);
 }
 
@@ -405,6 +405,34 @@ class LteUePhy : public LtePhy
      * \param [in] rbMap
      */
     void QueueSubChannelsForTransmission(std::vector<int> rbMap);
+    /**
+     * \brief Check whether the subframe indications can be suspended
+     *
+     * The UE is idle when nothing is queued for transmission in the next
+     * subframes and the MAC has no pending work.
+     *
+     * \return true if the UE is idle
+     */
+    bool IsIdle() const;
+    /**
+     * \brief Suspend the subframe indications of an idle UE
+     *
+     * If SRS is configured, the subframe indications restart at the next
+     * SRS subframe.
+     *
+     * \param frameNo frame number of the next subframe
+     * \param subframeNo number of the next subframe
+     */
+    void SuspendSubframeIndication(uint32_t frameNo, uint32_t subframeNo);
+    /**
+     * \brief Keep track of the subframes started while the subframe
+     * indications are suspended
+     *
+     * Refreshes the per-subframe measurement flags as SubframeIndication()
+     * would do, so that CQI and UE measurements are not affected by the
+     * suspension.
+     */
+    void UpdateSuspendedSubframe();
     /**
      * \brief Get CQI, RSRP, and RSRQ
      *
@@ -653,6 +681,10 @@ class LteUePhy : public LtePhy
      * establishment.
      */
     virtual void DoNotifyConnectionSuccessful();
+    /**
+     * \brief Resume the subframe indications, if suspended
+     */
+    void DoResumeSubframeIndication();
 
     /// A list of sub channels to use in TX.
     std::vector<int> m_subChannelsForTransmission;
@@ -797,6 +829,18 @@ class LteUePhy : public LtePhy
 
     EventId m_sendSrsEvent; ///< send SRS event
 
+    /**
+     * The `EnableIdleSubframeSkipping` attribute. If true, the subframe
+     * indications are suspended while the UE is idle.
+     */
+    bool m_enableIdleSubframeSkipping;
+    bool m_subframesSuspended;   ///< are the subframe indications suspended?
+    uint32_t m_nextFrameNo;      ///< frame number of the next subframe, when suspended
+    uint32_t m_nextSubframeNo;   ///< number of the next subframe, when suspended
+    Time m_nextSubframeStart;    ///< start time of the next subframe, when suspended
+    Time m_lastMacSubframeStart; ///< start time of the last subframe indicated to the MAC
+    EventId m_subframeWakeEvent; ///< wake up event for the next SRS subframe
+
     /**
      * The `UlPhyTransmission` trace source. Contains trace information regarding
      * PHY stats from UL Tx perspective. Exporting a structure with type
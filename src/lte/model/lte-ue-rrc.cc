@@ -525,6 +525,50 @@ LteUeRrc::SetUseRlcSm(bool val)
     m_useRlcSm = val;
 }
 
+void
+LteUeRrc::PreAttach(LteRrcSap::SystemInformation si, LteRrcSap::RrcConnectionReconfiguration msg)
+{
+    NS_LOG_FUNCTION(this << m_imsi);
+    NS_ASSERT_MSG(m_state == IDLE_START, "cannot pre-attach from state " << ToString(m_state));
+    NS_ASSERT(msg.haveMobilityControlInfo);
+    const LteRrcSap::MobilityControlInfo& mci = msg.mobilityControlInfo;
+    NS_ASSERT(mci.haveCarrierFreq);
+    NS_ASSERT(mci.haveCarrierBandwidth);
+
+    // camp on the cell, as upon the reception of the MIB
+    m_cellId = mci.targetPhysCellId;
+    m_dlEarfcn = mci.carrierFreq.dlCarrierFreq;
+    m_dlBandwidth = mci.carrierBandwidth.dlBandwidth;
+    m_cphySapProvider.at(0)->SynchronizeWithEnb(m_cellId, m_dlEarfcn);
+    m_cphySapProvider.at(0)->SetDlBandwidth(m_dlBandwidth);
+    m_hasReceivedMib = true;
+    SwitchToState(IDLE_CAMPED_NORMALLY);
+    DoRecvSystemInformation(si);
+
+    // connect, as upon the random access and the RRC connection setup
+    m_rnti = mci.newUeIdentity;
+    m_srb0->m_rlc->SetRnti(m_rnti);
+    m_cphySapProvider.at(0)->SetRnti(m_rnti);
+    m_cmacSapProvider.at(0)->SetRnti(m_rnti);
+    SwitchToState(IDLE_CONNECTING);
+    m_lastRrcTransactionIdentifier = msg.rrcTransactionIdentifier;
+    NS_ASSERT(msg.haveRadioResourceConfigDedicated);
+    ApplyRadioResourceConfigDedicated(msg.radioResourceConfigDedicated);
+    if (msg.haveNonCriticalExtension)
+    {
+        ApplyRadioResourceConfigDedicatedSecondaryCarrier(msg.nonCriticalExtension);
+    }
+    if (msg.haveMeasConfig)
+    {
+        ApplyMeasConfig(msg.measConfig);
+    }
+    SwitchToState(CONNECTED_NORMALLY);
+    m_leaveConnectedMode = false;
+    m_asSapUser->NotifyConnectionSuccessful();
+    m_cmacSapProvider.at(0)->NotifyConnectionSuccessful();
+    m_connectionEstablishedTrace(m_imsi, m_cellId, m_rnti);
+}
+
 void
 LteUeRrc::DoInitialize()
 {
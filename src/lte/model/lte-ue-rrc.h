@@ -259,6 +259,22 @@ class LteUeRrc : public Object
      */
     void StorePreviousCellId(uint16_t cellId);
 
+    /**
+     * \brief Connect the UE to a cell without the cell selection, the random
+     * access and the RRC connection establishment (see LteHelper::PreAttach).
+     *
+     * The UE camps on the cell, applies the System Information and the RRC
+     * connection reconfiguration provided by the eNB RRC (see
+     * LteEnbRrc::ConnectPreAttachedUe), and switches to the CONNECTED_NORMALLY
+     * state, firing the ConnectionEstablished trace. The UE must be in the
+     * IDLE_START state.
+     *
+     * \param si the System Information of the cell
+     * \param msg the RRC connection reconfiguration, with the mobility control
+     * information of the cell and the RNTI allocated to the UE
+     */
+    void PreAttach(LteRrcSap::SystemInformation si, LteRrcSap::RrcConnectionReconfiguration msg);
+
     /**
      *
      * \return imsi the unique UE identifier
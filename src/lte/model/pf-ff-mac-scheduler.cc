@@ -148,6 +148,15 @@ PfFfMacScheduler::DoCschedCellConfigReq(
     // Read the subset of parameters used
     m_cschedCellConfig = params;
     m_rachAllocationMap.resize(m_cschedCellConfig.m_ulBandwidth, 0);
+    int rbgSize = GetRbgSize(m_cschedCellConfig.m_dlBandwidth);
+    m_dlRbgRateFromCqi.clear();
+    for (int cqi = 0; cqi <= 15; cqi++)
+    {
+        // CQI 0 ("out of range") maps to MCS 0
+        int mcs = m_amc->GetMcsFromCqi(cqi);
+        m_dlRbgRateFromCqi.push_back((m_amc->GetDlTbSizeFromMcs(mcs, rbgSize) / 8) /
+                                     0.001); // = TB size / TTI
+    }
     FfMacCschedSapUser::CschedUeConfigCnfParameters cnf;
     cnf.m_result = SUCCESS;
     m_cschedSapUser->CschedUeConfigCnf(cnf);
@@ -355,7 +364,8 @@ PfFfMacScheduler::LcActivePerFlow(uint16_t rnti)
 {
     std::map<LteFlowId_t, FfMacSchedSapProvider::SchedDlRlcBufferReqParameters>::iterator it;
     unsigned int lcActive = 0;
-    for (it = m_rlcBufferReq.begin(); it != m_rlcBufferReq.end(); it++)
+    // the flows are sorted by RNTI, then by LCID
+    for (it = m_rlcBufferReq.lower_bound(LteFlowId_t(rnti, 0)); it != m_rlcBufferReq.end(); it++)
     {
         if (((*it).first.m_rnti == rnti) && (((*it).second.m_rlcTransmissionQueueSize > 0) ||
                                              ((*it).second.m_rlcRetransmissionQueueSize > 0) ||
@@ -945,102 +955,112 @@ PfFfMacScheduler::DoSchedDlTriggerReq(
         return;
     }
 
+    // the eligibility of each UE does not depend on the RBG: evaluate it once
+    m_dlRbgCandidates.clear();
+    for (auto it = m_flowStatsDl.begin(); it != m_flowStatsDl.end(); it++)
+    {
+        DlRbgCandidate_t candidate;
+        candidate.flowStats = it;
+        candidate.eligible = false;
+        candidate.nLayer = 0;
+        candidate.cqi = nullptr;
+        if (rntiAllocated.find((*it).first) != rntiAllocated.end())
+        {
+            // UE already allocated for HARQ -> drop it
+            NS_LOG_DEBUG(this << " RNTI discarded for HARQ tx" << (uint16_t)(*it).first);
+        }
+        else if (!HarqProcessAvailability((*it).first))
+        {
+            // UE without HARQ process available -> drop it
+            NS_LOG_DEBUG(this << " RNTI discarded for HARQ id" << (uint16_t)(*it).first);
+        }
+        else if (LcActivePerFlow((*it).first) > 0)
+        {
+            // this UE has data to transmit
+            std::map<uint16_t, uint8_t>::iterator itTxMode = m_uesTxMode.find((*it).first);
+            if (itTxMode == m_uesTxMode.end())
+            {
+                NS_FATAL_ERROR("No Transmission Mode info on user " << (*it).first);
+            }
+            candidate.eligible = true;
+            candidate.nLayer = TransmissionModesLayers::TxMode2LayerNum((*itTxMode).second);
+            std::map<uint16_t, SbMeasResult_s>::iterator itCqi = m_a30CqiRxed.find((*it).first);
+            if (itCqi != m_a30CqiRxed.end())
+            {
+                candidate.cqi = &(*itCqi).second;
+            }
+        }
+        m_dlRbgCandidates.push_back(candidate);
+    }
+
     for (int i = 0; i < rbgNum; i++)
     {
         NS_LOG_INFO(this << " ALLOCATION for RBG " << i << " of " << rbgNum);
         if (rbgMap.at(i) == false)
         {
-            std::map<uint16_t, pfsFlowPerf_t>::iterator it;
             std::map<uint16_t, pfsFlowPerf_t>::iterator itMax = m_flowStatsDl.end();
             double rcqiMax = 0.0;
-            for (it = m_flowStatsDl.begin(); it != m_flowStatsDl.end(); it++)
+            for (const auto& candidate : m_dlRbgCandidates)
             {
+                std::map<uint16_t, pfsFlowPerf_t>::iterator it = candidate.flowStats;
                 if ((m_ffrSapProvider->IsDlRbgAvailableForUe(i, (*it).first)) == false)
                 {
                     continue;
                 }
-
-                std::set<uint16_t>::iterator itRnti = rntiAllocated.find((*it).first);
-                if ((itRnti != rntiAllocated.end()) || (!HarqProcessAvailability((*it).first)))
+                if (!candidate.eligible)
                 {
-                    // UE already allocated for HARQ or without HARQ process available -> drop it
-                    if (itRnti != rntiAllocated.end())
-                    {
-                        NS_LOG_DEBUG(this << " RNTI discarded for HARQ tx"
-                                          << (uint16_t)(*it).first);
-                    }
-                    if (!HarqProcessAvailability((*it).first))
-                    {
-                        NS_LOG_DEBUG(this << " RNTI discarded for HARQ id"
-                                          << (uint16_t)(*it).first);
-                    }
                     continue;
                 }
-                std::map<uint16_t, SbMeasResult_s>::iterator itCqi;
-                itCqi = m_a30CqiRxed.find((*it).first);
-                std::map<uint16_t, uint8_t>::iterator itTxMode;
-                itTxMode = m_uesTxMode.find((*it).first);
-                if (itTxMode == m_uesTxMode.end())
-                {
-                    NS_FATAL_ERROR("No Transmission Mode info on user " << (*it).first);
-                }
-                auto nLayer = TransmissionModesLayers::TxMode2LayerNum((*itTxMode).second);
-                std::vector<uint8_t> sbCqi;
-                if (itCqi == m_a30CqiRxed.end())
+
+                double achievableRate = 0.0;
+                if (candidate.cqi == nullptr)
                 {
-                    for (uint8_t k = 0; k < nLayer; k++)
+                    for (uint8_t k = 0; k < candidate.nLayer; k++)
                     {
-                        sbCqi.push_back(1); // start with lowest value
+                        // start with lowest value
+                        achievableRate += m_dlRbgRateFromCqi.at(1);
                     }
                 }
                 else
                 {
-                    sbCqi = (*itCqi).second.m_higherLayerSelected.at(i).m_sbCqi;
-                }
-                uint8_t cqi1 = sbCqi.at(0);
-                uint8_t cqi2 = 0;
-                if (sbCqi.size() > 1)
-                {
-                    cqi2 = sbCqi.at(1);
-                }
-
-                if ((cqi1 > 0) ||
-                    (cqi2 > 0)) // CQI == 0 means "out of range" (see table 7.2.3-1 of 36.213)
-                {
-                    if (LcActivePerFlow((*it).first) > 0)
+                    const std::vector<uint8_t>& sbCqi =
+                        candidate.cqi->m_higherLayerSelected.at(i).m_sbCqi;
+                    uint8_t cqi1 = sbCqi.at(0);
+                    uint8_t cqi2 = 0;
+                    if (sbCqi.size() > 1)
                     {
-                        // this UE has data to transmit
-                        double achievableRate = 0.0;
-                        uint8_t mcs = 0;
-                        for (uint8_t k = 0; k < nLayer; k++)
+                        cqi2 = sbCqi.at(1);
+                    }
+                    if ((cqi1 == 0) && (cqi2 == 0))
+                    {
+                        // CQI == 0 means "out of range" (see table 7.2.3-1 of 36.213)
+                        continue;
+                    }
+                    for (uint8_t k = 0; k < candidate.nLayer; k++)
+                    {
+                        if (sbCqi.size() > k)
                         {
-                            if (sbCqi.size() > k)
-                            {
-                                mcs = m_amc->GetMcsFromCqi(sbCqi.at(k));
-                            }
-                            else
-                            {
-                                // no info on this subband -> worst MCS
-                                mcs = 0;
-                            }
-                            achievableRate += ((m_amc->GetDlTbSizeFromMcs(mcs, rbgSize) / 8) /
-                                               0.001); // = TB size / TTI
+                            achievableRate += m_dlRbgRateFromCqi.at(sbCqi.at(k));
                         }
-
-                        double rcqi = achievableRate / (*it).second.lastAveragedThroughput;
-                        NS_LOG_INFO(this << " RNTI " << (*it).first << " MCS " << (uint32_t)mcs
-                                         << " achievableRate " << achievableRate << " avgThr "
-                                         << (*it).second.lastAveragedThroughput << " RCQI "
-                                         << rcqi);
-
-                        if (rcqi > rcqiMax)
+                        else
                         {
-                            rcqiMax = rcqi;
-                            itMax = it;
+                            // no info on this subband -> worst MCS
+                            achievableRate += m_dlRbgRateFromCqi.at(0);
                         }
                     }
-                } // end if cqi
-            }     // end for m_rlcBufferReq
+                }
+
+                double rcqi = achievableRate / (*it).second.lastAveragedThroughput;
+                NS_LOG_INFO(this << " RNTI " << (*it).first << " achievableRate " << achievableRate
+                                 << " avgThr " << (*it).second.lastAveragedThroughput << " RCQI "
+                                 << rcqi);
+
+                if (rcqi > rcqiMax)
+                {
+                    rcqiMax = rcqi;
+                    itMax = it;
+                }
+            } // end for m_dlRbgCandidates
 
             if (itMax == m_flowStatsDl.end())
             {
@@ -1187,7 +1207,9 @@ PfFfMacScheduler::DoSchedDlTriggerReq(
         // create the rlc PDUs -> equally divide resources among actives LCs
         std::map<LteFlowId_t, FfMacSchedSapProvider::SchedDlRlcBufferReqParameters>::iterator
             itBufReq;
-        for (itBufReq = m_rlcBufferReq.begin(); itBufReq != m_rlcBufferReq.end(); itBufReq++)
+        for (itBufReq = m_rlcBufferReq.lower_bound(LteFlowId_t((*itMap).first, 0));
+             itBufReq != m_rlcBufferReq.end();
+             itBufReq++)
         {
             if (((*itBufReq).first.m_rnti == (*itMap).first) &&
                 (((*itBufReq).second.m_rlcTransmissionQueueSize > 0) ||
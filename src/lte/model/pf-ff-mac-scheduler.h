@@ -425,6 +425,26 @@ class PfFfMacScheduler : public FfMacScheduler
     std::vector<struct RachListElement_s> m_rachList; ///< RACH list
     std::vector<uint16_t> m_rachAllocationMap;        ///< RACH allocation map
     uint8_t m_ulGrantMcs;                             ///< MCS for UL grant (default 0)
+
+    /// Per-TTI information on a UE competing for the DL RBGs
+    struct DlRbgCandidate_t
+    {
+        std::map<uint16_t, pfsFlowPerf_t>::iterator flowStats; ///< DL statistics of the UE
+        bool eligible;             ///< has data, has a free HARQ process and is not in HARQ retx
+        uint8_t nLayer;            ///< number of layers of the UE transmission mode
+        const SbMeasResult_s* cqi; ///< last A30 CQI report of the UE, or nullptr
+    };
+
+    /**
+     * UEs competing for the DL RBGs in the current TTI, in RNTI order.
+     * Kept as a member to reuse its storage from one TTI to the next.
+     */
+    std::vector<DlRbgCandidate_t> m_dlRbgCandidates;
+    /**
+     * Achievable rate (bytes/s) over a single RBG with the MCS of each CQI,
+     * filled when the cell is configured
+     */
+    std::vector<double> m_dlRbgRateFromCqi;
 };
 
 } // namespace ns3
@@ -0,0 +1,260 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "lte-test-ff-mac-scheduler-allocation.h"
+
+#include "ns3/double.h"
+#include "ns3/radio-bearer-stats-calculator.h"
+#include "ns3/string.h"
+#include <ns3/boolean.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/eps-bearer.h>
+#include <ns3/log.h>
+#include <ns3/lte-enb-mac.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-enb-phy.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-phy.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/simulator.h>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LenaTestFfMacSchedulerAllocation");
+
+LenaTestFfMacSchedulerAllocationSuite::LenaTestFfMacSchedulerAllocationSuite()
+    : TestSuite("lte-ff-mac-scheduler-allocation", SYSTEM)
+{
+    NS_LOG_INFO("creating LenaTestFfMacSchedulerAllocationSuite");
+
+    // the expected allocations are the ones obtained before the per-TTI
+    // processing of the schedulers was optimized
+    const std::map<std::string, std::vector<LenaFfMacSchedulerAllocationTestCase::UeAllocation>>
+        expected{
+            {"ns3::PfFfMacScheduler",
+             {
+                 {117, 254817, 133956, 140400},
+                 {118, 254898, 131760, 80400},
+                 {114, 156360, 81538, 46800},
+                 {114, 134664, 70210, 37200},
+                 {116, 103926, 54120, 32400},
+             }},
+            {"ns3::FdMtFfMacScheduler",
+             {
+                 {0, 0, 0, 140400},
+                 {579, 1260909, 656604, 80400},
+                 {0, 0, 0, 46800},
+                 {0, 0, 0, 37200},
+                 {0, 0, 0, 32400},
+             }},
+            {"ns3::TdMtFfMacScheduler",
+             {
+                 {0, 0, 0, 140400},
+                 {579, 1260909, 656604, 80400},
+                 {0, 0, 0, 46800},
+                 {0, 0, 0, 37200},
+                 {0, 0, 0, 32400},
+             }},
+            {"ns3::TtaFfMacScheduler",
+             {
+                 {0, 0, 0, 140400},
+                 {579, 1260909, 656604, 80400},
+                 {0, 0, 0, 46800},
+                 {0, 0, 0, 37200},
+                 {0, 0, 0, 32400},
+             }},
+            {"ns3::FdBetFfMacScheduler",
+             {
+                 {358, 163033, 85624, 140400},
+                 {350, 162961, 85524, 80400},
+                 {372, 162417, 85740, 46800},
+                 {400, 162727, 85288, 37200},
+                 {421, 162453, 85488, 32400},
+             }},
+            {"ns3::TdBetFfMacScheduler",
+             {
+                 {77, 164862, 87840, 140400},
+                 {77, 164862, 85644, 80400},
+                 {119, 163275, 85684, 46800},
+                 {138, 162138, 84490, 37200},
+                 {168, 161570, 84042, 32400},
+             }},
+            {"ns3::FdTbfqFfMacScheduler",
+             {
+                 {3, 147, 0, 140400},
+                 {5, 405, 0, 80400},
+                 {1, 1383, 0, 46800},
+                 {3, 1385, 0, 37200},
+                 {3, 375, 0, 32400},
+             }},
+            {"ns3::TdTbfqFfMacScheduler",
+             {
+                 {3, 2358, 0, 140400},
+                 {572, 1245537, 656604, 80400},
+                 {2, 1464, 0, 46800},
+                 {3, 1353, 0, 37200},
+                 {1, 903, 0, 32400},
+             }},
+            {"ns3::PssFfMacScheduler",
+             {
+                 {116, 252621, 131760, 140400},
+                 {116, 252621, 131760, 80400},
+                 {114, 155058, 80156, 46800},
+                 {113, 133473, 69020, 37200},
+                 {120, 107538, 56826, 32400},
+             }},
+            {"ns3::CqaFfMacScheduler",
+             {
+                 {574, 1249929, 656604, 140400},
+                 {0, 0, 0, 80400},
+                 {0, 0, 0, 46800},
+                 {0, 0, 0, 37200},
+                 {5, 405, 0, 32400},
+             }},
+        };
+    for (const auto& [schedulerType, allocations] : expected)
+    {
+        AddTestCase(new LenaFfMacSchedulerAllocationTestCase(schedulerType, allocations),
+                    TestCase::QUICK);
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LenaTestFfMacSchedulerAllocationSuite lenaTestFfMacSchedulerAllocationSuite;
+
+LenaFfMacSchedulerAllocationTestCase::LenaFfMacSchedulerAllocationTestCase(
+    std::string schedulerType,
+    std::vector<UeAllocation> expected)
+    : TestCase("Allocations of " + schedulerType),
+      m_schedulerType(schedulerType),
+      m_expected(expected)
+{
+}
+
+void
+LenaFfMacSchedulerAllocationTestCase::DlScheduling(DlSchedulingCallbackInfo info)
+{
+    UeAllocation& allocation = m_actual[info.rnti];
+    allocation.dlTbs++;
+    allocation.dlTbBytes += info.sizeTb1 + info.sizeTb2;
+}
+
+void
+LenaFfMacSchedulerAllocationTestCase::DoRun()
+{
+    NS_LOG_FUNCTION(this << m_schedulerType);
+    Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteHelper::UseIdealRrc", BooleanValue(true));
+    Config::SetDefault("ns3::MacStatsCalculator::DlOutputFilename",
+                       StringValue(CreateTempDirFilename("DlMacStats.txt")));
+    Config::SetDefault("ns3::MacStatsCalculator::UlOutputFilename",
+                       StringValue(CreateTempDirFilename("UlMacStats.txt")));
+    Config::SetDefault("ns3::RadioBearerStatsCalculator::DlRlcOutputFilename",
+                       StringValue(CreateTempDirFilename("DlRlcStats.txt")));
+    Config::SetDefault("ns3::RadioBearerStatsCalculator::UlRlcOutputFilename",
+                       StringValue(CreateTempDirFilename("UlRlcStats.txt")));
+
+    const std::vector<double> distances{1000, 3000, 4800, 6000, 8000};
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    lteHelper->SetAttribute("PathlossModel", StringValue("ns3::FriisSpectrumPropagationLossModel"));
+
+    NodeContainer enbNodes;
+    NodeContainer ueNodes;
+    enbNodes.Create(1);
+    ueNodes.Create(distances.size());
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    lteHelper->SetSchedulerType(m_schedulerType);
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    int64_t stream = 1;
+    stream += lteHelper->AssignStreams(enbDevs, stream);
+    lteHelper->AssignStreams(ueDevs, stream);
+
+    lteHelper->Attach(ueDevs, enbDevs.Get(0));
+    // two flows per UE, so that the schedulers look up the flows of each RNTI
+    lteHelper->ActivateDataRadioBearer(ueDevs, EpsBearer(EpsBearer::GBR_CONV_VOICE));
+    lteHelper->ActivateDataRadioBearer(ueDevs, EpsBearer(EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+    Ptr<LteEnbNetDevice> lteEnbDev = enbDevs.Get(0)->GetObject<LteEnbNetDevice>();
+    Ptr<LteEnbPhy> enbPhy = lteEnbDev->GetPhy();
+    enbPhy->SetAttribute("TxPower", DoubleValue(30.0));
+    enbPhy->SetAttribute("NoiseFigure", DoubleValue(5.0));
+    lteEnbDev->GetMac()->TraceConnectWithoutContext(
+        "DlScheduling",
+        MakeCallback(&LenaFfMacSchedulerAllocationTestCase::DlScheduling, this));
+
+    for (uint32_t i = 0; i < distances.size(); i++)
+    {
+        Ptr<ConstantPositionMobilityModel> mm =
+            ueNodes.Get(i)->GetObject<ConstantPositionMobilityModel>();
+        mm->SetPosition(Vector(distances[i], 0.0, 0.0));
+        Ptr<LteUePhy> uePhy = ueDevs.Get(i)->GetObject<LteUeNetDevice>()->GetPhy();
+        uePhy->SetAttribute("TxPower", DoubleValue(23.0));
+        uePhy->SetAttribute("NoiseFigure", DoubleValue(9.0));
+    }
+
+    double statsStartTime = 0.3;
+    double statsDuration = 0.3;
+    Simulator::Stop(Seconds(statsStartTime + statsDuration - 0.000001));
+
+    lteHelper->EnableRlcTraces();
+    Ptr<RadioBearerStatsCalculator> rlcStats = lteHelper->GetRlcStats();
+    rlcStats->SetAttribute("StartTime", TimeValue(Seconds(statsStartTime)));
+    rlcStats->SetAttribute("EpochDuration", TimeValue(Seconds(statsDuration)));
+
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_expected.size(), distances.size(), "Wrong number of expected UEs");
+    for (uint32_t i = 0; i < distances.size(); i++)
+    {
+        Ptr<LteUeNetDevice> ueDev = ueDevs.Get(i)->GetObject<LteUeNetDevice>();
+        uint64_t imsi = ueDev->GetImsi();
+        UeAllocation& actual = m_actual[ueDev->GetRrc()->GetRnti()];
+        actual.dlRxBytes = rlcStats->GetDlRxData(imsi, 3) + rlcStats->GetDlRxData(imsi, 4);
+        actual.ulRxBytes = rlcStats->GetUlRxData(imsi, 3) + rlcStats->GetUlRxData(imsi, 4);
+        NS_LOG_INFO("UE " << i << " DL TBs " << actual.dlTbs << " DL TB bytes "
+                          << actual.dlTbBytes << " DL RX bytes " << actual.dlRxBytes
+                          << " UL RX bytes " << actual.ulRxBytes);
+
+        const UeAllocation& expected = m_expected[i];
+        NS_TEST_EXPECT_MSG_EQ(actual.dlTbs, expected.dlTbs, "Wrong number of DL TBs of UE " << i);
+        NS_TEST_EXPECT_MSG_EQ(actual.dlTbBytes,
+                              expected.dlTbBytes,
+                              "Wrong size of the DL TBs of UE " << i);
+        NS_TEST_EXPECT_MSG_EQ(actual.dlRxBytes,
+                              expected.dlRxBytes,
+                              "Wrong DL throughput of UE " << i);
+        NS_TEST_EXPECT_MSG_EQ(actual.ulRxBytes,
+                              expected.ulRxBytes,
+                              "Wrong UL throughput of UE " << i);
+    }
+
+    Simulator::Destroy();
+}
@@ -0,0 +1,87 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef LENA_TEST_FF_MAC_SCHEDULER_ALLOCATION_H
+#define LENA_TEST_FF_MAC_SCHEDULER_ALLOCATION_H
+
+#include "ns3/lte-common.h"
+#include "ns3/test.h"
+
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test that a FF MAC scheduler allocates the same resources as before
+ * the optimization of its per-TTI processing.
+ *
+ * A single eNB serves five UEs at different distances, each UE having two
+ * saturated data radio bearers.  The streams of the random variables are
+ * fixed, so that the scenario is deterministic.  The number and the total size
+ * of the DL transport blocks allocated to each UE, as well as the DL and UL
+ * RLC throughput of each UE, must be equal to the ones obtained with the
+ * previous implementation of the scheduler.
+ */
+class LenaFfMacSchedulerAllocationTestCase : public TestCase
+{
+  public:
+    /// The resources allocated to a UE
+    struct UeAllocation
+    {
+        uint32_t dlTbs{0};     ///< the number of DL transport blocks
+        uint64_t dlTbBytes{0}; ///< the total size of the DL transport blocks
+        uint64_t dlRxBytes{0}; ///< the DL RLC bytes received during the stats period
+        uint64_t ulRxBytes{0}; ///< the UL RLC bytes received during the stats period
+    };
+
+    /**
+     * Constructor
+     *
+     * \param schedulerType the type of the scheduler
+     * \param expected the expected allocation of each UE
+     */
+    LenaFfMacSchedulerAllocationTestCase(std::string schedulerType,
+                                         std::vector<UeAllocation> expected);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * DL scheduling trace sink
+     * \param info the DL scheduling information
+     */
+    void DlScheduling(DlSchedulingCallbackInfo info);
+
+    std::string m_schedulerType;               ///< the type of the scheduler
+    std::vector<UeAllocation> m_expected;      ///< the expected allocation of each UE
+    std::map<uint16_t, UeAllocation> m_actual; ///< the allocation of each UE, indexed by RNTI
+};
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief FF MAC schedulers allocation test suite
+ */
+class LenaTestFfMacSchedulerAllocationSuite : public TestSuite
+{
+  public:
+    LenaTestFfMacSchedulerAllocationSuite();
+};
+
+#endif /* LENA_TEST_FF_MAC_SCHEDULER_ALLOCATION_H */
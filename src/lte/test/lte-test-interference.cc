@@ -34,6 +34,7 @@
 #include "ns3/string.h"
 #include <ns3/enum.h>
 #include <ns3/lte-chunk-processor.h>
+#include <ns3/lte-interference.h>
 
 using namespace ns3;
 
@@ -185,6 +186,21 @@ LteInterferenceTestSuite::LteInterferenceTestSuite()
                                             6,
                                             0),
                 TestCase::QUICK);
+
+    // 10 RBs, a signal on RBs 0-4, an interferer A on RBs 3-9 during the
+    // whole signal and an interferer B on RBs 4-6 during half of it
+    AddTestCase(new LteInterferenceThresholdTestCase("all interferers",
+                                                     0.0,
+                                                     {10, 10, 10, 2, 1.5, 0, 0, 0, 0, 0}),
+                TestCase::QUICK);
+    AddTestCase(new LteInterferenceThresholdTestCase("interferer B in the noise",
+                                                     3e6,
+                                                     {10, 10, 10, 2, 10 / 7.5, 0, 0, 0, 0, 0}),
+                TestCase::QUICK);
+    AddTestCase(new LteInterferenceThresholdTestCase("interferers A and B in the noise",
+                                                     1e7,
+                                                     {10, 10, 10, 2, 10 / 7.5, 0, 0, 0, 0, 0}),
+                TestCase::QUICK);
 }
 
 /**
@@ -390,3 +406,77 @@ LteInterferenceTestCase::UlScheduling(uint32_t frameNo,
         NS_TEST_ASSERT_MSG_EQ((uint32_t)mcs, (uint32_t)m_ulMcs, "Wrong UL MCS");
     }
 }
+
+LteInterferenceThresholdTestCase::LteInterferenceThresholdTestCase(std::string name,
+                                                                   double threshold,
+                                                                   std::vector<double> expectedSinr)
+    : TestCase("Interference power threshold: " + name),
+      m_threshold(threshold),
+      m_expectedSinr(expectedSinr)
+{
+}
+
+void
+LteInterferenceThresholdTestCase::DoRun()
+{
+    Bands bands;
+    for (uint32_t rb = 0; rb < m_expectedSinr.size(); rb++)
+    {
+        BandInfo band;
+        band.fl = 2110e6 + rb * 180e3;
+        band.fc = band.fl + 90e3;
+        band.fh = band.fl + 180e3;
+        bands.push_back(band);
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(bands);
+
+    Ptr<SpectrumValue> noise = Create<SpectrumValue>(model);
+    (*noise) = 1.0;
+    Ptr<SpectrumValue> signal = Create<SpectrumValue>(model);
+    Ptr<SpectrumValue> interfererA = Create<SpectrumValue>(model);
+    Ptr<SpectrumValue> interfererB = Create<SpectrumValue>(model);
+    for (uint32_t rb = 0; rb < m_expectedSinr.size(); rb++)
+    {
+        (*signal)[rb] = (rb <= 4) ? 10.0 : 0.0;
+        (*interfererA)[rb] = (rb >= 3) ? 4.0 : 0.0;
+        (*interfererB)[rb] = (rb >= 4 && rb <= 6) ? 5.0 : 0.0;
+    }
+
+    Ptr<LteInterference> interference = CreateObject<LteInterference>();
+    interference->SetAttribute("InterfererPowerThreshold", DoubleValue(m_threshold));
+    interference->SetNoisePowerSpectralDensity(noise);
+    Ptr<LteChunkProcessor> sinrProcessor = Create<LteChunkProcessor>();
+    LteSpectrumValueCatcher sinrCatcher;
+    sinrProcessor->AddCallback(MakeCallback(&LteSpectrumValueCatcher::ReportValue, &sinrCatcher));
+    interference->AddSinrChunkProcessor(sinrProcessor);
+
+    Simulator::Schedule(Seconds(0),
+                        &LteInterference::AddSignal,
+                        interference,
+                        signal,
+                        MilliSeconds(1));
+    Simulator::Schedule(Seconds(0), &LteInterference::StartRx, interference, signal);
+    Simulator::Schedule(Seconds(0),
+                        &LteInterference::AddInterferer,
+                        interference,
+                        interfererA,
+                        MilliSeconds(1));
+    Simulator::Schedule(MilliSeconds(1), &LteInterference::EndRx, interference);
+    Simulator::Schedule(Seconds(0),
+                        &LteInterference::AddInterferer,
+                        interference,
+                        interfererB,
+                        MicroSeconds(500));
+    Simulator::Run();
+
+    Ptr<SpectrumValue> sinr = sinrCatcher.GetValue();
+    NS_TEST_ASSERT_MSG_NE(sinr, nullptr, "no SINR reported");
+    for (uint32_t rb = 0; rb < m_expectedSinr.size(); rb++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL((*sinr)[rb],
+                                  m_expectedSinr[rb],
+                                  1e-9,
+                                  "wrong SINR for RB " << rb);
+    }
+    Simulator::Destroy();
+}
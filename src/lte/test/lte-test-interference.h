@@ -24,6 +24,8 @@
 #include "ns3/lte-common.h"
 #include "ns3/test.h"
 
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -101,4 +103,32 @@ class LteInterferenceTestCase : public TestCase
     uint16_t m_ulMcs;          ///< the UL MCS
 };
 
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test the SINR computed by LteInterference for signals occupying
+ * different ranges of RBs, with interferers below a power threshold being
+ * added to the noise.
+ */
+class LteInterferenceThresholdTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param name the reference name
+     * \param threshold the InterfererPowerThreshold attribute
+     * \param expectedSinr the expected SINR of each RB
+     */
+    LteInterferenceThresholdTestCase(std::string name,
+                                     double threshold,
+                                     std::vector<double> expectedSinr);
+
+  private:
+    void DoRun() override;
+
+    double m_threshold;                 ///< the power threshold of the interferers
+    std::vector<double> m_expectedSinr; ///< the expected SINR of each RB
+};
+
 #endif /* LTE_TEST_INTERFERENCE_H */
@@ -25,6 +25,7 @@
 #include "ns3/lte-rlc-header.h"
 #include "ns3/lte-rlc-um.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 using namespace ns3;
 
@@ -47,6 +48,10 @@ LteRlcUmTransmitterTestSuite::LteRlcUmTransmitterTestSuite()
     AddTestCase(new LteRlcUmTransmitterConcatenationTestCase("Concatenation"), TestCase::QUICK);
     AddTestCase(new LteRlcUmTransmitterReportBufferStatusTestCase("ReportBufferStatus primitive"),
                 TestCase::QUICK);
+    AddTestCase(new LteRlcUmTransmitterBufferSizeTestCase("BufferSize trace", 10 * 1024),
+                TestCase::QUICK);
+    AddTestCase(new LteRlcUmTransmitterBufferSizeTestCase("Unlimited transmission buffer", 0),
+                TestCase::QUICK);
 }
 
 /**
@@ -307,3 +312,113 @@ LteRlcUmTransmitterReportBufferStatusTestCase::DoRun()
     Simulator::Run();
     Simulator::Destroy();
 }
+
+/**
+ * Test 4.1.1.5 BufferSize trace source, and unlimited transmission buffer
+ */
+LteRlcUmTransmitterBufferSizeTestCase::LteRlcUmTransmitterBufferSizeTestCase(
+    std::string name,
+    uint32_t maxTxBufferSize)
+    : LteRlcUmTransmitterTestCase(name),
+      m_maxTxBufferSize(maxTxBufferSize),
+      m_reports(0),
+      m_lastTxBytes(0),
+      m_lastRetxBytes(0),
+      m_txDrops(0)
+{
+}
+
+LteRlcUmTransmitterBufferSizeTestCase::~LteRlcUmTransmitterBufferSizeTestCase()
+{
+}
+
+void
+LteRlcUmTransmitterBufferSizeTestCase::BufferSize(uint16_t rnti,
+                                                  uint8_t lcid,
+                                                  uint32_t txBytes,
+                                                  uint32_t retxBytes)
+{
+    NS_TEST_EXPECT_MSG_EQ(rnti, 1111, "Wrong RNTI");
+    NS_TEST_EXPECT_MSG_EQ((uint16_t)lcid, 222, "Wrong LCID");
+    m_reports++;
+    m_lastTxBytes = txBytes;
+    m_lastRetxBytes = retxBytes;
+}
+
+void
+LteRlcUmTransmitterBufferSizeTestCase::TxDrop(Ptr<const Packet> p)
+{
+    m_txDrops++;
+}
+
+void
+LteRlcUmTransmitterBufferSizeTestCase::CheckBufferSize(Time time,
+                                                       uint32_t txBytes,
+                                                       std::string assertMsg)
+{
+    Simulator::Schedule(time,
+                        &LteRlcUmTransmitterBufferSizeTestCase::DoCheckBufferSize,
+                        this,
+                        txBytes,
+                        assertMsg);
+}
+
+void
+LteRlcUmTransmitterBufferSizeTestCase::DoCheckBufferSize(uint32_t txBytes, std::string assertMsg)
+{
+    NS_TEST_ASSERT_MSG_GT(m_reports, 0, "No buffer size reported");
+    NS_TEST_ASSERT_MSG_EQ(m_lastTxBytes, txBytes, assertMsg);
+    NS_TEST_ASSERT_MSG_EQ(m_lastRetxBytes, 0, "RLC UM has no retransmission queue");
+}
+
+void
+LteRlcUmTransmitterBufferSizeTestCase::DoRun()
+{
+    // Create topology
+    LteRlcUmTransmitterTestCase::DoRun();
+    txRlc->SetAttribute("MaxTxBufferSize", UintegerValue(m_maxTxBufferSize));
+    txRlc->TraceConnectWithoutContext(
+        "BufferSize",
+        MakeCallback(&LteRlcUmTransmitterBufferSizeTestCase::BufferSize, this));
+    txRlc->TraceConnectWithoutContext(
+        "TxDrop",
+        MakeCallback(&LteRlcUmTransmitterBufferSizeTestCase::TxDrop, this));
+
+    //
+    // e) Test the BufferSize trace and the size of the transmission buffer
+    //
+
+    // PDCP entity sends data
+    txPdcp->SendData(Seconds(0.100), "ABCDEFGHIJ"); // 10
+    // the reported size includes an estimated header of 2 bytes per SDU
+    CheckBufferSize(Seconds(0.110), 10 + 2, "Wrong buffer size after the first SDU");
+    txPdcp->SendData(Seconds(0.150), "KLMNOPQRS"); // 9
+    txPdcp->SendData(Seconds(0.200), "TUVWXYZ");   // 7
+    CheckBufferSize(Seconds(0.210), 26 + 3 * 2, "Wrong buffer size after the third SDU");
+
+    // the remaining 10 bytes of two SDUs are reported when the RBS timer expires
+    txMac->SendTxOpportunity(Seconds(0.250), (2 + 2) + (10 + 6));
+    CheckDataReceived(Seconds(0.300), "ABCDEFGHIJKLMNOP", "SDU is not OK");
+    CheckBufferSize(Seconds(0.300), 10 + 2 * 2, "Wrong buffer size after the transmission");
+
+    // 11 SDUs of 1000 bytes exceed the default MaxTxBufferSize
+    for (uint32_t i = 0; i < 11; i++)
+    {
+        txPdcp->SendData(Seconds(0.400 + i * 0.010), std::string(1000, 'A'));
+    }
+    if (m_maxTxBufferSize == 0)
+    {
+        CheckBufferSize(Seconds(0.600), 11010 + 13 * 2, "The buffer should be unlimited");
+    }
+    else
+    {
+        CheckBufferSize(Seconds(0.600), 10010 + 12 * 2, "The last SDU should be dropped");
+    }
+
+    // the RBS timer keeps reporting the SDUs left in the buffer
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_txDrops, (m_maxTxBufferSize == 0 ? 0 : 1), "Wrong number of drops");
+}
@@ -21,6 +21,7 @@
 #define LTE_TEST_RLC_UM_TRANSMITTER_H
 
 #include "ns3/nstime.h"
+#include "ns3/packet.h"
 #include "ns3/ptr.h"
 #include "ns3/test.h"
 
@@ -174,4 +175,62 @@ class LteRlcUmTransmitterReportBufferStatusTestCase : public LteRlcUmTransmitter
     void DoRun() override;
 };
 
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test 4.1.1.5 BufferSize trace source, and unlimited transmission
+ * buffer when MaxTxBufferSize is zero
+ */
+class LteRlcUmTransmitterBufferSizeTestCase : public LteRlcUmTransmitterTestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param name the reference name
+     * \param maxTxBufferSize the MaxTxBufferSize attribute of the RLC entity
+     */
+    LteRlcUmTransmitterBufferSizeTestCase(std::string name, uint32_t maxTxBufferSize);
+    ~LteRlcUmTransmitterBufferSizeTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Sink of the BufferSize trace source
+     * \param rnti the RNTI
+     * \param lcid the LCID
+     * \param txBytes the size of the transmission queue reported to the MAC
+     * \param retxBytes the size of the retransmission queue
+     */
+    void BufferSize(uint16_t rnti, uint8_t lcid, uint32_t txBytes, uint32_t retxBytes);
+
+    /**
+     * Sink of the TxDrop trace source
+     * \param p the dropped SDU
+     */
+    void TxDrop(Ptr<const Packet> p);
+
+    /**
+     * Check the last buffer size reported
+     * \param time the time to check
+     * \param txBytes the expected size of the transmission queue reported to the MAC
+     * \param assertMsg the assert message
+     */
+    void CheckBufferSize(Time time, uint32_t txBytes, std::string assertMsg);
+
+    /**
+     * Check the last buffer size reported
+     * \param txBytes the expected size of the transmission queue reported to the MAC
+     * \param assertMsg the assert message
+     */
+    void DoCheckBufferSize(uint32_t txBytes, std::string assertMsg);
+
+    uint32_t m_maxTxBufferSize; ///< the MaxTxBufferSize attribute of the RLC entity
+    uint32_t m_reports;         ///< the number of buffer sizes reported
+    uint32_t m_lastTxBytes;     ///< the last number of bytes waiting for a first transmission
+    uint32_t m_lastRetxBytes;   ///< the last size of the retransmission queue
+    uint32_t m_txDrops;         ///< the number of SDUs dropped
+};
+
 #endif /* LTE_TEST_RLC_UM_TRANSMITTER_H */
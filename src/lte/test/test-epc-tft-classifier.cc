@@ -203,6 +203,66 @@ EpcTftClassifierTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(obtainedTftId, (uint16_t)m_tftId, "bad classification of UDP packet");
 }
 
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test case to check that the classification of a flow is updated
+ * when the TFTs of the classifier change.
+ */
+class EpcTftClassifierUpdateTestCase : public TestCase
+{
+  public:
+    EpcTftClassifierUpdateTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+EpcTftClassifierUpdateTestCase::EpcTftClassifierUpdateTestCase()
+    : TestCase("classification of a flow after the TFTs changed")
+{
+}
+
+void
+EpcTftClassifierUpdateTestCase::DoRun()
+{
+    Ptr<EpcTftClassifier> c = Create<EpcTftClassifier>();
+    c->Add(EpcTft::Default(), 1);
+    Ptr<EpcTft> tft = Create<EpcTft>();
+    EpcTft::PacketFilter pf;
+    pf.localPortStart = 4000;
+    pf.localPortEnd = 4000;
+    tft->Add(pf);
+    c->Add(tft, 2);
+
+    UdpHeader udpHeader;
+    udpHeader.SetSourcePort(9);
+    udpHeader.SetDestinationPort(4000);
+    Ipv4Header ipHeader;
+    ipHeader.SetSource(Ipv4Address("9.1.1.1"));
+    ipHeader.SetDestination(Ipv4Address("8.1.1.1"));
+    ipHeader.SetPayloadSize(8);
+    ipHeader.SetProtocol(UdpL4Protocol::PROT_NUMBER);
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(udpHeader);
+    packet->AddHeader(ipHeader);
+
+    NS_TEST_ASSERT_MSG_EQ(c->Classify(packet, EpcTft::DOWNLINK, Ipv4L3Protocol::PROT_NUMBER),
+                          2,
+                          "bad classification of the first packet");
+    NS_TEST_ASSERT_MSG_EQ(c->Classify(packet, EpcTft::DOWNLINK, Ipv4L3Protocol::PROT_NUMBER),
+                          2,
+                          "bad classification of the second packet of the flow");
+    c->Delete(2);
+    NS_TEST_ASSERT_MSG_EQ(c->Classify(packet, EpcTft::DOWNLINK, Ipv4L3Protocol::PROT_NUMBER),
+                          1,
+                          "bad classification after the TFT was deleted");
+    c->Add(tft, 3);
+    NS_TEST_ASSERT_MSG_EQ(c->Classify(packet, EpcTft::DOWNLINK, Ipv4L3Protocol::PROT_NUMBER),
+                          3,
+                          "bad classification after the TFT was added again");
+}
+
 /**
  * \ingroup lte-test
  *
@@ -1015,4 +1075,6 @@ EpcTftClassifierTestSuite::EpcTftClassifierTestSuite()
                                                  useIpv6),
                     TestCase::QUICK);
     }
+
+    AddTestCase(new EpcTftClassifierUpdateTestCase, TestCase::QUICK);
 }
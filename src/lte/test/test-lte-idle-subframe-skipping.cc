@@ -0,0 +1,533 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/boolean.h>
+#include <ns3/callback.h>
+#include <ns3/config.h>
+#include <ns3/data-rate.h>
+#include <ns3/internet-stack-helper.h>
+#include <ns3/ipv4-address-helper.h>
+#include <ns3/ipv4-static-routing-helper.h>
+#include <ns3/ipv4-static-routing.h>
+#include <ns3/log.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-ue-mac.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-phy-sap.h>
+#include <ns3/lte-ue-phy.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/nstime.h>
+#include <ns3/point-to-point-epc-helper.h>
+#include <ns3/point-to-point-helper.h>
+#include <ns3/position-allocator.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+#include <ns3/udp-client-server-helper.h>
+#include <ns3/udp-server.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteIdleSubframeSkippingTest");
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Statistics collected by LteIdleSubframeSkippingTestCase in a
+ * single simulation.
+ */
+struct LteIdleSubframeSkippingStats
+{
+    uint32_t rsrpSinrNum{0};       ///< number of RSRP/SINR samples
+    double rsrpSum{0};             ///< sum of the RSRP samples
+    double sinrSum{0};             ///< sum of the SINR samples
+    uint32_t ueMeasurementsNum{0}; ///< number of UE measurement reports
+    double rsrqSum{0};             ///< sum of the RSRQ of the UE measurement reports
+    uint32_t srsSinrNum{0};        ///< number of SRS SINR reports at the eNB
+    double srsSinrSum{0};          ///< sum of the SRS SINR reports at the eNB
+    uint64_t events{0};            ///< number of events executed by the simulator
+};
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Verify that suspending the subframe indications of UEs without
+ * data radio bearer does not change the RSRP/SINR, UE measurements and SRS statistics, and
+ * that it reduces the number of simulation events.
+ */
+class LteIdleSubframeSkippingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param cqiPeriodicity the DL CQI periodicity
+     * \param srsPeriodicity the SRS periodicity
+     */
+    LteIdleSubframeSkippingTestCase(Time cqiPeriodicity, uint32_t srsPeriodicity);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario
+     *
+     * \param skipping the value of the EnableIdleSubframeSkipping attribute
+     * \return the statistics collected during the simulation
+     */
+    LteIdleSubframeSkippingStats RunScenario(bool skipping);
+
+    /**
+     * ReportCurrentCellRsrpSinr trace sink
+     * \param cellId the cell ID
+     * \param rnti the RNTI
+     * \param rsrp the RSRP
+     * \param sinr the SINR
+     * \param componentCarrierId the component carrier ID
+     */
+    void RsrpSinr(uint16_t cellId,
+                  uint16_t rnti,
+                  double rsrp,
+                  double sinr,
+                  uint8_t componentCarrierId);
+    /**
+     * ReportUeMeasurements trace sink
+     * \param rnti the RNTI
+     * \param cellId the cell ID
+     * \param rsrp the RSRP
+     * \param rsrq the RSRQ
+     * \param servingCell true if the cell is the serving cell
+     * \param componentCarrierId the component carrier ID
+     */
+    void UeMeasurements(uint16_t rnti,
+                        uint16_t cellId,
+                        double rsrp,
+                        double rsrq,
+                        bool servingCell,
+                        uint8_t componentCarrierId);
+    /**
+     * ReportUeSinr trace sink
+     * \param cellId the cell ID
+     * \param rnti the RNTI
+     * \param sinr the SINR of the SRS
+     * \param componentCarrierId the component carrier ID
+     */
+    void SrsSinr(uint16_t cellId, uint16_t rnti, double sinr, uint8_t componentCarrierId);
+
+    Time m_cqiPeriodicity;                ///< DL CQI periodicity
+    uint32_t m_srsPeriodicity;            ///< SRS periodicity
+    LteIdleSubframeSkippingStats m_stats; ///< statistics of the current run
+};
+
+LteIdleSubframeSkippingTestCase::LteIdleSubframeSkippingTestCase(Time cqiPeriodicity,
+                                                                 uint32_t srsPeriodicity)
+    : TestCase("Idle subframe skipping, CQI periodicity " +
+               std::to_string(cqiPeriodicity.GetMilliSeconds()) + " ms, SRS periodicity " +
+               std::to_string(srsPeriodicity) + " ms"),
+      m_cqiPeriodicity(cqiPeriodicity),
+      m_srsPeriodicity(srsPeriodicity)
+{
+}
+
+void
+LteIdleSubframeSkippingTestCase::RsrpSinr(uint16_t cellId,
+                                          uint16_t rnti,
+                                          double rsrp,
+                                          double sinr,
+                                          uint8_t componentCarrierId)
+{
+    m_stats.rsrpSinrNum++;
+    m_stats.rsrpSum += rsrp;
+    m_stats.sinrSum += sinr;
+}
+
+void
+LteIdleSubframeSkippingTestCase::UeMeasurements(uint16_t rnti,
+                                                uint16_t cellId,
+                                                double rsrp,
+                                                double rsrq,
+                                                bool servingCell,
+                                                uint8_t componentCarrierId)
+{
+    m_stats.ueMeasurementsNum++;
+    m_stats.rsrqSum += rsrq;
+}
+
+void
+LteIdleSubframeSkippingTestCase::SrsSinr(uint16_t cellId,
+                                         uint16_t rnti,
+                                         double sinr,
+                                         uint8_t componentCarrierId)
+{
+    m_stats.srsSinrNum++;
+    m_stats.srsSinrSum += sinr;
+}
+
+LteIdleSubframeSkippingStats
+LteIdleSubframeSkippingTestCase::RunScenario(bool skipping)
+{
+    Config::Reset();
+    Config::SetDefault("ns3::LteUePhy::EnableIdleSubframeSkipping", BooleanValue(skipping));
+    Config::SetDefault("ns3::LteUePhy::DownlinkCqiPeriodicity", TimeValue(m_cqiPeriodicity));
+    Config::SetDefault("ns3::LteEnbRrc::SrsPeriodicity", UintegerValue(m_srsPeriodicity));
+    m_stats = LteIdleSubframeSkippingStats();
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+
+    NodeContainer enbNodes;
+    enbNodes.Create(1);
+    NodeContainer ueNodes;
+    ueNodes.Create(3);
+
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(100.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(0.0, 300.0, 0.0));
+    positionAlloc->Add(Vector(-600.0, 0.0, 0.0));
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    // no data radio bearer, so that the UEs have nothing to transmit once connected
+    lteHelper->Attach(ueDevs, enbDevs.Get(0));
+
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportCurrentCellRsrpSinr",
+        MakeCallback(&LteIdleSubframeSkippingTestCase::RsrpSinr, this));
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportUeMeasurements",
+        MakeCallback(&LteIdleSubframeSkippingTestCase::UeMeasurements, this));
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportUeSinr",
+        MakeCallback(&LteIdleSubframeSkippingTestCase::SrsSinr, this));
+
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    m_stats.events = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    return m_stats;
+}
+
+void
+LteIdleSubframeSkippingTestCase::DoRun()
+{
+    LteIdleSubframeSkippingStats alwaysOn = RunScenario(false);
+    LteIdleSubframeSkippingStats skipping = RunScenario(true);
+
+    NS_TEST_ASSERT_MSG_GT(alwaysOn.rsrpSinrNum, 0, "no RSRP/SINR sample");
+    NS_TEST_ASSERT_MSG_GT(alwaysOn.ueMeasurementsNum, 0, "no UE measurement report");
+    NS_TEST_ASSERT_MSG_GT(alwaysOn.srsSinrNum, 0, "no SRS SINR report");
+
+    NS_TEST_ASSERT_MSG_EQ(skipping.rsrpSinrNum,
+                          alwaysOn.rsrpSinrNum,
+                          "wrong number of RSRP/SINR samples");
+    NS_TEST_ASSERT_MSG_EQ_TOL(skipping.rsrpSum,
+                              alwaysOn.rsrpSum,
+                              std::abs(alwaysOn.rsrpSum) * 1e-9,
+                              "wrong RSRP samples");
+    NS_TEST_ASSERT_MSG_EQ_TOL(skipping.sinrSum,
+                              alwaysOn.sinrSum,
+                              std::abs(alwaysOn.sinrSum) * 1e-9,
+                              "wrong SINR samples");
+    NS_TEST_ASSERT_MSG_EQ(skipping.ueMeasurementsNum,
+                          alwaysOn.ueMeasurementsNum,
+                          "wrong number of UE measurement reports");
+    NS_TEST_ASSERT_MSG_EQ_TOL(skipping.rsrqSum,
+                              alwaysOn.rsrqSum,
+                              std::abs(alwaysOn.rsrqSum) * 1e-9,
+                              "wrong UE measurement reports");
+    NS_TEST_ASSERT_MSG_EQ(skipping.srsSinrNum,
+                          alwaysOn.srsSinrNum,
+                          "wrong number of SRS SINR reports");
+    NS_TEST_ASSERT_MSG_EQ_TOL(skipping.srsSinrSum,
+                              alwaysOn.srsSinrSum,
+                              std::abs(alwaysOn.srsSinrSum) * 1e-9,
+                              "wrong SRS SINR reports");
+    NS_TEST_ASSERT_MSG_LT(skipping.events,
+                          alwaysOn.events,
+                          "idle UEs did not skip any subframe");
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief LteUePhySapUser inserted between the PHY and the MAC of a UE,
+ * checking the frame and subframe numbers of the subframe indications
+ * delivered to the MAC.
+ */
+class LteIdleSubframeSkippingPhySapUser : public LteUePhySapUser
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param macSapUser the SAP user of the MAC
+     */
+    LteIdleSubframeSkippingPhySapUser(LteUePhySapUser* macSapUser);
+
+    void ReceivePhyPdu(Ptr<Packet> p) override;
+    void SubframeIndication(uint32_t frameNo, uint32_t subframeNo) override;
+    void ReceiveLteControlMessage(Ptr<LteControlMessage> msg) override;
+    bool NeedsSubframeIndication() override;
+
+    uint32_t m_indications{0};      ///< number of subframe indications
+    uint32_t m_wrongIndications{0}; ///< number of indications with wrong numbers
+    uint32_t m_lastIndex{0};        ///< index of the last indicated subframe, plus one
+
+  private:
+    LteUePhySapUser* m_macSapUser; ///< the SAP user of the MAC
+};
+
+LteIdleSubframeSkippingPhySapUser::LteIdleSubframeSkippingPhySapUser(
+    LteUePhySapUser* macSapUser)
+    : m_macSapUser(macSapUser)
+{
+}
+
+void
+LteIdleSubframeSkippingPhySapUser::ReceivePhyPdu(Ptr<Packet> p)
+{
+    m_macSapUser->ReceivePhyPdu(p);
+}
+
+void
+LteIdleSubframeSkippingPhySapUser::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
+{
+    // the subframe indications start at frame 1, subframe 1 at time 0
+    uint32_t index = Simulator::Now().GetMilliSeconds();
+    m_indications++;
+    if (frameNo != index / 10 + 1 || subframeNo != index % 10 + 1 || index + 1 <= m_lastIndex)
+    {
+        NS_LOG_ERROR("subframe indication " << frameNo << "/" << subframeNo << " at "
+                                            << Simulator::Now().As(Time::MS));
+        m_wrongIndications++;
+    }
+    m_lastIndex = index + 1;
+    m_macSapUser->SubframeIndication(frameNo, subframeNo);
+}
+
+void
+LteIdleSubframeSkippingPhySapUser::ReceiveLteControlMessage(Ptr<LteControlMessage> msg)
+{
+    m_macSapUser->ReceiveLteControlMessage(msg);
+}
+
+bool
+LteIdleSubframeSkippingPhySapUser::NeedsSubframeIndication()
+{
+    return m_macSapUser->NeedsSubframeIndication();
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Verify that UEs which suspended their subframe indications wake up
+ * for DL and UL traffic.
+ *
+ * After an idle period, a remote host sends a few DL packets to a UE and
+ * another UE sends a few UL packets to the remote host, with long enough
+ * intervals for the UEs to suspend their subframe indications between two
+ * packets. The UEs are thus woken up by DL data arrivals and by new data in
+ * the RLC buffers, which are followed by the UL grants.  All the packets
+ * must be delivered, and the frame and subframe numbers given to the MAC
+ * must be those of the current subframe.
+ */
+class LteIdleSubframeSkippingTrafficTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param skipping the value of the EnableIdleSubframeSkipping attribute
+     */
+    LteIdleSubframeSkippingTrafficTestCase(bool skipping);
+
+  private:
+    void DoRun() override;
+
+    bool m_skipping; ///< the value of the EnableIdleSubframeSkipping attribute
+};
+
+LteIdleSubframeSkippingTrafficTestCase::LteIdleSubframeSkippingTrafficTestCase(bool skipping)
+    : TestCase(std::string("Traffic after an idle period, idle subframe skipping ") +
+               (skipping ? "enabled" : "disabled")),
+      m_skipping(skipping)
+{
+}
+
+void
+LteIdleSubframeSkippingTrafficTestCase::DoRun()
+{
+    const uint32_t numPackets = 5;
+    const Time simTime = Seconds(2);
+
+    Config::Reset();
+    Config::SetDefault("ns3::LteUePhy::EnableIdleSubframeSkipping", BooleanValue(m_skipping));
+    // DL CQIs reported every subframe would keep the UEs awake
+    Config::SetDefault("ns3::LteUePhy::DownlinkCqiPeriodicity", TimeValue(MilliSeconds(40)));
+    Config::SetDefault("ns3::LteEnbRrc::SrsPeriodicity", UintegerValue(80));
+    Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue(false));
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    Ptr<PointToPointEpcHelper> epcHelper = CreateObject<PointToPointEpcHelper>();
+    lteHelper->SetEpcHelper(epcHelper);
+
+    NodeContainer remoteHostContainer;
+    remoteHostContainer.Create(1);
+    Ptr<Node> remoteHost = remoteHostContainer.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHostContainer);
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("1Gb/s")));
+    p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(1)));
+    NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4InterfaceContainer internetIpIfaces = ipv4h.Assign(internetDevices);
+    Ipv4Address remoteHostAddr = internetIpIfaces.GetAddress(1);
+    Ipv4StaticRoutingHelper ipv4RoutingHelper;
+    Ptr<Ipv4StaticRouting> remoteHostStaticRouting =
+        ipv4RoutingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>());
+    remoteHostStaticRouting->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    NodeContainer enbNodes;
+    enbNodes.Create(1);
+    NodeContainer ueNodes;
+    ueNodes.Create(2);
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(100.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(0.0, 200.0, 0.0));
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+    for (uint32_t u = 0; u < ueNodes.GetN(); ++u)
+    {
+        Ptr<Ipv4StaticRouting> ueStaticRouting =
+            ipv4RoutingHelper.GetStaticRouting(ueNodes.Get(u)->GetObject<Ipv4>());
+        ueStaticRouting->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+    }
+    lteHelper->Attach(ueDevs, enbDevs.Get(0));
+
+    std::vector<LteIdleSubframeSkippingPhySapUser*> sapUsers;
+    for (uint32_t u = 0; u < ueDevs.GetN(); ++u)
+    {
+        Ptr<LteUeNetDevice> ueDev = ueDevs.Get(u)->GetObject<LteUeNetDevice>();
+        sapUsers.push_back(
+            new LteIdleSubframeSkippingPhySapUser(ueDev->GetMac()->GetLteUePhySapUser()));
+        ueDev->GetPhy()->SetLteUePhySapUser(sapUsers.back());
+    }
+
+    // the UEs are idle for a while after the connection establishment, and
+    // between two packets
+    const uint16_t dlPort = 1000;
+    UdpServerHelper dlServer(dlPort);
+    ApplicationContainer dlServerApps = dlServer.Install(ueNodes.Get(0));
+    UdpClientHelper dlClient(ueIpIfaces.GetAddress(0), dlPort);
+    dlClient.SetAttribute("MaxPackets", UintegerValue(numPackets));
+    dlClient.SetAttribute("Interval", TimeValue(MilliSeconds(200)));
+    dlClient.SetAttribute("PacketSize", UintegerValue(200));
+    ApplicationContainer dlClientApps = dlClient.Install(remoteHost);
+    dlClientApps.Start(Seconds(0.6));
+
+    const uint16_t ulPort = 2000;
+    UdpServerHelper ulServer(ulPort);
+    ApplicationContainer ulServerApps = ulServer.Install(remoteHost);
+    UdpClientHelper ulClient(remoteHostAddr, ulPort);
+    ulClient.SetAttribute("MaxPackets", UintegerValue(numPackets));
+    ulClient.SetAttribute("Interval", TimeValue(MilliSeconds(200)));
+    ulClient.SetAttribute("PacketSize", UintegerValue(200));
+    ApplicationContainer ulClientApps = ulClient.Install(ueNodes.Get(1));
+    ulClientApps.Start(Seconds(0.65));
+
+    Simulator::Stop(simTime);
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(DynamicCast<UdpServer>(dlServerApps.Get(0))->GetReceived(),
+                          numPackets,
+                          "DL packets not delivered");
+    NS_TEST_EXPECT_MSG_EQ(DynamicCast<UdpServer>(ulServerApps.Get(0))->GetReceived(),
+                          numPackets,
+                          "UL packets not delivered");
+    for (uint32_t u = 0; u < sapUsers.size(); ++u)
+    {
+        NS_TEST_EXPECT_MSG_EQ(sapUsers[u]->m_wrongIndications,
+                              0,
+                              "wrong subframe indications at UE " << u);
+        uint32_t subframes = simTime.GetMilliSeconds();
+        if (m_skipping)
+        {
+            NS_TEST_EXPECT_MSG_LT(sapUsers[u]->m_indications,
+                                  subframes / 2,
+                                  "UE " << u << " did not skip idle subframes");
+        }
+        else
+        {
+            NS_TEST_EXPECT_MSG_EQ(sapUsers[u]->m_indications,
+                                  subframes,
+                                  "UE " << u << " skipped subframes");
+        }
+    }
+
+    Simulator::Destroy();
+    for (auto sapUser : sapUsers)
+    {
+        delete sapUser;
+    }
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite for the suspension of the subframe indications of idle UEs.
+ */
+class LteIdleSubframeSkippingTestSuite : public TestSuite
+{
+  public:
+    LteIdleSubframeSkippingTestSuite();
+};
+
+LteIdleSubframeSkippingTestSuite::LteIdleSubframeSkippingTestSuite()
+    : TestSuite("lte-idle-subframe-skipping", SYSTEM)
+{
+    AddTestCase(new LteIdleSubframeSkippingTestCase(MilliSeconds(10), 40), TestCase::QUICK);
+    AddTestCase(new LteIdleSubframeSkippingTestCase(MilliSeconds(40), 80), TestCase::QUICK);
+    AddTestCase(new LteIdleSubframeSkippingTrafficTestCase(false), TestCase::QUICK);
+    AddTestCase(new LteIdleSubframeSkippingTrafficTestCase(true), TestCase::QUICK);
+}
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteIdleSubframeSkippingTestSuite g_lteIdleSubframeSkippingTestSuite;
@@ -0,0 +1,342 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/boolean.h>
+#include <ns3/callback.h>
+#include <ns3/config.h>
+#include <ns3/data-rate.h>
+#include <ns3/eps-bearer.h>
+#include <ns3/inet-socket-address.h>
+#include <ns3/internet-stack-helper.h>
+#include <ns3/ipv4-address-helper.h>
+#include <ns3/ipv4-static-routing-helper.h>
+#include <ns3/ipv4-static-routing.h>
+#include <ns3/log.h>
+#include <ns3/lte-common.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-enb-rrc.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-rrc.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/nstime.h>
+#include <ns3/packet-sink-helper.h>
+#include <ns3/packet-sink.h>
+#include <ns3/point-to-point-epc-helper.h>
+#include <ns3/point-to-point-helper.h>
+#include <ns3/position-allocator.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+#include <ns3/udp-echo-helper.h>
+#include <ns3/uinteger.h>
+
+#include <map>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LtePreAttachTest");
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Verify that the UEs attached with LteHelper::PreAttach are connected
+ * from the beginning of the simulation, without random access, with all
+ * their bearers, and that they can exchange data with the eNB (and, if the
+ * EPC is used, with a remote host) right away.
+ */
+class LtePreAttachTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param useEpc whether the EPC is used
+     * \param useIdealRrc the value of the LteHelper UseIdealRrc attribute
+     */
+    LtePreAttachTestCase(bool useEpc, bool useIdealRrc);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * RandomAccessSuccessful trace sink
+     * \param imsi the IMSI
+     * \param cellId the cell ID
+     * \param rnti the RNTI
+     */
+    void RandomAccessSuccessful(uint64_t imsi, uint16_t cellId, uint16_t rnti);
+    /**
+     * UE ConnectionEstablished trace sink
+     * \param imsi the IMSI
+     * \param cellId the cell ID
+     * \param rnti the RNTI
+     */
+    void UeConnectionEstablished(uint64_t imsi, uint16_t cellId, uint16_t rnti);
+    /**
+     * UE DrbCreated trace sink
+     * \param imsi the IMSI
+     * \param cellId the cell ID
+     * \param rnti the RNTI
+     * \param lcid the logical channel ID
+     */
+    void DrbCreated(uint64_t imsi, uint16_t cellId, uint16_t rnti, uint8_t lcid);
+    /**
+     * DlScheduling trace sink
+     * \param dlInfo the DL scheduling information
+     */
+    void DlScheduling(DlSchedulingCallbackInfo dlInfo);
+
+    bool m_useEpc;                                ///< whether the EPC is used
+    bool m_useIdealRrc;                           ///< whether the ideal RRC protocol is used
+    uint32_t m_randomAccessNum;                   ///< number of successful random accesses
+    uint32_t m_connectionEstablishedNum;          ///< number of UE connection establishments
+    std::map<uint64_t, uint32_t> m_drbNum;        ///< number of DRBs created, by IMSI
+    std::map<uint16_t, uint64_t> m_dlBytesByRnti; ///< bytes scheduled in DL, by RNTI
+};
+
+LtePreAttachTestCase::LtePreAttachTestCase(bool useEpc, bool useIdealRrc)
+    : TestCase(std::string("Pre-attach, ") + (useEpc ? "EPC" : "no EPC") + ", " +
+               (useIdealRrc ? "ideal" : "real") + " RRC"),
+      m_useEpc(useEpc),
+      m_useIdealRrc(useIdealRrc),
+      m_randomAccessNum(0),
+      m_connectionEstablishedNum(0)
+{
+}
+
+void
+LtePreAttachTestCase::RandomAccessSuccessful(uint64_t imsi, uint16_t cellId, uint16_t rnti)
+{
+    m_randomAccessNum++;
+}
+
+void
+LtePreAttachTestCase::UeConnectionEstablished(uint64_t imsi, uint16_t cellId, uint16_t rnti)
+{
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(0), "UE connected after time zero");
+    m_connectionEstablishedNum++;
+}
+
+void
+LtePreAttachTestCase::DrbCreated(uint64_t imsi, uint16_t cellId, uint16_t rnti, uint8_t lcid)
+{
+    m_drbNum[imsi]++;
+}
+
+void
+LtePreAttachTestCase::DlScheduling(DlSchedulingCallbackInfo dlInfo)
+{
+    m_dlBytesByRnti[dlInfo.rnti] += dlInfo.sizeTb1 + dlInfo.sizeTb2;
+}
+
+void
+LtePreAttachTestCase::DoRun()
+{
+    Config::Reset();
+    Config::SetDefault("ns3::LteHelper::UseIdealRrc", BooleanValue(m_useIdealRrc));
+    Config::SetDefault("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue(false));
+
+    const uint32_t nUes = 3;
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    Ptr<PointToPointEpcHelper> epcHelper;
+    Ptr<Node> remoteHost;
+    Ipv4Address remoteHostAddr;
+    Ipv4StaticRoutingHelper ipv4RoutingHelper;
+    InternetStackHelper internet;
+    if (m_useEpc)
+    {
+        epcHelper = CreateObject<PointToPointEpcHelper>();
+        lteHelper->SetEpcHelper(epcHelper);
+
+        NodeContainer remoteHostContainer;
+        remoteHostContainer.Create(1);
+        remoteHost = remoteHostContainer.Get(0);
+        internet.Install(remoteHostContainer);
+
+        PointToPointHelper p2ph;
+        p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+        p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(10)));
+        NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+        Ipv4AddressHelper ipv4h;
+        ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+        Ipv4InterfaceContainer internetIpIfaces = ipv4h.Assign(internetDevices);
+        remoteHostAddr = internetIpIfaces.GetAddress(1);
+
+        Ptr<Ipv4StaticRouting> remoteHostStaticRouting =
+            ipv4RoutingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>());
+        remoteHostStaticRouting->AddNetworkRouteTo(Ipv4Address("7.0.0.0"),
+                                                   Ipv4Mask("255.0.0.0"),
+                                                   1);
+    }
+
+    NodeContainer enbNodes;
+    enbNodes.Create(1);
+    NodeContainer ueNodes;
+    ueNodes.Create(nUes);
+
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(100.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(0.0, 200.0, 0.0));
+    positionAlloc->Add(Vector(-300.0, 0.0, 0.0));
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+
+    std::vector<Ptr<PacketSink>> dlSinks;
+    std::vector<Ptr<PacketSink>> ulSinks;
+    if (m_useEpc)
+    {
+        internet.Install(ueNodes);
+        Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+        lteHelper->PreAttach(ueDevs, enbDevs.Get(0));
+
+        uint16_t dlPort = 1000;
+        uint16_t ulPort = 2000;
+        for (uint32_t u = 0; u < nUes; ++u)
+        {
+            Ptr<Node> ue = ueNodes.Get(u);
+            Ptr<Ipv4StaticRouting> ueStaticRouting =
+                ipv4RoutingHelper.GetStaticRouting(ue->GetObject<Ipv4>());
+            ueStaticRouting->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+
+            // the downlink traffic goes over a dedicated bearer activated after
+            // the UE is pre-attached, the uplink one over the default bearer
+            ++dlPort;
+            ++ulPort;
+            Ptr<EpcTft> tft = Create<EpcTft>();
+            EpcTft::PacketFilter dlpf;
+            dlpf.localPortStart = dlPort;
+            dlpf.localPortEnd = dlPort;
+            tft->Add(dlpf);
+            lteHelper->ActivateDedicatedEpsBearer(ueDevs.Get(u),
+                                                  EpsBearer(EpsBearer::NGBR_VOICE_VIDEO_GAMING),
+                                                  tft);
+
+            PacketSinkHelper dlSinkHelper("ns3::UdpSocketFactory",
+                                          InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+            ApplicationContainer apps = dlSinkHelper.Install(ue);
+            dlSinks.push_back(apps.Get(0)->GetObject<PacketSink>());
+            UdpEchoClientHelper dlClient(ueIpIfaces.GetAddress(u), dlPort);
+            dlClient.SetAttribute("MaxPackets", UintegerValue(10));
+            dlClient.SetAttribute("Interval", TimeValue(MilliSeconds(10)));
+            dlClient.SetAttribute("PacketSize", UintegerValue(100));
+            apps = dlClient.Install(remoteHost);
+            apps.Start(MilliSeconds(10));
+
+            PacketSinkHelper ulSinkHelper("ns3::UdpSocketFactory",
+                                          InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+            apps = ulSinkHelper.Install(remoteHost);
+            ulSinks.push_back(apps.Get(0)->GetObject<PacketSink>());
+            UdpEchoClientHelper ulClient(remoteHostAddr, ulPort);
+            ulClient.SetAttribute("MaxPackets", UintegerValue(10));
+            ulClient.SetAttribute("Interval", TimeValue(MilliSeconds(10)));
+            ulClient.SetAttribute("PacketSize", UintegerValue(100));
+            apps = ulClient.Install(ue);
+            apps.Start(MilliSeconds(10));
+        }
+    }
+    else
+    {
+        lteHelper->PreAttach(ueDevs, enbDevs.Get(0));
+        lteHelper->ActivateDataRadioBearer(ueDevs, EpsBearer(EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+    }
+
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/LteUeRrc/RandomAccessSuccessful",
+        MakeCallback(&LtePreAttachTestCase::RandomAccessSuccessful, this));
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/LteUeRrc/ConnectionEstablished",
+        MakeCallback(&LtePreAttachTestCase::UeConnectionEstablished, this));
+    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/LteUeRrc/DrbCreated",
+                                  MakeCallback(&LtePreAttachTestCase::DrbCreated, this));
+    Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/"
+                                  "DlScheduling",
+                                  MakeCallback(&LtePreAttachTestCase::DlScheduling, this));
+
+    Simulator::Stop(Seconds(0.3));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_randomAccessNum, 0, "pre-attached UEs performed the random access");
+    NS_TEST_ASSERT_MSG_EQ(m_connectionEstablishedNum, nUes, "wrong number of connected UEs");
+
+    Ptr<LteEnbRrc> enbRrc = enbDevs.Get(0)->GetObject<LteEnbNetDevice>()->GetRrc();
+    for (uint32_t u = 0; u < nUes; ++u)
+    {
+        Ptr<LteUeNetDevice> ueDev = ueDevs.Get(u)->GetObject<LteUeNetDevice>();
+        Ptr<LteUeRrc> ueRrc = ueDev->GetRrc();
+        NS_TEST_ASSERT_MSG_EQ(ueRrc->GetState(),
+                              LteUeRrc::CONNECTED_NORMALLY,
+                              "wrong UE RRC state");
+        NS_TEST_ASSERT_MSG_EQ(ueRrc->GetCellId(),
+                              enbDevs.Get(0)->GetObject<LteEnbNetDevice>()->GetCellId(),
+                              "wrong serving cell");
+        NS_TEST_ASSERT_MSG_EQ(enbRrc->HasUeManager(ueRrc->GetRnti()),
+                              true,
+                              "no UE context at the eNB");
+        NS_TEST_ASSERT_MSG_EQ(enbRrc->GetUeManager(ueRrc->GetRnti())->GetState(),
+                              UeManager::CONNECTED_NORMALLY,
+                              "wrong UE context state at the eNB");
+        NS_TEST_ASSERT_MSG_EQ(m_drbNum[ueDev->GetImsi()],
+                              (m_useEpc ? 2 : 1),
+                              "wrong number of DRBs at the UE");
+        NS_TEST_ASSERT_MSG_GT(m_dlBytesByRnti[ueRrc->GetRnti()],
+                              0,
+                              "no data scheduled in DL to the UE");
+        if (m_useEpc)
+        {
+            NS_TEST_ASSERT_MSG_EQ(dlSinks.at(u)->GetTotalRx(), 10 * 100, "wrong DL data");
+            NS_TEST_ASSERT_MSG_EQ(ulSinks.at(u)->GetTotalRx(), 10 * 100, "wrong UL data");
+        }
+    }
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite for the attachment of UEs without signaling.
+ */
+class LtePreAttachTestSuite : public TestSuite
+{
+  public:
+    LtePreAttachTestSuite();
+};
+
+LtePreAttachTestSuite::LtePreAttachTestSuite()
+    : TestSuite("lte-pre-attach", SYSTEM)
+{
+    AddTestCase(new LtePreAttachTestCase(false, true), TestCase::QUICK);
+    AddTestCase(new LtePreAttachTestCase(false, false), TestCase::QUICK);
+    AddTestCase(new LtePreAttachTestCase(true, true), TestCase::QUICK);
+    AddTestCase(new LtePreAttachTestCase(true, false), TestCase::QUICK);
+}
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LtePreAttachTestSuite g_ltePreAttachTestSuite;
@@ -0,0 +1,260 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <ns3/boolean.h>
+#include <ns3/config.h>
+#include <ns3/double.h>
+#include <ns3/lte-helper.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/net-device-container.h>
+#include <ns3/node-container.h>
+#include <ns3/pointer.h>
+#include <ns3/position-allocator.h>
+#include <ns3/radio-environment-map-helper.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+#include <ns3/test.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Base class of the RadioEnvironmentMapHelper tests, generating the
+ * REM of a scenario with two eNBs.
+ */
+class LteRadioEnvironmentMapTestCaseBase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param name the name of the test case
+     */
+    LteRadioEnvironmentMapTestCaseBase(std::string name);
+
+  protected:
+    /**
+     * Generate a REM of the scenario
+     *
+     * \param fileName the name of the output file
+     * \param directComputation the value of the DirectComputation attribute
+     * \param resumeOutput the value of the ResumeOutput attribute
+     */
+    void GenerateRem(std::string fileName, bool directComputation, bool resumeOutput);
+
+    /**
+     * \param fileName the name of the file
+     * \return the lines of the file
+     */
+    std::vector<std::string> ReadLines(std::string fileName);
+};
+
+LteRadioEnvironmentMapTestCaseBase::LteRadioEnvironmentMapTestCaseBase(std::string name)
+    : TestCase(name)
+{
+}
+
+void
+LteRadioEnvironmentMapTestCaseBase::GenerateRem(std::string fileName,
+                                                bool directComputation,
+                                                bool resumeOutput)
+{
+    Config::Reset();
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+
+    NodeContainer enbNodes;
+    enbNodes.Create(2);
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(-100.0, 0.0, 10.0));
+    positionAlloc->Add(Vector(150.0, 50.0, 10.0));
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    lteHelper->InstallEnbDevice(enbNodes);
+
+    Ptr<RadioEnvironmentMapHelper> remHelper = CreateObject<RadioEnvironmentMapHelper>();
+    remHelper->SetAttribute("Channel", PointerValue(lteHelper->GetDownlinkSpectrumChannel()));
+    remHelper->SetAttribute("OutputFile", StringValue(fileName));
+    remHelper->SetAttribute("XMin", DoubleValue(-300.0));
+    remHelper->SetAttribute("XMax", DoubleValue(300.0));
+    remHelper->SetAttribute("XRes", UintegerValue(7));
+    remHelper->SetAttribute("YMin", DoubleValue(-200.0));
+    remHelper->SetAttribute("YMax", DoubleValue(200.0));
+    remHelper->SetAttribute("YRes", UintegerValue(5));
+    // several iterations in the iterative mode
+    remHelper->SetAttribute("MaxPointsPerIteration", UintegerValue(8));
+    remHelper->SetAttribute("DirectComputation", BooleanValue(directComputation));
+    remHelper->SetAttribute("ResumeOutput", BooleanValue(resumeOutput));
+    remHelper->Install();
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+std::vector<std::string>
+LteRadioEnvironmentMapTestCaseBase::ReadLines(std::string fileName)
+{
+    std::vector<std::string> lines;
+    std::ifstream inFile(fileName);
+    std::string line;
+    while (std::getline(inFile, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Verify that the REM computed directly matches the REM generated
+ * through the channel.
+ */
+class LteRadioEnvironmentMapDirectTestCase : public LteRadioEnvironmentMapTestCaseBase
+{
+  public:
+    LteRadioEnvironmentMapDirectTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteRadioEnvironmentMapDirectTestCase::LteRadioEnvironmentMapDirectTestCase()
+    : LteRadioEnvironmentMapTestCaseBase("REM computed directly matches the iterative REM")
+{
+}
+
+void
+LteRadioEnvironmentMapDirectTestCase::DoRun()
+{
+    std::string iterativeFile = CreateTempDirFilename("rem-iterative.out");
+    std::string directFile = CreateTempDirFilename("rem-direct.out");
+    GenerateRem(iterativeFile, false, false);
+    GenerateRem(directFile, true, false);
+
+    std::vector<std::string> iterative = ReadLines(iterativeFile);
+    std::vector<std::string> direct = ReadLines(directFile);
+    NS_TEST_ASSERT_MSG_EQ(iterative.size(), 7 * 5, "wrong number of points in the iterative REM");
+    NS_TEST_ASSERT_MSG_EQ(direct.size(), iterative.size(), "wrong number of points");
+    for (std::size_t i = 0; i < iterative.size(); ++i)
+    {
+        std::istringstream iterativeLine(iterative[i]);
+        std::istringstream directLine(direct[i]);
+        double x1;
+        double y1;
+        double z1;
+        double sinr1;
+        double x2;
+        double y2;
+        double z2;
+        double sinr2;
+        iterativeLine >> x1 >> y1 >> z1 >> sinr1;
+        directLine >> x2 >> y2 >> z2 >> sinr2;
+        NS_TEST_EXPECT_MSG_EQ(x2, x1, "wrong X coordinate of point " << i);
+        NS_TEST_EXPECT_MSG_EQ(y2, y1, "wrong Y coordinate of point " << i);
+        NS_TEST_EXPECT_MSG_EQ(z2, z1, "wrong Z coordinate of point " << i);
+        NS_TEST_EXPECT_MSG_GT(sinr1, 0, "no signal at point " << i);
+        NS_TEST_EXPECT_MSG_EQ_TOL(sinr2, sinr1, sinr1 * 1e-5, "wrong SINR at point " << i);
+    }
+
+    std::remove(iterativeFile.c_str());
+    std::remove(directFile.c_str());
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Verify that resuming the direct computation of a REM from a
+ * partial output file, ending with an incomplete line, produces the same
+ * file as an uninterrupted computation.
+ */
+class LteRadioEnvironmentMapResumeTestCase : public LteRadioEnvironmentMapTestCaseBase
+{
+  public:
+    LteRadioEnvironmentMapResumeTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteRadioEnvironmentMapResumeTestCase::LteRadioEnvironmentMapResumeTestCase()
+    : LteRadioEnvironmentMapTestCaseBase("REM resumed from a partial output file")
+{
+}
+
+void
+LteRadioEnvironmentMapResumeTestCase::DoRun()
+{
+    std::string completeFile = CreateTempDirFilename("rem-complete.out");
+    std::string resumedFile = CreateTempDirFilename("rem-resumed.out");
+    GenerateRem(completeFile, true, false);
+    std::vector<std::string> complete = ReadLines(completeFile);
+    NS_TEST_ASSERT_MSG_EQ(complete.size(), 7 * 5, "wrong number of points");
+
+    // interrupted in the middle of the 13th point
+    {
+        std::ofstream partial(resumedFile);
+        for (std::size_t i = 0; i < 12; ++i)
+        {
+            partial << complete[i] << "\n";
+        }
+        partial << complete[12].substr(0, complete[12].size() / 2);
+    }
+    GenerateRem(resumedFile, true, true);
+
+    std::vector<std::string> resumed = ReadLines(resumedFile);
+    NS_TEST_ASSERT_MSG_EQ(resumed.size(), complete.size(), "wrong number of points");
+    for (std::size_t i = 0; i < complete.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(resumed[i], complete[i], "wrong point " << i);
+    }
+
+    std::remove(completeFile.c_str());
+    std::remove(resumedFile.c_str());
+}
+
+/**
+ * \ingroup lte-test
+ *
+ * \brief Test suite for the RadioEnvironmentMapHelper.
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+  public:
+    LteRadioEnvironmentMapTestSuite();
+};
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite()
+    : TestSuite("lte-radio-environment-map", SYSTEM)
+{
+    AddTestCase(new LteRadioEnvironmentMapDirectTestCase, TestCase::QUICK);
+    AddTestCase(new LteRadioEnvironmentMapResumeTestCase, TestCase::QUICK);
+}
+
+/**
+ * \ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite;
@@ -51,6 +51,8 @@ class LteRrcConnectionEstablishmentTestCase : public TestCase
      * \param useIdealRrc If set to false, real RRC protocol model will be used
      * \param admitRrcConnectionRequest If set to false, eNb will not allow UE connections
      * \param description additional description of the test case
+     * \param skipRrcDecoding If set to true, the real RRC protocol model will not decode
+     * the RRC messages
      */
     LteRrcConnectionEstablishmentTestCase(uint32_t nUes,
                                           uint32_t nBearers,
@@ -60,7 +62,8 @@ class LteRrcConnectionEstablishmentTestCase : public TestCase
                                           bool errorExpected,
                                           bool useIdealRrc,
                                           bool admitRrcConnectionRequest,
-                                          std::string description = "");
+                                          std::string description = "",
+                                          bool skipRrcDecoding = false);
 
   protected:
     void DoRun() override;
@@ -141,6 +144,7 @@ class LteRrcConnectionEstablishmentTestCase : public TestCase
     uint32_t m_delayDiscEnd; ///< expected duration to complete disconnection in ms
     bool m_useIdealRrc;      ///< If set to false, real RRC protocol model will be used
     bool m_admitRrcConnectionRequest; ///< If set to false, eNb will not allow UE connections
+    bool m_skipRrcDecoding;           ///< If set to true, the real RRC messages are not decoded
     Ptr<LteHelper> m_lteHelper;       ///< LTE helper
 
     /// key: IMSI
@@ -196,7 +200,8 @@ LteRrcConnectionEstablishmentTestCase::LteRrcConnectionEstablishmentTestCase(
     bool errorExpected,
     bool useIdealRrc,
     bool admitRrcConnectionRequest,
-    std::string description)
+    std::string description,
+    bool skipRrcDecoding)
     : TestCase(BuildNameString(nUes,
                                nBearers,
                                tConnBase,
@@ -213,7 +218,8 @@ LteRrcConnectionEstablishmentTestCase::LteRrcConnectionEstablishmentTestCase(
       m_delayDiscStart(delayDiscStart),
       m_delayDiscEnd(10),
       m_useIdealRrc(useIdealRrc),
-      m_admitRrcConnectionRequest(admitRrcConnectionRequest)
+      m_admitRrcConnectionRequest(admitRrcConnectionRequest),
+      m_skipRrcDecoding(skipRrcDecoding)
 {
     NS_LOG_FUNCTION(this << GetName());
 
@@ -295,6 +301,7 @@ LteRrcConnectionEstablishmentTestCase::DoRun()
     // normal code
     m_lteHelper = CreateObject<LteHelper>();
     m_lteHelper->SetAttribute("UseIdealRrc", BooleanValue(m_useIdealRrc));
+    m_lteHelper->SetAttribute("SkipRrcDecoding", BooleanValue(m_skipRrcDecoding));
 
     NodeContainer enbNodes;
     NodeContainer ueNodes;
@@ -875,6 +882,30 @@ LteRrcTestSuite::LteRrcTestSuite()
             TestCase::EXTENSIVE);
     }
 
+    // Test cases with the decoding of the real RRC messages skipped
+    AddTestCase(new LteRrcConnectionEstablishmentTestCase(2,
+                                                          1,
+                                                          20,
+                                                          10,
+                                                          1,
+                                                          false,
+                                                          false,
+                                                          true,
+                                                          "RRC decoding skipped",
+                                                          true),
+                TestCase::QUICK);
+    AddTestCase(new LteRrcConnectionEstablishmentTestCase(20,
+                                                          0,
+                                                          10,
+                                                          1,
+                                                          1,
+                                                          false,
+                                                          false,
+                                                          true,
+                                                          "RRC decoding skipped",
+                                                          true),
+                TestCase::QUICK);
+
     // Test cases with transmission error
     AddTestCase(new LteRrcConnectionEstablishmentErrorTestCase(Seconds(0.020214),
                                                                "failure at RRC Connection Request"),
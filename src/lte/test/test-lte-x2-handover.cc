@@ -61,6 +61,7 @@ class LteX2HandoverTestCase : public TestCase
      * \param schedulerType the scheduler type
      * \param admitHo
      * \param useIdealRrc true if the ideal RRC should be used
+     * \param skipRrcDecoding true if the real RRC messages should not be decoded
      */
     LteX2HandoverTestCase(uint32_t nUes,
                           uint32_t nDedicatedBearers,
@@ -68,7 +69,8 @@ class LteX2HandoverTestCase : public TestCase
                           std::string handoverEventListName,
                           std::string schedulerType,
                           bool admitHo,
-                          bool useIdealRrc);
+                          bool useIdealRrc,
+                          bool skipRrcDecoding = false);
 
   private:
     /**
@@ -79,6 +81,7 @@ class LteX2HandoverTestCase : public TestCase
      * \param schedulerType the scheduler type
      * \param admitHo
      * \param useIdealRrc true if the ideal RRC should be used
+     * \param skipRrcDecoding true if the real RRC messages should not be decoded
      * \returns the name string
      */
     static std::string BuildNameString(uint32_t nUes,
@@ -86,7 +89,8 @@ class LteX2HandoverTestCase : public TestCase
                                        std::string handoverEventListName,
                                        std::string schedulerType,
                                        bool admitHo,
-                                       bool useIdealRrc);
+                                       bool useIdealRrc,
+                                       bool skipRrcDecoding = false);
     void DoRun() override;
     /**
      * Check connected function
@@ -116,6 +120,7 @@ class LteX2HandoverTestCase : public TestCase
     std::string m_schedulerType;                  ///< scheduler type
     bool m_admitHo;                               ///< whether to admit the handover request
     bool m_useIdealRrc;                           ///< whether to use the ideal RRC
+    bool m_skipRrcDecoding;                       ///< whether to skip the RRC decoding
     Ptr<LteHelper> m_lteHelper;                   ///< LTE helper
     Ptr<PointToPointEpcHelper> m_epcHelper;       ///< EPC helper
 
@@ -169,7 +174,8 @@ LteX2HandoverTestCase::BuildNameString(uint32_t nUes,
                                        std::string handoverEventListName,
                                        std::string schedulerType,
                                        bool admitHo,
-                                       bool useIdealRrc)
+                                       bool useIdealRrc,
+                                       bool skipRrcDecoding)
 {
     std::ostringstream oss;
     oss << " nUes=" << nUes << " nDedicatedBearers=" << nDedicatedBearers << " " << schedulerType
@@ -182,6 +188,10 @@ LteX2HandoverTestCase::BuildNameString(uint32_t nUes,
     {
         oss << ", real RRC";
     }
+    if (skipRrcDecoding)
+    {
+        oss << " without decoding";
+    }
     return oss.str();
 }
 
@@ -191,13 +201,15 @@ LteX2HandoverTestCase::LteX2HandoverTestCase(uint32_t nUes,
                                              std::string handoverEventListName,
                                              std::string schedulerType,
                                              bool admitHo,
-                                             bool useIdealRrc)
+                                             bool useIdealRrc,
+                                             bool skipRrcDecoding)
     : TestCase(BuildNameString(nUes,
                                nDedicatedBearers,
                                handoverEventListName,
                                schedulerType,
                                admitHo,
-                               useIdealRrc)),
+                               useIdealRrc,
+                               skipRrcDecoding)),
       m_nUes(nUes),
       m_nDedicatedBearers(nDedicatedBearers),
       m_handoverEventList(handoverEventList),
@@ -206,6 +218,7 @@ LteX2HandoverTestCase::LteX2HandoverTestCase(uint32_t nUes,
       m_schedulerType(schedulerType),
       m_admitHo(admitHo),
       m_useIdealRrc(useIdealRrc),
+      m_skipRrcDecoding(skipRrcDecoding),
       m_maxHoDuration(Seconds(0.1)),
       m_statsDuration(Seconds(0.1)),
       m_udpClientInterval(Seconds(0.01)),
@@ -222,7 +235,8 @@ LteX2HandoverTestCase::DoRun()
                                             m_handoverEventListName,
                                             m_schedulerType,
                                             m_admitHo,
-                                            m_useIdealRrc));
+                                            m_useIdealRrc,
+                                            m_skipRrcDecoding));
 
     uint32_t previousSeed = RngSeedManager::GetSeed();
     uint64_t previousRun = RngSeedManager::GetRun();
@@ -246,6 +260,7 @@ LteX2HandoverTestCase::DoRun()
     m_lteHelper->SetHandoverAlgorithmType(
         "ns3::NoOpHandoverAlgorithm"); // disable automatic handover
     m_lteHelper->SetAttribute("UseIdealRrc", BooleanValue(m_useIdealRrc));
+    m_lteHelper->SetAttribute("SkipRrcDecoding", BooleanValue(m_skipRrcDecoding));
 
     NodeContainer enbNodes;
     enbNodes.Create(2);
@@ -509,6 +524,22 @@ LteX2HandoverTestCase::DoRun()
 
     Simulator::Run();
 
+    if (m_skipRrcDecoding)
+    {
+        // the messages sent before and during the handovers have been received
+        // or dropped with the context of the UE
+        for (uint32_t i = 0; i < enbDevices.GetN(); ++i)
+        {
+            Ptr<LteEnbRrcProtocolReal> rrcProtocol = enbDevices.Get(i)
+                                                         ->GetObject<LteEnbNetDevice>()
+                                                         ->GetRrc()
+                                                         ->GetObject<LteEnbRrcProtocolReal>();
+            NS_TEST_EXPECT_MSG_EQ(rrcProtocol->GetNMessagesInTransit(),
+                                  0,
+                                  "RRC messages left in transit at eNB " << i);
+        }
+    }
+
     Simulator::Destroy();
 
     // Undo changes to default settings
@@ -888,6 +919,26 @@ LteX2HandoverTestSuite::LteX2HandoverTestSuite()
                 TestCase::QUICK);
         }
     }
+
+    // real RRC protocol without the decoding of the messages
+    AddTestCase(new LteX2HandoverTestCase(2,
+                                          1,
+                                          hel3,
+                                          hel3name,
+                                          "ns3::RrFfMacScheduler",
+                                          true,
+                                          false,
+                                          true),
+                TestCase::QUICK);
+    AddTestCase(new LteX2HandoverTestCase(2,
+                                          1,
+                                          hel1,
+                                          hel1name,
+                                          "ns3::PfFfMacScheduler",
+                                          false,
+                                          false,
+                                          true),
+                TestCase::QUICK);
 }
 
 /**
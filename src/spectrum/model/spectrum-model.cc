@@ -22,8 +22,10 @@
 #include <ns3/log.h>
 #include <ns3/spectrum-model.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 
 namespace ns3
 {
@@ -67,6 +69,7 @@ SpectrumModel::SpectrumModel(const std::vector<double>& centerFreqs)
         }
         m_bands.push_back(e);
     }
+    ComputeFrequencyRange();
 }
 
 SpectrumModel::SpectrumModel(const Bands& bands)
@@ -74,6 +77,7 @@ SpectrumModel::SpectrumModel(const Bands& bands)
     m_uid = ++m_uidCount;
     NS_LOG_INFO("creating new SpectrumModel, m_uid=" << m_uid);
     m_bands = bands;
+    ComputeFrequencyRange();
 }
 
 SpectrumModel::SpectrumModel(Bands&& bands)
@@ -81,6 +85,7 @@ SpectrumModel::SpectrumModel(Bands&& bands)
 {
     m_uid = ++m_uidCount;
     NS_LOG_INFO("creating new SpectrumModel, m_uid=" << m_uid);
+    ComputeFrequencyRange();
 }
 
 Bands::const_iterator
@@ -107,9 +112,30 @@ SpectrumModel::GetUid() const
     return m_uid;
 }
 
+void
+SpectrumModel::ComputeFrequencyRange()
+{
+    m_lowestFrequency = std::numeric_limits<double>::max();
+    m_highestFrequency = std::numeric_limits<double>::lowest();
+    for (const auto& band : m_bands)
+    {
+        m_lowestFrequency = std::min(m_lowestFrequency, band.fl);
+        m_highestFrequency = std::max(m_highestFrequency, band.fh);
+    }
+}
+
 bool
 SpectrumModel::IsOrthogonal(const SpectrumModel& other) const
 {
+    // Models whose frequency ranges do not overlap (e.g., the models used on the
+    // different links of a multi-link device) are orthogonal, which can be determined
+    // without checking every pair of bands
+    if (std::max(m_lowestFrequency, other.m_lowestFrequency) >=
+        std::min(m_highestFrequency, other.m_highestFrequency))
+    {
+        return true;
+    }
+
     for (Bands::const_iterator myIt = Begin(); myIt != End(); ++myIt)
     {
         for (Bands::const_iterator otherIt = other.Begin(); otherIt != other.End(); ++otherIt)
@@ -141,8 +141,15 @@ class SpectrumModel : public SimpleRefCount<SpectrumModel>
     bool IsOrthogonal(const SpectrumModel& other) const;
 
   private:
-    Bands m_bands;            //!< Actual definition of frequency bands within this SpectrumModel
-    SpectrumModelUid_t m_uid; //!< unique id for a given set of frequencies
+    /**
+     * Compute the lowest lower limit and the highest upper limit of the bands
+     */
+    void ComputeFrequencyRange();
+
+    Bands m_bands;             //!< Actual definition of frequency bands within this SpectrumModel
+    SpectrumModelUid_t m_uid;  //!< unique id for a given set of frequencies
+    double m_lowestFrequency;  //!< lowest lower limit of the bands
+    double m_highestFrequency; //!< highest upper limit of the bands
     static SpectrumModelUid_t m_uidCount; //!< counter to assign m_uids
 };
 
@@ -22,6 +22,7 @@
 
 #include "ns3/uinteger.h"
 #include <ns3/double.h>
+#include <ns3/enum.h>
 #include <ns3/log.h>
 #include <ns3/mobility-model.h>
 #include <ns3/simulator.h>
@@ -29,7 +30,9 @@
 #include <ns3/string.h>
 #include <ns3/trace-fading-loss-model.h>
 
+#include <algorithm>
 #include <fstream>
+#include <tuple>
 
 namespace ns3
 {
@@ -38,18 +41,87 @@ NS_LOG_COMPONENT_DEFINE("TraceFadingLossModel");
 
 NS_OBJECT_ENSURE_REGISTERED(TraceFadingLossModel);
 
+namespace
+{
+
+/// Number of sinusoids of each component of a tap of a generated trace
+const uint32_t SINUSOIDS_NUM = 16;
+
+/// Bandwidth of an RB (Hz)
+const double RB_BANDWIDTH = 180000;
+
+/// Excess delay (s) and relative power (dB) of a tap of a fading profile
+struct ProfileTap
+{
+    double delay; ///< excess delay (s)
+    double power; ///< relative power (dB)
+};
+
+/// Extended Pedestrian A model (3GPP TS 36.104 Annex B.2)
+const std::vector<ProfileTap> EPA_TAPS = {{0, 0.0},
+                                          {30e-9, -1.0},
+                                          {70e-9, -2.0},
+                                          {90e-9, -3.0},
+                                          {120e-9, -8.0},
+                                          {190e-9, -17.2},
+                                          {410e-9, -20.8}};
+
+/// Extended Vehicular A model (3GPP TS 36.104 Annex B.2)
+const std::vector<ProfileTap> EVA_TAPS = {{0, 0.0},
+                                          {30e-9, -1.5},
+                                          {150e-9, -1.4},
+                                          {310e-9, -3.6},
+                                          {370e-9, -0.6},
+                                          {710e-9, -9.1},
+                                          {1090e-9, -7.0},
+                                          {1730e-9, -12.0},
+                                          {2510e-9, -16.9}};
+
+/// Extended Typical Urban model (3GPP TS 36.104 Annex B.2)
+const std::vector<ProfileTap> ETU_TAPS = {{0, -1.0},
+                                          {50e-9, -1.0},
+                                          {120e-9, -1.0},
+                                          {200e-9, 0.0},
+                                          {230e-9, 0.0},
+                                          {500e-9, 0.0},
+                                          {1600e-9, -3.0},
+                                          {2300e-9, -5.0},
+                                          {5000e-9, -7.0}};
+
+/// Identifies the traces loaded from a file: file name, number of RBs and of samples
+typedef std::tuple<std::string, uint8_t, uint32_t> TraceFileId;
+
+/**
+ * The map is never destroyed, since the traces of the models which are still
+ * alive during the destruction of the static objects erase their entry when
+ * they are freed.
+ *
+ * \return the traces loaded from a file which are still used by at least one
+ * model, so that each file is loaded only once
+ */
+std::map<TraceFileId, std::weak_ptr<const std::vector<float>>>&
+GetLoadedTraces()
+{
+    static auto* loadedTraces = new std::map<TraceFileId, std::weak_ptr<const std::vector<float>>>;
+    return *loadedTraces;
+}
+
+} // namespace
+
 TraceFadingLossModel::TraceFadingLossModel()
-    : m_streamsAssigned(false)
+    : m_windowSamples(0)
 {
     NS_LOG_FUNCTION(this);
     SetNext(nullptr);
+    m_offsetVariable = CreateObject<UniformRandomVariable>();
+    m_phaseVariable = CreateObject<UniformRandomVariable>();
 }
 
 TraceFadingLossModel::~TraceFadingLossModel()
 {
-    m_fadingTrace.clear();
+    m_fadingTrace.reset();
+    m_generatedChunks.clear();
     m_windowOffsetsMap.clear();
-    m_startVariableMap.clear();
 }
 
 TypeId
@@ -74,7 +146,7 @@ TraceFadingLossModel::GetTypeId()
                           "The number of samples the trace is made of (default 10000)",
                           UintegerValue(10000),
                           MakeUintegerAccessor(&TraceFadingLossModel::m_samplesNum),
-                          MakeUintegerChecker<uint32_t>())
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute("WindowSize",
                           "The size of the window for the fading trace (default value 0.5 s.)",
                           TimeValue(Seconds(0.5)),
@@ -85,13 +157,46 @@ TraceFadingLossModel::GetTypeId()
                           UintegerValue(100),
                           MakeUintegerAccessor(&TraceFadingLossModel::m_rbNum),
                           MakeUintegerChecker<uint8_t>())
+            .AddAttribute("Profile",
+                          "The multipath fading profile of the trace generated by the model, "
+                          "or TRACE_FILE to load the trace from TraceFilename.",
+                          EnumValue(TraceFadingLossModel::TRACE_FILE),
+                          MakeEnumAccessor(&TraceFadingLossModel::m_profile),
+                          MakeEnumChecker(TraceFadingLossModel::TRACE_FILE,
+                                          "TRACE_FILE",
+                                          TraceFadingLossModel::EPA,
+                                          "EPA",
+                                          TraceFadingLossModel::EVA,
+                                          "EVA",
+                                          TraceFadingLossModel::ETU,
+                                          "ETU"))
+            .AddAttribute("Speed",
+                          "The speed (m/s) determining the maximum Doppler shift of the "
+                          "generated trace.",
+                          DoubleValue(3.0 / 3.6),
+                          MakeDoubleAccessor(&TraceFadingLossModel::m_speed),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("CarrierFrequency",
+                          "The carrier frequency (Hz) determining the maximum Doppler shift of "
+                          "the generated trace.",
+                          DoubleValue(2160e6),
+                          MakeDoubleAccessor(&TraceFadingLossModel::m_carrierFrequency),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ChunkSize",
+                          "The number of samples of the generated trace computed at once, "
+                          "when one of them is first needed.",
+                          UintegerValue(1000),
+                          MakeUintegerAccessor(&TraceFadingLossModel::m_chunkSize),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute(
                 "RngStreamSetSize",
                 "The number of RNG streams reserved for the fading model. The maximum number of "
                 "streams that are needed for an LTE FDD scenario is 2 * numUEs * numeNBs.",
                 UintegerValue(200000),
                 MakeUintegerAccessor(&TraceFadingLossModel::m_streamSetSize),
-                MakeUintegerChecker<uint64_t>());
+                MakeUintegerChecker<uint64_t>(),
+                TypeId::DEPRECATED,
+                "The model uses two RNG streams, whatever the number of channel realizations.");
     return tid;
 }
 
@@ -112,16 +217,43 @@ TraceFadingLossModel::SetTraceLength(Time t)
 void
 TraceFadingLossModel::DoInitialize()
 {
-    LoadTrace();
+    m_samplePeriod = m_traceLength / m_samplesNum;
+    NS_ABORT_MSG_IF(!m_samplePeriod.IsStrictlyPositive(), "Fading trace samples too short");
+    NS_ABORT_MSG_IF(!m_windowSize.IsStrictlyPositive(), "Fading window must be positive");
+    m_windowSamples = static_cast<uint32_t>(Div(m_windowSize, m_samplePeriod));
+    NS_ABORT_MSG_IF(m_windowSamples > m_samplesNum, "Fading window longer than the trace");
+    if (m_profile == TRACE_FILE)
+    {
+        LoadTrace();
+    }
+    else
+    {
+        m_generatedChunks.clear();
+        m_generatedChunks.resize((m_samplesNum + m_chunkSize - 1) / m_chunkSize);
+        m_taps.clear();
+    }
+    m_windowsStart = Simulator::Now();
 }
 
 void
 TraceFadingLossModel::LoadTrace()
 {
     NS_LOG_FUNCTION(this << "Loading Fading Trace " << m_traceFile);
+    TraceFileId id(m_traceFile, m_rbNum, m_samplesNum);
+    auto& loadedTraces = GetLoadedTraces();
+    auto it = loadedTraces.find(id);
+    if (it != loadedTraces.end())
+    {
+        m_fadingTrace = it->second.lock();
+        if (m_fadingTrace)
+        {
+            NS_LOG_INFO(this << " sharing the trace already loaded from " << m_traceFile);
+            return;
+        }
+    }
+
     std::ifstream ifTraceFile;
     ifTraceFile.open(m_traceFile, std::ifstream::in);
-    m_fadingTrace.clear();
     if (!ifTraceFile.good())
     {
         NS_LOG_INFO(this << " File: " << m_traceFile);
@@ -130,71 +262,167 @@ TraceFadingLossModel::LoadTrace()
 
     //   NS_LOG_INFO (this << " length " << m_traceLength.GetSeconds ());
     //   NS_LOG_INFO (this << " RB " << (uint32_t)m_rbNum << " samples " << m_samplesNum);
+    // the trace is removed from the loaded traces when the last model using it releases it
+    std::shared_ptr<FadingTrace> fadingTrace(new FadingTrace, [id](FadingTrace* trace) {
+        GetLoadedTraces().erase(id);
+        delete trace;
+    });
+    fadingTrace->reserve(static_cast<std::size_t>(m_rbNum) * m_samplesNum);
     for (uint32_t i = 0; i < m_rbNum; i++)
     {
-        FadingTraceSample rbTimeFadingTrace;
         for (uint32_t j = 0; j < m_samplesNum; j++)
         {
             double sample;
             ifTraceFile >> sample;
-            rbTimeFadingTrace.push_back(sample);
+            fadingTrace->push_back(sample);
         }
-        m_fadingTrace.push_back(rbTimeFadingTrace);
     }
-    m_timeGranularity = m_traceLength.GetMilliSeconds() / m_samplesNum;
-    m_lastWindowUpdate = Simulator::Now();
+    m_fadingTrace = fadingTrace;
+    loadedTraces[id] = m_fadingTrace;
 }
 
-Ptr<SpectrumValue>
-TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParameters> params,
-                                                   Ptr<const MobilityModel> a,
-                                                   Ptr<const MobilityModel> b) const
+void
+TraceFadingLossModel::InitializeGenerator() const
 {
-    NS_LOG_FUNCTION(this << *params->psd << a << b);
+    NS_LOG_FUNCTION(this);
+    const std::vector<ProfileTap>* profile = nullptr;
+    switch (m_profile)
+    {
+    case EPA:
+        profile = &EPA_TAPS;
+        break;
+    case EVA:
+        profile = &EVA_TAPS;
+        break;
+    case ETU:
+        profile = &ETU_TAPS;
+        break;
+    default:
+        NS_FATAL_ERROR("unknown fading profile " << m_profile);
+        break;
+    }
 
-    std::map<ChannelRealizationId_t, int>::iterator itOff;
-    ChannelRealizationId_t mobilityPair = std::make_pair(a, b);
-    itOff = m_windowOffsetsMap.find(mobilityPair);
-    if (itOff != m_windowOffsetsMap.end())
+    // maximum Doppler shift, as an angular frequency
+    double wd = 2 * M_PI * m_speed * m_carrierFrequency / 299792458.0;
+    double totalPower = 0;
+    for (const auto& profileTap : *profile)
+    {
+        totalPower += std::pow(10.0, profileTap.power / 10);
+    }
+
+    // sum of sinusoids model of Y. R. Zheng and C. Xiao, "Simulation models
+    // with correct statistical properties for Rayleigh fading channels," IEEE
+    // Trans. on Communications, 2003, one process per tap
+    m_taps.clear();
+    for (const auto& profileTap : *profile)
     {
-        if (Simulator::Now().GetSeconds() >=
-            m_lastWindowUpdate.GetSeconds() + m_windowSize.GetSeconds())
+        GeneratorTap tap;
+        tap.amplitude = std::sqrt(std::pow(10.0, profileTap.power / 10) / totalPower);
+        double theta = m_phaseVariable->GetValue(-M_PI, M_PI);
+        for (uint32_t n = 1; n <= SINUSOIDS_NUM; n++)
         {
-            // update all the offsets
-            NS_LOG_INFO("Fading Windows Updated");
-            std::map<ChannelRealizationId_t, int>::iterator itOff2;
-            for (itOff2 = m_windowOffsetsMap.begin(); itOff2 != m_windowOffsetsMap.end(); itOff2++)
+            double alpha = (2 * M_PI * n - M_PI + theta) / (4 * SINUSOIDS_NUM);
+            tap.inPhaseFreq.push_back(wd * std::cos(alpha));
+            tap.inPhasePhase.push_back(m_phaseVariable->GetValue(-M_PI, M_PI));
+            tap.quadratureFreq.push_back(wd * std::sin(alpha));
+            tap.quadraturePhase.push_back(m_phaseVariable->GetValue(-M_PI, M_PI));
+        }
+        m_taps.push_back(tap);
+    }
+
+    m_tapRbResponse.clear();
+    for (uint32_t rb = 0; rb < m_rbNum; rb++)
+    {
+        double frequency = (rb - (m_rbNum - 1) / 2.0) * RB_BANDWIDTH;
+        for (const auto& profileTap : *profile)
+        {
+            m_tapRbResponse.push_back(std::polar(1.0, -2 * M_PI * frequency * profileTap.delay));
+        }
+    }
+}
+
+void
+TraceFadingLossModel::GenerateChunk(uint32_t chunk) const
+{
+    NS_LOG_FUNCTION(this << chunk);
+    if (m_taps.empty())
+    {
+        InitializeGenerator();
+    }
+
+    FadingTrace& samples = m_generatedChunks.at(chunk);
+    samples.resize(static_cast<std::size_t>(m_rbNum) * m_chunkSize);
+    uint32_t first = chunk * m_chunkSize;
+    uint32_t last = std::min(first + m_chunkSize, m_samplesNum);
+    std::vector<std::complex<double>> tapGains(m_taps.size());
+    double norm = 1 / std::sqrt(SINUSOIDS_NUM);
+    for (uint32_t index = first; index < last; index++)
+    {
+        double t = (m_samplePeriod * index).GetSeconds();
+        for (std::size_t l = 0; l < m_taps.size(); l++)
+        {
+            const GeneratorTap& tap = m_taps[l];
+            double inPhase = 0;
+            double quadrature = 0;
+            for (uint32_t n = 0; n < SINUSOIDS_NUM; n++)
+            {
+                inPhase += std::cos(tap.inPhaseFreq[n] * t + tap.inPhasePhase[n]);
+                quadrature += std::cos(tap.quadratureFreq[n] * t + tap.quadraturePhase[n]);
+            }
+            tapGains[l] = tap.amplitude * norm * std::complex<double>(inPhase, quadrature);
+        }
+        for (uint32_t rb = 0; rb < m_rbNum; rb++)
+        {
+            std::complex<double> gain = 0;
+            for (std::size_t l = 0; l < m_taps.size(); l++)
             {
-                std::map<ChannelRealizationId_t, Ptr<UniformRandomVariable>>::iterator itVar;
-                itVar = m_startVariableMap.find((*itOff2).first);
-                (*itOff2).second = (*itVar).second->GetValue();
+                gain += tapGains[l] * m_tapRbResponse[rb * m_taps.size() + l];
             }
-            m_lastWindowUpdate = Simulator::Now();
+            samples[rb * m_chunkSize + index - first] =
+                10 * std::log10(std::max(std::norm(gain), 1e-20));
         }
     }
-    else
+}
+
+double
+TraceFadingLossModel::GetSample(uint32_t rb, uint32_t index) const
+{
+    if (m_fadingTrace)
+    {
+        return (*m_fadingTrace)[rb * m_samplesNum + index];
+    }
+    uint32_t chunk = index / m_chunkSize;
+    if (m_generatedChunks.at(chunk).empty())
+    {
+        GenerateChunk(chunk);
+    }
+    return m_generatedChunks[chunk][rb * m_chunkSize + index % m_chunkSize];
+}
+
+Ptr<SpectrumValue>
+TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParameters> params,
+                                                   Ptr<const MobilityModel> a,
+                                                   Ptr<const MobilityModel> b) const
+{
+    NS_LOG_FUNCTION(this << *params->psd << a << b);
+
+    // the offset of a channel realization is drawn again in every window, when
+    // the realization is first used in the window
+    Time elapsed = Simulator::Now() - m_windowsStart;
+    int64_t window = Div(elapsed, m_windowSize);
+    ChannelRealizationId_t mobilityPair = std::make_pair(a, b);
+    auto itOff = m_windowOffsetsMap.find(mobilityPair);
+    if (itOff == m_windowOffsetsMap.end())
     {
         NS_LOG_LOGIC(this << "insert new channel realization, m_windowOffsetMap.size () = "
                           << m_windowOffsetsMap.size());
-        Ptr<UniformRandomVariable> startV = CreateObject<UniformRandomVariable>();
-        startV->SetAttribute("Min", DoubleValue(1.0));
-        startV->SetAttribute(
-            "Max",
-            DoubleValue((m_traceLength.GetSeconds() - m_windowSize.GetSeconds()) * 1000.0));
-        if (m_streamsAssigned)
-        {
-            NS_ASSERT_MSG(m_currentStream <= m_lastStream,
-                          "not enough streams, consider increasing the StreamSetSize attribute");
-            startV->SetStream(m_currentStream);
-            m_currentStream += 1;
-        }
-        ChannelRealizationId_t mobilityPair = std::make_pair(a, b);
-        m_startVariableMap.insert(
-            std::pair<ChannelRealizationId_t, Ptr<UniformRandomVariable>>(mobilityPair, startV));
-        itOff =
-            m_windowOffsetsMap
-                .insert(std::pair<ChannelRealizationId_t, int>(mobilityPair, startV->GetValue()))
-                .first;
+        itOff = m_windowOffsetsMap.insert({mobilityPair, {window - 1, 0}}).first;
+    }
+    if (itOff->second.window != window)
+    {
+        NS_LOG_INFO("Fading Window Updated");
+        itOff->second.window = window;
+        itOff->second.offset = m_offsetVariable->GetInteger(0, m_samplesNum - m_windowSamples);
     }
 
     Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue>(params->psd);
@@ -207,19 +435,20 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
     // (aSpeedVector.y-bSpeedVector.y,2));
 
     NS_LOG_LOGIC(this << *rxPsd);
-    NS_ASSERT(!m_fadingTrace.empty());
-    int now_ms = static_cast<int>(Simulator::Now().GetMilliSeconds() * m_timeGranularity);
-    int lastUpdate_ms = static_cast<int>(m_lastWindowUpdate.GetMilliSeconds() * m_timeGranularity);
-    int index = ((*itOff).second + now_ms - lastUpdate_ms) % m_samplesNum;
-    int subChannel = 0;
+    NS_ASSERT(m_fadingTrace || !m_generatedChunks.empty());
+    uint32_t index =
+        (itOff->second.offset + Div(elapsed - m_windowSize * window, m_samplePeriod)) %
+        m_samplesNum;
+    uint32_t subChannel = 0;
     while (vit != rxPsd->ValuesEnd())
     {
-        NS_ASSERT(subChannel < 100);
+        NS_ASSERT(subChannel < m_rbNum);
         if (*vit != 0.)
         {
-            double fading = m_fadingTrace.at(subChannel).at(index);
-            NS_LOG_INFO(this << " FADING now " << now_ms << " offset " << (*itOff).second << " id "
-                             << index << " fading " << fading);
+            double fading = GetSample(subChannel, index);
+            NS_LOG_INFO(this << " FADING now " << Simulator::Now().GetMilliSeconds()
+                             << " offset " << itOff->second.offset << " id " << index
+                             << " fading " << fading);
             double power = *vit;                     // in Watt/Hz
             power = 10 * std::log10(180000 * power); // in dB
 
@@ -242,22 +471,9 @@ int64_t
 TraceFadingLossModel::AssignStreams(int64_t stream)
 {
     NS_LOG_FUNCTION(this << stream);
-    NS_ASSERT(m_streamsAssigned == false);
-    m_streamsAssigned = true;
-    m_currentStream = stream;
-    m_lastStream = stream + m_streamSetSize - 1;
-    std::map<ChannelRealizationId_t, Ptr<UniformRandomVariable>>::iterator itVar;
-    itVar = m_startVariableMap.begin();
-    // the following loop is for eventually pre-existing ChannelRealization instances
-    // note that more instances are expected to be created at run time
-    while (itVar != m_startVariableMap.end())
-    {
-        NS_ASSERT_MSG(m_currentStream <= m_lastStream,
-                      "not enough streams, consider increasing the StreamSetSize attribute");
-        (*itVar).second->SetStream(m_currentStream);
-        m_currentStream += 1;
-    }
-    return m_streamSetSize;
+    m_offsetVariable->SetStream(stream);
+    m_phaseVariable->SetStream(stream + 1);
+    return 2;
 }
 
 } // namespace ns3
@@ -26,7 +26,10 @@
 #include <ns3/object.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 
+#include <complex>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace ns3
 {
@@ -37,6 +40,15 @@ class MobilityModel;
  * \ingroup spectrum
  *
  * \brief fading loss model based on precalculated fading traces
+ *
+ * The trace is either loaded from a file, in which case it is shared by all
+ * the models loading the same file, or generated by the model itself, chunk
+ * by chunk as the samples are needed, according to a 3GPP multipath fading
+ * profile and to the maximum Doppler shift given by the speed and the carrier
+ * frequency. A generated trace is not shared: each model draws its own
+ * realization of the profile from its RNG streams. Each channel realization,
+ * i.e., each pair of mobility models, reads the trace from an offset drawn
+ * randomly every window.
  */
 class TraceFadingLossModel : public SpectrumPropagationLossModel
 {
@@ -57,6 +69,17 @@ class TraceFadingLossModel : public SpectrumPropagationLossModel
      */
     typedef std::pair<Ptr<const MobilityModel>, Ptr<const MobilityModel>> ChannelRealizationId_t;
 
+    /**
+     * \brief The origin of the fading trace
+     */
+    enum FadingProfile
+    {
+        TRACE_FILE, ///< trace loaded from the TraceFilename file
+        EPA,        ///< trace generated with the Extended Pedestrian A profile
+        EVA,        ///< trace generated with the Extended Vehicular A profile
+        ETU         ///< trace generated with the Extended Typical Urban profile
+    };
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model.  Return the number of streams (possibly zero) that
@@ -101,34 +124,80 @@ class TraceFadingLossModel : public SpectrumPropagationLossModel
     /// Load trace function
     void LoadTrace();
 
-    mutable std::map<ChannelRealizationId_t, int> m_windowOffsetsMap; ///< windows offsets map
+    /**
+     * \brief Get a sample of the fading trace
+     * \param rb the RB
+     * \param index the index of the sample in time
+     * \return the fading in dB
+     */
+    double GetSample(uint32_t rb, uint32_t index) const;
 
-    mutable std::map<ChannelRealizationId_t, Ptr<UniformRandomVariable>>
-        m_startVariableMap; ///< start variable map
+    /**
+     * \brief Compute a chunk of the generated trace
+     * \param chunk the index of the chunk
+     */
+    void GenerateChunk(uint32_t chunk) const;
 
     /**
-     * Vector with fading samples in time domain (for a fixed RB)
+     * \brief Draw the random parameters of the taps of the generated trace
      */
-    typedef std::vector<double> FadingTraceSample;
+    void InitializeGenerator() const;
+
     /**
-     * Vector collecting the time fading traces in the frequency domain (per RB)
+     * Vector with the fading samples in dB of all the RBs, the samples of RB
+     * i being at positions [i * samplesNum, (i + 1) * samplesNum)
      */
-    typedef std::vector<FadingTraceSample> FadingTrace;
+    typedef std::vector<float> FadingTrace;
+
+    /**
+     * Offset in the trace of a channel realization
+     */
+    struct WindowOffset
+    {
+        int64_t window;  ///< index of the window the offset was drawn for
+        uint32_t offset; ///< index of the first sample of the window
+    };
+
+    mutable std::map<ChannelRealizationId_t, WindowOffset>
+        m_windowOffsetsMap; ///< windows offsets map
+
+    Ptr<UniformRandomVariable> m_offsetVariable; ///< random variable of the window offsets
 
     std::string m_traceFile; ///< the trace file name
 
-    FadingTrace m_fadingTrace; ///< fading trace
-
-    Time m_traceLength;               ///< the trace time
-    uint32_t m_samplesNum;            ///< number of samples
-    Time m_windowSize;                ///< window size
-    uint8_t m_rbNum;                  ///< RB number
-    mutable Time m_lastWindowUpdate;  ///< time of last window update
-    uint8_t m_timeGranularity;        ///< time granularity
-    mutable uint64_t m_currentStream; ///< the current stream
-    mutable uint64_t m_lastStream;    ///< the last stream
-    uint64_t m_streamSetSize;         ///< stream set size
-    mutable bool m_streamsAssigned;   ///< is streams assigned?
+    std::shared_ptr<const FadingTrace> m_fadingTrace; ///< fading trace loaded from the file
+
+    /**
+     * A multipath component of the generated trace, modeled as a sum of
+     * sinusoids for the in-phase and quadrature components
+     */
+    struct GeneratorTap
+    {
+        double amplitude;                    ///< square root of the relative power of the tap
+        std::vector<double> inPhaseFreq;     ///< angular frequencies of the in-phase sinusoids
+        std::vector<double> inPhasePhase;    ///< phases of the in-phase sinusoids
+        std::vector<double> quadratureFreq;  ///< angular frequencies of the quadrature sinusoids
+        std::vector<double> quadraturePhase; ///< phases of the quadrature sinusoids
+    };
+
+    FadingProfile m_profile;                    ///< fading profile
+    double m_speed;                             ///< speed determining the Doppler shift (m/s)
+    double m_carrierFrequency;                  ///< carrier frequency (Hz)
+    uint32_t m_chunkSize;                       ///< number of samples of a generated chunk
+    Ptr<UniformRandomVariable> m_phaseVariable; ///< random variable of the generator
+    mutable std::vector<GeneratorTap> m_taps;   ///< taps of the generated trace
+    /// response of each tap on each RB, the taps of RB 0 first, then those of RB 1, ...
+    mutable std::vector<std::complex<double>> m_tapRbResponse;
+    mutable std::vector<FadingTrace> m_generatedChunks; ///< chunks of the generated trace
+
+    Time m_traceLength;       ///< the trace time
+    uint32_t m_samplesNum;    ///< number of samples
+    Time m_windowSize;        ///< window size
+    uint8_t m_rbNum;          ///< RB number
+    Time m_samplePeriod;      ///< time between two samples
+    uint32_t m_windowSamples; ///< number of samples of a window
+    Time m_windowsStart;      ///< start time of the first window
+    uint64_t m_streamSetSize; ///< stream set size
 };
 
 } // namespace ns3
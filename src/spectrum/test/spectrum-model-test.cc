@@ -0,0 +1,120 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/spectrum-model.h>
+#include <ns3/test.h>
+
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Test the detection of orthogonal SpectrumModels.
+ */
+class SpectrumModelOrthogonalTestCase : public TestCase
+{
+  public:
+    SpectrumModelOrthogonalTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that two models are (or are not) orthogonal, in both directions
+     * \param a the bands of the first model, as (low, high) pairs
+     * \param b the bands of the second model, as (low, high) pairs
+     * \param orthogonal whether the models are expected to be orthogonal
+     * \param msg the description of the check
+     */
+    void Check(const std::vector<std::pair<double, double>>& a,
+               const std::vector<std::pair<double, double>>& b,
+               bool orthogonal,
+               const std::string& msg);
+};
+
+SpectrumModelOrthogonalTestCase::SpectrumModelOrthogonalTestCase()
+    : TestCase("Check SpectrumModel::IsOrthogonal")
+{
+}
+
+void
+SpectrumModelOrthogonalTestCase::Check(const std::vector<std::pair<double, double>>& a,
+                                       const std::vector<std::pair<double, double>>& b,
+                                       bool orthogonal,
+                                       const std::string& msg)
+{
+    auto makeBands = [](const std::vector<std::pair<double, double>>& limits) {
+        Bands bands;
+        for (const auto& [fl, fh] : limits)
+        {
+            BandInfo bi;
+            bi.fl = fl;
+            bi.fc = (fl + fh) / 2;
+            bi.fh = fh;
+            bands.push_back(bi);
+        }
+        return bands;
+    };
+    SpectrumModel ma(makeBands(a));
+    SpectrumModel mb(makeBands(b));
+    NS_TEST_EXPECT_MSG_EQ(ma.IsOrthogonal(mb), orthogonal, msg);
+    NS_TEST_EXPECT_MSG_EQ(mb.IsOrthogonal(ma), orthogonal, msg << " (reversed)");
+}
+
+void
+SpectrumModelOrthogonalTestCase::DoRun()
+{
+    Check({{100, 110}, {110, 120}}, {{105, 115}}, false, "Overlapping models");
+    Check({{100, 110}, {110, 120}}, {{100, 110}, {110, 120}}, false, "Identical models");
+    Check({{100, 110}, {110, 120}}, {{200, 210}, {210, 220}}, true, "Disjoint models");
+    Check({{100, 110}, {110, 120}}, {{120, 130}}, true, "Models touching at an edge");
+    Check({{100, 110}, {130, 140}}, {{115, 125}}, true, "Interleaved models");
+    Check({{100, 110}, {130, 140}}, {{110, 130}}, true, "Interleaved models touching at edges");
+    Check({{100, 110}, {130, 140}},
+          {{115, 125}, {135, 145}},
+          false,
+          "Interleaved models with an overlapping band");
+
+    // Models built from center frequencies: [95, 125], [125, 145] and [135, 155]
+    SpectrumModel ma(std::vector<double>{100, 110, 120});
+    SpectrumModel mb(std::vector<double>{130, 140});
+    SpectrumModel mc(std::vector<double>{140, 150});
+    NS_TEST_EXPECT_MSG_EQ(ma.IsOrthogonal(mb), true, "Models touching at an edge");
+    NS_TEST_EXPECT_MSG_EQ(mb.IsOrthogonal(mc), false, "Overlapping models");
+    NS_TEST_EXPECT_MSG_EQ(ma.IsOrthogonal(mc), true, "Disjoint models");
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumModel TestSuite
+ */
+class SpectrumModelTestSuite : public TestSuite
+{
+  public:
+    SpectrumModelTestSuite();
+};
+
+SpectrumModelTestSuite::SpectrumModelTestSuite()
+    : TestSuite("spectrum-model", UNIT)
+{
+    AddTestCase(new SpectrumModelOrthogonalTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumModelTestSuite g_spectrumModelTestSuite;
@@ -0,0 +1,318 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/enum.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/string.h>
+#include <ns3/test.h>
+#include <ns3/trace-fading-loss-model.h>
+#include <ns3/uinteger.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("TraceFadingLossModelTest");
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the traces generated by the TraceFadingLossModel class.
+ *
+ * Check that the average linear gain of a generated trace, over the RBs and
+ * the samples read by a channel realization, is close to one, and that two
+ * models using the same RNG streams return the same fading.
+ */
+class TraceFadingLossModelGeneratedTraceTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param profile the fading profile of the generated trace
+     * \param name the name of the profile
+     */
+    TraceFadingLossModelGeneratedTraceTest(TraceFadingLossModel::FadingProfile profile,
+                                           std::string name);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compute the fading of both models and accumulate it
+     */
+    void CalcFading();
+
+    /**
+     * Create a model generating its trace with the profile under test
+     * \return the model
+     */
+    Ptr<TraceFadingLossModel> CreateModel() const;
+
+    /// Number of RBs of the generated trace
+    static constexpr uint8_t RB_NUM{50};
+
+    /// Tolerance on the average linear gain
+    static constexpr double TOLERANCE{0.1};
+
+    TraceFadingLossModel::FadingProfile m_profile; ///< fading profile under test
+    Ptr<TraceFadingLossModel> m_model;             ///< model under test
+    Ptr<TraceFadingLossModel> m_twinModel;         ///< model using the same RNG streams
+    Ptr<MobilityModel> m_a;                        ///< first end of the channel realization
+    Ptr<MobilityModel> m_b;                        ///< second end of the channel realization
+    Ptr<SpectrumSignalParameters> m_params;        ///< parameters of the transmitted signal
+    double m_gainSum;                              ///< sum of the linear gains
+    uint32_t m_gainNum;                            ///< number of linear gains summed
+    bool m_twinMatches;                            ///< whether both models agree
+};
+
+TraceFadingLossModelGeneratedTraceTest::TraceFadingLossModelGeneratedTraceTest(
+    TraceFadingLossModel::FadingProfile profile,
+    std::string name)
+    : TestCase("Check the average gain of a trace generated with the " + name + " profile"),
+      m_profile(profile),
+      m_gainSum(0),
+      m_gainNum(0),
+      m_twinMatches(true)
+{
+}
+
+Ptr<TraceFadingLossModel>
+TraceFadingLossModelGeneratedTraceTest::CreateModel() const
+{
+    Ptr<TraceFadingLossModel> model = CreateObject<TraceFadingLossModel>();
+    model->SetAttribute("Profile", EnumValue(m_profile));
+    model->SetAttribute("RbNum", UintegerValue(RB_NUM));
+    // a high Doppler shift, so that the trace spans many coherence times
+    model->SetAttribute("Speed", DoubleValue(30));
+    model->AssignStreams(1);
+    model->Initialize();
+    return model;
+}
+
+void
+TraceFadingLossModelGeneratedTraceTest::CalcFading()
+{
+    Ptr<SpectrumValue> rxPsd = m_model->CalcRxPowerSpectralDensity(m_params, m_a, m_b);
+    Ptr<SpectrumValue> twinRxPsd = m_twinModel->CalcRxPowerSpectralDensity(m_params, m_a, m_b);
+    for (uint8_t rb = 0; rb < RB_NUM; rb++)
+    {
+        m_gainSum += (*rxPsd)[rb] / (*m_params->psd)[rb];
+        m_twinMatches &= ((*rxPsd)[rb] == (*twinRxPsd)[rb]);
+    }
+    m_gainNum += RB_NUM;
+}
+
+void
+TraceFadingLossModelGeneratedTraceTest::DoRun()
+{
+    Bands bands;
+    for (uint8_t rb = 0; rb < RB_NUM; rb++)
+    {
+        BandInfo band;
+        band.fl = 2150e6 + rb * 180e3;
+        band.fc = band.fl + 90e3;
+        band.fh = band.fl + 180e3;
+        bands.push_back(band);
+    }
+    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(Create<SpectrumModel>(bands));
+    (*txPsd) = 1e-10;
+    m_params = Create<SpectrumSignalParameters>();
+    m_params->psd = txPsd;
+
+    m_a = CreateObject<ConstantPositionMobilityModel>();
+    m_b = CreateObject<ConstantPositionMobilityModel>();
+    m_model = CreateModel();
+    m_twinModel = CreateModel();
+
+    for (uint32_t ms = 0; ms < 10000; ms += 2)
+    {
+        Simulator::Schedule(MilliSeconds(ms),
+                            &TraceFadingLossModelGeneratedTraceTest::CalcFading,
+                            this);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_twinMatches, true, "models with the same streams should agree");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_gainSum / m_gainNum,
+                              1.0,
+                              TOLERANCE,
+                              "the average gain of the generated trace should be one");
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test case for the sharing of the traces loaded from a file by the
+ * TraceFadingLossModel class.
+ *
+ * The file is overwritten after each model loads it: the models created
+ * while another model still uses the trace must read the trace loaded first,
+ * and a model created once all the models using the trace are gone must load
+ * the file again.
+ */
+class TraceFadingLossModelSharedTraceTest : public TestCase
+{
+  public:
+    TraceFadingLossModelSharedTraceTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Write a trace file whose samples all have the same value
+     * \param fading the value of the samples (dB)
+     */
+    void WriteTrace(double fading) const;
+
+    /**
+     * Create a model loading the trace file
+     * \return the model
+     */
+    Ptr<TraceFadingLossModel> CreateModel() const;
+
+    /**
+     * \param model the model
+     * \return the fading (dB) returned by the model on the first RB
+     */
+    double GetFading(Ptr<TraceFadingLossModel> model) const;
+
+    /// Number of RBs of the trace
+    static constexpr uint8_t RB_NUM{2};
+
+    /// Number of samples of the trace
+    static constexpr uint32_t SAMPLES_NUM{100};
+
+    std::string m_traceFile;                ///< name of the trace file
+    Ptr<MobilityModel> m_a;                 ///< first end of the channel realization
+    Ptr<MobilityModel> m_b;                 ///< second end of the channel realization
+    Ptr<SpectrumSignalParameters> m_params; ///< parameters of the transmitted signal
+};
+
+TraceFadingLossModelSharedTraceTest::TraceFadingLossModelSharedTraceTest()
+    : TestCase("Check that the models loading the same trace file share the trace")
+{
+}
+
+void
+TraceFadingLossModelSharedTraceTest::WriteTrace(double fading) const
+{
+    std::ofstream os(m_traceFile);
+    for (uint32_t i = 0; i < RB_NUM * SAMPLES_NUM; i++)
+    {
+        os << fading << " ";
+    }
+}
+
+Ptr<TraceFadingLossModel>
+TraceFadingLossModelSharedTraceTest::CreateModel() const
+{
+    Ptr<TraceFadingLossModel> model = CreateObject<TraceFadingLossModel>();
+    model->SetAttribute("TraceFilename", StringValue(m_traceFile));
+    model->SetAttribute("TraceLength", TimeValue(Seconds(1)));
+    model->SetAttribute("SamplesNum", UintegerValue(SAMPLES_NUM));
+    model->SetAttribute("WindowSize", TimeValue(MilliSeconds(500)));
+    model->SetAttribute("RbNum", UintegerValue(RB_NUM));
+    model->Initialize();
+    return model;
+}
+
+double
+TraceFadingLossModelSharedTraceTest::GetFading(Ptr<TraceFadingLossModel> model) const
+{
+    Ptr<SpectrumValue> rxPsd = model->CalcRxPowerSpectralDensity(m_params, m_a, m_b);
+    return 10 * std::log10((*rxPsd)[0] / (*m_params->psd)[0]);
+}
+
+void
+TraceFadingLossModelSharedTraceTest::DoRun()
+{
+    Bands bands;
+    for (uint8_t rb = 0; rb < RB_NUM; rb++)
+    {
+        BandInfo band;
+        band.fl = 2150e6 + rb * 180e3;
+        band.fc = band.fl + 90e3;
+        band.fh = band.fl + 180e3;
+        bands.push_back(band);
+    }
+    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(Create<SpectrumModel>(bands));
+    (*txPsd) = 1e-10;
+    m_params = Create<SpectrumSignalParameters>();
+    m_params->psd = txPsd;
+    m_a = CreateObject<ConstantPositionMobilityModel>();
+    m_b = CreateObject<ConstantPositionMobilityModel>();
+    m_traceFile = CreateTempDirFilename("trace-fading-loss-model-shared.fad");
+
+    WriteTrace(-3);
+    Ptr<TraceFadingLossModel> first = CreateModel();
+    WriteTrace(-6);
+    Ptr<TraceFadingLossModel> second = CreateModel();
+    NS_TEST_EXPECT_MSG_EQ_TOL(GetFading(first), -3, 1e-6, "wrong trace loaded");
+    NS_TEST_EXPECT_MSG_EQ_TOL(GetFading(second), -3, 1e-6, "the trace should be shared");
+
+    // the trace is kept as long as a model uses it
+    first = nullptr;
+    WriteTrace(-9);
+    Ptr<TraceFadingLossModel> third = CreateModel();
+    NS_TEST_EXPECT_MSG_EQ_TOL(GetFading(second), -3, 1e-6, "the trace should be kept");
+    NS_TEST_EXPECT_MSG_EQ_TOL(GetFading(third), -3, 1e-6, "the trace should be shared");
+
+    // the trace is freed when all the models using it are gone
+    second = nullptr;
+    third = nullptr;
+    Ptr<TraceFadingLossModel> fourth = CreateModel();
+    NS_TEST_EXPECT_MSG_EQ_TOL(GetFading(fourth), -9, 1e-6, "the trace should be reloaded");
+
+    fourth = nullptr;
+    Simulator::Destroy();
+    std::remove(m_traceFile.c_str());
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * Test suite for the TraceFadingLossModel class
+ */
+class TraceFadingLossModelTestSuite : public TestSuite
+{
+  public:
+    /**
+     * Constructor
+     */
+    TraceFadingLossModelTestSuite();
+};
+
+TraceFadingLossModelTestSuite::TraceFadingLossModelTestSuite()
+    : TestSuite("trace-fading-loss-model", UNIT)
+{
+    AddTestCase(new TraceFadingLossModelGeneratedTraceTest(TraceFadingLossModel::EPA, "EPA"),
+                TestCase::QUICK);
+    AddTestCase(new TraceFadingLossModelGeneratedTraceTest(TraceFadingLossModel::EVA, "EVA"),
+                TestCase::QUICK);
+    AddTestCase(new TraceFadingLossModelGeneratedTraceTest(TraceFadingLossModel::ETU, "ETU"),
+                TestCase::QUICK);
+    AddTestCase(new TraceFadingLossModelSharedTraceTest, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static TraceFadingLossModelTestSuite g_traceFadingLossModelTestSuite;
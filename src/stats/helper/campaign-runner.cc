@@ -0,0 +1,352 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "campaign-runner.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/sqlite-output.h"
+#include "ns3/system-path.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <map>
+#include <poll.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("CampaignRunner");
+
+namespace
+{
+
+/// Bookkeeping of a child process executing a run
+struct ActiveRun
+{
+    CampaignRunner::RunSpec spec;                //!< The run
+    std::string outputFile;                      //!< File capturing the child output
+    std::chrono::steady_clock::time_point start; //!< Time the child was started
+    int exitPipe;                                //!< Read end of a pipe closed when the child exits
+};
+
+/**
+ * \param fileName file to read
+ * \return the content of the file
+ */
+std::string
+ReadFile(const std::string& fileName)
+{
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+    std::ostringstream oss;
+    oss << in.rdbuf();
+    return oss.str();
+}
+
+} // namespace
+
+CampaignRunner::CampaignRunner(const std::string& program, const std::string& database)
+    : m_program(program),
+      m_campaign(program)
+{
+    NS_LOG_FUNCTION(this << program << database);
+    m_db = Create<SQLiteOutput>(database);
+    CreateTable();
+}
+
+CampaignRunner::~CampaignRunner()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+CampaignRunner::SetCampaignName(const std::string& name)
+{
+    NS_LOG_FUNCTION(this << name);
+    m_campaign = name;
+}
+
+void
+CampaignRunner::AddParameter(const std::string& name, const std::vector<std::string>& values)
+{
+    NS_LOG_FUNCTION(this << name << values.size());
+    NS_ABORT_MSG_IF(values.empty(), "Parameter " << name << " has no values");
+    m_grid.emplace_back(name, values);
+}
+
+void
+CampaignRunner::AddFixedArgument(const std::string& argument)
+{
+    NS_LOG_FUNCTION(this << argument);
+    m_fixedArguments.push_back(argument);
+}
+
+void
+CampaignRunner::SetRuns(uint32_t runs, uint32_t firstRun)
+{
+    NS_LOG_FUNCTION(this << runs << firstRun);
+    m_runs = runs;
+    m_firstRun = firstRun;
+}
+
+void
+CampaignRunner::SetMaxConcurrency(uint32_t jobs)
+{
+    NS_LOG_FUNCTION(this << jobs);
+    NS_ABORT_MSG_IF(jobs == 0, "At least one concurrent job is required");
+    m_maxConcurrency = jobs;
+}
+
+std::vector<CampaignRunner::RunSpec>
+CampaignRunner::GetRuns() const
+{
+    // Expand the grid as a mixed-radix counter, the last parameter changing fastest
+    std::vector<std::vector<std::string>> points{{}};
+    for (const auto& [name, values] : m_grid)
+    {
+        std::vector<std::vector<std::string>> expanded;
+        expanded.reserve(points.size() * values.size());
+        for (const auto& point : points)
+        {
+            for (const auto& value : values)
+            {
+                expanded.push_back(point);
+                expanded.back().push_back("--" + name + "=" + value);
+            }
+        }
+        points = std::move(expanded);
+    }
+
+    std::vector<RunSpec> runs;
+    runs.reserve(points.size() * m_runs);
+    for (uint32_t run = m_firstRun; run < m_firstRun + m_runs; ++run)
+    {
+        for (const auto& point : points)
+        {
+            runs.push_back({point, run});
+        }
+    }
+    return runs;
+}
+
+std::size_t
+CampaignRunner::GetCompletedRuns() const
+{
+    return ReadCompletedRuns().size();
+}
+
+void
+CampaignRunner::CreateTable() const
+{
+    bool ret = m_db->WaitExec("CREATE TABLE IF NOT EXISTS CampaignRuns ("
+                              "campaign TEXT NOT NULL, "
+                              "arguments TEXT NOT NULL, "
+                              "rngRun INTEGER NOT NULL, "
+                              "exitStatus INTEGER, "
+                              "wallClockSeconds REAL, "
+                              "output TEXT, "
+                              "PRIMARY KEY (campaign, arguments, rngRun));");
+    NS_ABORT_MSG_UNLESS(ret, "Unable to create the CampaignRuns table");
+}
+
+std::set<std::pair<std::string, uint32_t>>
+CampaignRunner::ReadCompletedRuns() const
+{
+    std::set<std::pair<std::string, uint32_t>> completed;
+
+    sqlite3_stmt* stmt;
+    bool ret = m_db->WaitPrepare(&stmt,
+                                 "SELECT arguments, rngRun FROM CampaignRuns "
+                                 "WHERE campaign = ? AND exitStatus = 0;");
+    NS_ABORT_MSG_UNLESS(ret, "Unable to prepare the query of completed runs");
+    m_db->Bind(stmt, 1, m_campaign);
+
+    while (SQLiteOutput::SpinStep(stmt) == SQLITE_ROW)
+    {
+        completed.emplace(m_db->RetrieveColumn<std::string>(stmt, 0),
+                          m_db->RetrieveColumn<uint32_t>(stmt, 1));
+    }
+    SQLiteOutput::SpinFinalize(stmt);
+    return completed;
+}
+
+std::string
+CampaignRunner::GetRunKey(const RunSpec& spec)
+{
+    std::string key;
+    for (const auto& argument : spec.arguments)
+    {
+        key += (key.empty() ? "" : " ") + argument;
+    }
+    return key;
+}
+
+std::size_t
+CampaignRunner::Run()
+{
+    NS_LOG_FUNCTION(this);
+
+    auto completed = ReadCompletedRuns();
+    std::vector<RunSpec> pending;
+    for (auto& spec : GetRuns())
+    {
+        if (completed.find({GetRunKey(spec), spec.rngRun}) == completed.end())
+        {
+            pending.push_back(std::move(spec));
+        }
+    }
+    NS_LOG_INFO("Campaign " << m_campaign << ": " << completed.size() << " runs already done, "
+                            << pending.size() << " to go");
+
+    sqlite3_stmt* insert;
+    bool ret = m_db->WaitPrepare(&insert,
+                                 "INSERT OR REPLACE INTO CampaignRuns "
+                                 "(campaign, arguments, rngRun, exitStatus, wallClockSeconds, "
+                                 "output) VALUES (?, ?, ?, ?, ?, ?);");
+    NS_ABORT_MSG_UNLESS(ret, "Unable to prepare the insertion of run results");
+
+    // The output of the runs is captured in files of a private temporary directory
+    std::string outputDir = SystemPath::MakeTemporaryDirectoryName();
+    SystemPath::MakeDirectories(outputDir);
+    std::string outputTemplate = SystemPath::Append(outputDir, "run-XXXXXX");
+
+    std::map<pid_t, ActiveRun> active;
+    std::size_t next = 0;
+    std::size_t failures = 0;
+
+    while (next < pending.size() || !active.empty())
+    {
+        // Fill the pool
+        while (next < pending.size() && active.size() < m_maxConcurrency)
+        {
+            ActiveRun run{pending[next++], "", std::chrono::steady_clock::now(), -1};
+
+            std::vector<char> outputFile(outputTemplate.begin(), outputTemplate.end());
+            outputFile.push_back('\0');
+            int fd = mkstemp(outputFile.data());
+            NS_ABORT_MSG_IF(fd == -1, "Unable to create the output file of a run");
+            run.outputFile = outputFile.data();
+
+            std::vector<std::string> arguments{m_program};
+            arguments.insert(arguments.end(), m_fixedArguments.begin(), m_fixedArguments.end());
+            arguments.insert(arguments.end(), run.spec.arguments.begin(), run.spec.arguments.end());
+            arguments.push_back("--RngRun=" + std::to_string(run.spec.rngRun));
+            std::vector<char*> argv;
+            for (auto& argument : arguments)
+            {
+                argv.push_back(argument.data());
+            }
+            argv.push_back(nullptr);
+
+            // The child inherits the write end of the pipe, which is closed when it
+            // exits, while the read end is not passed to the children.
+            int exitPipe[2];
+            NS_ABORT_MSG_IF(pipe(exitPipe) == -1, "Unable to create the pipe of a run");
+            fcntl(exitPipe[0], F_SETFD, FD_CLOEXEC);
+            run.exitPipe = exitPipe[0];
+
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid == -1, "Unable to fork a campaign run");
+            if (pid == 0)
+            {
+                dup2(fd, STDOUT_FILENO);
+                dup2(fd, STDERR_FILENO);
+                close(fd);
+                execv(m_program.c_str(), argv.data());
+                // Only reached if exec failed
+                _exit(127);
+            }
+            close(fd);
+            close(exitPipe[1]);
+            NS_LOG_DEBUG("Started run " << GetRunKey(run.spec) << " RngRun=" << run.spec.rngRun
+                                        << " as process " << pid);
+            active.emplace(pid, std::move(run));
+        }
+
+        // Wait for one of our runs to terminate and stream its result to the database.
+        // Only the children started by the runner are waited for, so that the other
+        // children of the calling process are left to their owner: the end of file of
+        // the pipe of a run tells that its child exited, and the child is then reaped.
+        std::vector<pollfd> exitPipes;
+        for (const auto& [pid, activeRun] : active)
+        {
+            exitPipes.push_back({activeRun.exitPipe, POLLIN, 0});
+        }
+        int ready = poll(exitPipes.data(), exitPipes.size(), -1);
+        if (ready == -1)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "poll failed while running the campaign");
+            continue;
+        }
+        auto it = active.begin();
+        for (const auto& exitPipe : exitPipes)
+        {
+            if (exitPipe.revents != 0)
+            {
+                break;
+            }
+            ++it;
+        }
+
+        int status;
+        pid_t pid;
+        do
+        {
+            pid = waitpid(it->first, &status, 0);
+        } while (pid == -1 && errno == EINTR);
+        NS_ABORT_MSG_IF(pid != it->first, "waitpid failed while running the campaign");
+        close(it->second.exitPipe);
+
+        const ActiveRun& run = it->second;
+        double wallClock =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - run.start).count();
+        int exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : -WTERMSIG(status);
+        if (exitStatus != 0)
+        {
+            ++failures;
+        }
+        std::string key = GetRunKey(run.spec);
+        std::string output = ReadFile(run.outputFile);
+        std::remove(run.outputFile.c_str());
+        NS_LOG_DEBUG("Run " << key << " RngRun=" << run.spec.rngRun << " exited with "
+                            << exitStatus << " after " << wallClock << " s");
+
+        SQLiteOutput::SpinReset(insert);
+        m_db->Bind(insert, 1, m_campaign);
+        m_db->Bind(insert, 2, key);
+        m_db->Bind(insert, 3, run.spec.rngRun);
+        m_db->Bind(insert, 4, exitStatus);
+        m_db->Bind(insert, 5, wallClock);
+        m_db->Bind(insert, 6, output);
+        int rc = SQLiteOutput::SpinStep(insert);
+        NS_ABORT_MSG_UNLESS(rc == SQLITE_DONE, "Unable to store the result of run " << key);
+
+        active.erase(it);
+    }
+
+    SQLiteOutput::SpinFinalize(insert);
+    rmdir(outputDir.c_str());
+    return failures;
+}
+
+} // namespace ns3
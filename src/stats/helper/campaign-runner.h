@@ -0,0 +1,152 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef CAMPAIGN_RUNNER_H
+#define CAMPAIGN_RUNNER_H
+
+#include "ns3/ptr.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+class SQLiteOutput;
+
+/**
+ * \ingroup stats
+ * \brief Execute a parameter sweep of an ns-3 program in a pool of local processes.
+ *
+ * The campaign is described by a grid of CommandLine parameters, each one
+ * with a list of values, and by a number of independent replications per
+ * grid point.  Every combination of the grid is run once per replication,
+ * passing the values as "--name=value" arguments and the replication
+ * index as "--RngRun=N".
+ *
+ * At most SetMaxConcurrency() child processes run at the same time.  As
+ * soon as a run terminates its exit status, wall clock duration and
+ * standard output are written to the "CampaignRuns" table of the SQLite
+ * database given to the constructor.  Runs that already have a successful
+ * entry in the database for the same campaign are skipped, so a campaign
+ * that was interrupted can be resumed by simply calling Run() again.
+ *
+ * The runner is only available on POSIX systems, since it relies on
+ * fork() and exec().
+ */
+class CampaignRunner
+{
+  public:
+    /// A single run of the campaign: the grid arguments and the RngRun value
+    struct RunSpec
+    {
+        std::vector<std::string> arguments; //!< "--name=value" grid arguments
+        uint32_t rngRun;                    //!< RngRun value of the replication
+    };
+
+    /**
+     * \param program path of the executable to run
+     * \param database name of the SQLite database storing the results
+     */
+    CampaignRunner(const std::string& program, const std::string& database);
+    ~CampaignRunner();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    CampaignRunner(const CampaignRunner&) = delete;
+    CampaignRunner& operator=(const CampaignRunner&) = delete;
+
+    /**
+     * \param name name used to identify this campaign in the database
+     *
+     * Different campaigns can share the same database; by default the
+     * campaign is named after the program.
+     */
+    void SetCampaignName(const std::string& name);
+
+    /**
+     * \brief Add a dimension to the parameter grid
+     * \param name CommandLine argument name, without the leading dashes
+     * \param values values taken by the argument
+     */
+    void AddParameter(const std::string& name, const std::vector<std::string>& values);
+
+    /**
+     * \brief Add an argument passed unchanged to every run
+     * \param argument the argument (e.g. "--simTime=10")
+     */
+    void AddFixedArgument(const std::string& argument);
+
+    /**
+     * \param runs number of replications per grid point
+     * \param firstRun RngRun value of the first replication
+     */
+    void SetRuns(uint32_t runs, uint32_t firstRun = 1);
+
+    /**
+     * \param jobs maximum number of runs executing concurrently
+     */
+    void SetMaxConcurrency(uint32_t jobs);
+
+    /**
+     * \return the full list of runs of the campaign, in execution order
+     */
+    std::vector<RunSpec> GetRuns() const;
+
+    /**
+     * \return the number of runs already completed successfully in the database
+     */
+    std::size_t GetCompletedRuns() const;
+
+    /**
+     * \brief Execute all the runs not yet completed in the database
+     * \return the number of runs that terminated with a non-zero exit status
+     */
+    std::size_t Run();
+
+  private:
+    /// Parameter names with the values they take, in command line order
+    typedef std::vector<std::pair<std::string, std::vector<std::string>>> ParameterGrid;
+
+    /// Create the results table if it does not exist yet
+    void CreateTable() const;
+
+    /**
+     * \return the (grid arguments, RngRun) keys of the runs completed successfully
+     */
+    std::set<std::pair<std::string, uint32_t>> ReadCompletedRuns() const;
+
+    /**
+     * \param spec the run
+     * \return the key identifying the grid point of the run in the database
+     */
+    static std::string GetRunKey(const RunSpec& spec);
+
+    std::string m_program;                     //!< Executable to run
+    std::string m_campaign;                    //!< Campaign name
+    std::vector<std::string> m_fixedArguments; //!< Arguments passed to every run
+    ParameterGrid m_grid;                      //!< Parameter grid
+    uint32_t m_runs{1};                        //!< Replications per grid point
+    uint32_t m_firstRun{1};                    //!< RngRun of the first replication
+    uint32_t m_maxConcurrency{1};              //!< Maximum concurrent processes
+    Ptr<SQLiteOutput> m_db;                    //!< Results database
+};
+
+} // namespace ns3
+
+#endif /* CAMPAIGN_RUNNER_H */
@@ -119,6 +119,15 @@ SQLiteOutput::RetrieveColumn(sqlite3_stmt* stmt, int pos) const
     return sqlite3_column_double(stmt, pos);
 }
 
+/// \copydoc SQLiteOutput::RetrieveColumn
+template <>
+std::string
+SQLiteOutput::RetrieveColumn(sqlite3_stmt* stmt, int pos) const
+{
+    const unsigned char* text = sqlite3_column_text(stmt, pos);
+    return text ? std::string(reinterpret_cast<const char*>(text)) : std::string();
+}
+
 template <typename T>
 bool
 SQLiteOutput::Bind(sqlite3_stmt* /* stmt */, int /* pos */, const T& /* value */) const
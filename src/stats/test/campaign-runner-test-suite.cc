@@ -0,0 +1,121 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/campaign-runner.h"
+#include "ns3/test.h"
+
+#include <cstdio>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief CampaignRunner grid expansion, execution and resume test.
+ *
+ * The campaign runs /bin/echo, which always succeeds whatever the
+ * arguments.  The resumed campaign points at a program that cannot be
+ * executed, so every run that is not skipped is reported as a failure.
+ * A child process that was not started by the runner must be left to
+ * its parent.
+ */
+class CampaignRunnerTestCase : public TestCase
+{
+  public:
+    CampaignRunnerTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+CampaignRunnerTestCase::CampaignRunnerTestCase()
+    : TestCase("Run and resume a parameter sweep")
+{
+}
+
+void
+CampaignRunnerTestCase::DoRun()
+{
+    std::string db = CreateTempDirFilename("campaign-runner.db");
+    std::remove(db.c_str());
+
+    {
+        CampaignRunner runner("/bin/echo", db);
+        runner.SetCampaignName("test");
+        runner.AddParameter("a", {"1", "2"});
+        runner.AddParameter("b", {"x", "y", "z"});
+        runner.SetRuns(2);
+        runner.SetMaxConcurrency(3);
+
+        auto runs = runner.GetRuns();
+        NS_TEST_ASSERT_MSG_EQ(runs.size(), 12, "Unexpected number of runs in the grid");
+        NS_TEST_EXPECT_MSG_EQ(runs[0].arguments[0], "--a=1", "Unexpected first argument");
+        NS_TEST_EXPECT_MSG_EQ(runs[1].arguments[1], "--b=y", "Last parameter must vary fastest");
+        NS_TEST_EXPECT_MSG_EQ(runs[0].rngRun, 1, "Unexpected RngRun of the first run");
+        NS_TEST_EXPECT_MSG_EQ(runs[11].rngRun, 2, "Unexpected RngRun of the last run");
+
+        pid_t other = fork();
+        NS_TEST_ASSERT_MSG_NE(other, -1, "Unable to fork");
+        if (other == 0)
+        {
+            _exit(0);
+        }
+
+        NS_TEST_EXPECT_MSG_EQ(runner.Run(), 0, "No run should fail");
+        NS_TEST_EXPECT_MSG_EQ(runner.GetCompletedRuns(), 12, "All runs should be stored");
+        int status;
+        NS_TEST_EXPECT_MSG_EQ(waitpid(other, &status, 0),
+                              other,
+                              "The runner reaped a child process it did not start");
+    }
+
+    {
+        CampaignRunner runner("/nonexistent/ns3-campaign-program", db);
+        runner.SetCampaignName("test");
+        runner.AddParameter("a", {"1", "2", "3"});
+        runner.AddParameter("b", {"x", "y", "z"});
+        runner.SetRuns(2);
+        runner.SetMaxConcurrency(2);
+
+        NS_TEST_EXPECT_MSG_EQ(runner.GetCompletedRuns(), 12, "Previous runs should be found");
+        NS_TEST_EXPECT_MSG_EQ(runner.Run(), 6, "Only the new grid points should be executed");
+        NS_TEST_EXPECT_MSG_EQ(runner.GetCompletedRuns(), 12, "Failed runs are not completed");
+    }
+
+    std::remove(db.c_str());
+}
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief CampaignRunner TestSuite
+ */
+class CampaignRunnerTestSuite : public TestSuite
+{
+  public:
+    CampaignRunnerTestSuite();
+};
+
+CampaignRunnerTestSuite::CampaignRunnerTestSuite()
+    : TestSuite("campaign-runner", UNIT)
+{
+    AddTestCase(new CampaignRunnerTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static CampaignRunnerTestSuite campaignRunnerTestSuite;
@@ -23,13 +23,45 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("BlockAckWindow");
 
+namespace
+{
+
+/// Number of elements of the window stored in a word of the bitmap
+constexpr std::size_t WORD_BITS = 64;
+
+/**
+ * \param word a non-null word
+ * \return the index of the least significant bit set in the given word
+ */
+std::size_t
+GetLowestSetBit(uint64_t word)
+{
+    NS_ASSERT(word != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    std::size_t index = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+} // namespace
+
 BlockAckWindow::BlockAckWindow()
     : m_winStart(0),
+      m_winSize(0),
       m_head(0)
 {
 }
@@ -39,14 +71,15 @@ BlockAckWindow::Init(uint16_t winStart, uint16_t winSize)
 {
     NS_LOG_FUNCTION(this << winStart << winSize);
     m_winStart = winStart;
-    m_window.assign(winSize, false);
+    m_winSize = winSize;
+    m_words.assign((winSize + WORD_BITS - 1) / WORD_BITS, 0);
     m_head = 0;
 }
 
 void
 BlockAckWindow::Reset(uint16_t winStart)
 {
-    Init(winStart, m_window.size());
+    Init(winStart, m_winSize);
 }
 
 uint16_t
@@ -58,29 +91,101 @@ BlockAckWindow::GetWinStart() const
 uint16_t
 BlockAckWindow::GetWinEnd() const
 {
-    return (m_winStart + m_window.size() - 1) % SEQNO_SPACE_SIZE;
+    return (m_winStart + m_winSize - 1) % SEQNO_SPACE_SIZE;
 }
 
 std::size_t
 BlockAckWindow::GetWinSize() const
 {
-    return m_window.size();
+    return m_winSize;
 }
 
-std::vector<bool>::reference
-BlockAckWindow::At(std::size_t distance)
+bool
+BlockAckWindow::At(std::size_t distance) const
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
 
-    return m_window.at((m_head + distance) % m_window.size());
+    std::size_t index = (m_head + distance) % m_winSize;
+    return (m_words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
 }
 
-std::vector<bool>::const_reference
-BlockAckWindow::At(std::size_t distance) const
+void
+BlockAckWindow::Set(std::size_t distance)
+{
+    NS_ASSERT(distance < m_winSize);
+
+    std::size_t index = (m_head + distance) % m_winSize;
+    m_words[index / WORD_BITS] |= uint64_t(1) << (index % WORD_BITS);
+}
+
+std::size_t
+BlockAckWindow::Find(std::size_t from, std::size_t to, bool value) const
+{
+    while (from < to)
+    {
+        std::size_t wordIndex = from / WORD_BITS;
+        uint64_t word = value ? m_words[wordIndex] : ~m_words[wordIndex];
+        // ignore the elements preceding the given one
+        word &= ~uint64_t(0) << (from % WORD_BITS);
+        if (word != 0)
+        {
+            return std::min(wordIndex * WORD_BITS + GetLowestSetBit(word), to);
+        }
+        from = (wordIndex + 1) * WORD_BITS;
+    }
+    return to;
+}
+
+std::size_t
+BlockAckWindow::FindNext(std::size_t distance, bool value) const
 {
-    NS_ASSERT(distance < m_window.size());
+    if (distance >= m_winSize)
+    {
+        return m_winSize;
+    }
+
+    std::size_t index = (m_head + distance) % m_winSize;
+    if (index >= m_head)
+    {
+        // search until the end of the bitmap and then from the beginning of the bitmap
+        if (std::size_t found = Find(index, m_winSize, value); found < m_winSize)
+        {
+            return found - m_head;
+        }
+        return Find(0, m_head, value) + m_winSize - m_head;
+    }
+    return Find(index, m_head, value) + m_winSize - m_head;
+}
 
-    return m_window.at((m_head + distance) % m_window.size());
+std::size_t
+BlockAckWindow::GetNextSet(std::size_t distance) const
+{
+    return FindNext(distance, true);
+}
+
+std::size_t
+BlockAckWindow::GetNextUnset(std::size_t distance) const
+{
+    return FindNext(distance, false);
+}
+
+void
+BlockAckWindow::Clear(std::size_t from, std::size_t to)
+{
+    while (from < to)
+    {
+        std::size_t wordIndex = from / WORD_BITS;
+        std::size_t first = from % WORD_BITS;
+        std::size_t last = std::min(to - wordIndex * WORD_BITS, WORD_BITS);
+        // mask with the bits in the range [first, last) set
+        uint64_t mask = ~uint64_t(0) << first;
+        if (last < WORD_BITS)
+        {
+            mask &= (uint64_t(1) << last) - 1;
+        }
+        m_words[wordIndex] &= ~mask;
+        from = wordIndex * WORD_BITS + last;
+    }
 }
 
 void
@@ -88,17 +193,23 @@ BlockAckWindow::Advance(std::size_t count)
 {
     NS_LOG_FUNCTION(this << count);
 
-    if (count >= m_window.size())
+    if (count >= m_winSize)
     {
         Reset((m_winStart + count) % SEQNO_SPACE_SIZE);
         return;
     }
 
-    for (std::size_t i = 0; i < count; i++)
+    // clear the elements that become part of the tail of the queue
+    if (m_head + count <= m_winSize)
+    {
+        Clear(m_head, m_head + count);
+    }
+    else
     {
-        m_window[m_head] = false;
-        m_head = (m_head + 1) % m_window.size();
+        Clear(m_head, m_winSize);
+        Clear(0, m_head + count - m_winSize);
     }
+    m_head = (m_head + count) % m_winSize;
     m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
 }
 
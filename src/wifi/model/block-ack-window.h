@@ -35,10 +35,12 @@ namespace ns3
  * a given number of positions. This class can be used to implement both
  * an originator's window and a recipient's window.
  *
- * The window is implemented as a vector of bool and managed as a circular
- * queue. The window is moved forward by advancing the head of the queue and
- * clearing the elements that become part of the tail of the queue. Hence,
- * no element is required to be shifted when the window moves forward.
+ * The window is implemented as a bitmap stored in a vector of 64-bit words and
+ * managed as a circular queue. The window is moved forward by advancing the head
+ * of the queue and clearing the elements that become part of the tail of the queue.
+ * Hence, no element is required to be shifted when the window moves forward.
+ * Clearing elements and searching for the next element that is set (or not set)
+ * are performed a word at a time.
  *
  * Example:
  *
@@ -94,25 +96,42 @@ class BlockAckWindow
      */
     std::size_t GetWinSize() const;
     /**
-     * Get a reference to the element in the window having the given distance from
+     * Get the value of the element in the window having the given distance from
      * the current winStart. Note that the given distance must be less than the
      * window size.
      *
      * \param distance the given distance
-     * \return a reference to the element in the window having the given distance
+     * \return the value of the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::reference At(std::size_t distance);
+    bool At(std::size_t distance) const;
     /**
-     * Get a const reference to the element in the window having the given distance from
-     * the current winStart. Note that the given distance must be less than the
-     * window size.
+     * Set the element in the window having the given distance from the current
+     * winStart. Note that the given distance must be less than the window size.
      *
      * \param distance the given distance
-     * \return a const reference to the element in the window having the given distance
-     *         from the current winStart
      */
-    std::vector<bool>::const_reference At(std::size_t distance) const;
+    void Set(std::size_t distance);
+    /**
+     * Get the distance from the current winStart of the first element that is set
+     * among the elements having a distance from the current winStart not less than
+     * the given distance.
+     *
+     * \param distance the given distance
+     * \return the distance of the first element that is set, or the window size if
+     *         no such element exists
+     */
+    std::size_t GetNextSet(std::size_t distance) const;
+    /**
+     * Get the distance from the current winStart of the first element that is not
+     * set among the elements having a distance from the current winStart not less
+     * than the given distance.
+     *
+     * \param distance the given distance
+     * \return the distance of the first element that is not set, or the window size
+     *         if no such element exists
+     */
+    std::size_t GetNextUnset(std::size_t distance) const;
     /**
      * Advance the current winStart by the given number of positions.
      *
@@ -121,9 +140,40 @@ class BlockAckWindow
     void Advance(std::size_t count);
 
   private:
-    uint16_t m_winStart;        ///< window start (sequence number)
-    std::vector<bool> m_window; ///< window
-    std::size_t m_head;         ///< index of winStart in the vector
+    /**
+     * Get the index in the bitmap of the first element having the given value
+     * among the elements whose index is in the range [from, to).
+     *
+     * \param from the index of the first element to check
+     * \param to the index following the last element to check
+     * \param value the value to search for
+     * \return the index of the first element having the given value, or <i>to</i>
+     *         if no such element exists
+     */
+    std::size_t Find(std::size_t from, std::size_t to, bool value) const;
+    /**
+     * Get the distance from the current winStart of the first element having the
+     * given value among the elements having a distance from the current winStart
+     * not less than the given distance.
+     *
+     * \param distance the given distance
+     * \param value the value to search for
+     * \return the distance of the first element having the given value, or the
+     *         window size if no such element exists
+     */
+    std::size_t FindNext(std::size_t distance, bool value) const;
+    /**
+     * Clear the elements whose index in the bitmap is in the range [from, to).
+     *
+     * \param from the index of the first element to clear
+     * \param to the index following the last element to clear
+     */
+    void Clear(std::size_t from, std::size_t to);
+
+    uint16_t m_winStart;           ///< window start (sequence number)
+    std::size_t m_winSize;         ///< window size
+    std::vector<uint64_t> m_words; ///< bitmap storing the window
+    std::size_t m_head;            ///< index of winStart in the bitmap
 };
 
 } // namespace ns3
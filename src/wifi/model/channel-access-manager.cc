@@ -584,6 +584,15 @@ ChannelAccessManager::DoRestartAccessTimeoutIfNeeded()
         {
             m_accessTimeout.Cancel();
         }
+        else if (m_accessTimeout.IsRunning() &&
+                 Simulator::Now() + Simulator::GetDelayLeft(m_accessTimeout) <
+                     GetAccessGrantStart())
+        {
+            // the access timeout would expire while the medium is still busy, hence it
+            // would only be rescheduled. Remove it from the scheduler and directly schedule
+            // it for when the first backoff can expire
+            m_accessTimeout.Remove();
+        }
         if (m_accessTimeout.IsExpired())
         {
             m_accessTimeout = Simulator::Schedule(expectedBackoffDelay,
@@ -675,6 +684,7 @@ ChannelAccessManager::NotifyRxStartNow(Time duration)
     m_lastRx.start = Simulator::Now();
     m_lastRx.end = m_lastRx.start + duration;
     m_lastRxReceivedOk = true;
+    DoRestartAccessTimeoutIfNeeded();
 }
 
 void
@@ -716,6 +726,7 @@ ChannelAccessManager::NotifyTxStartNow(Time duration)
     NS_LOG_DEBUG("tx start for " << duration);
     UpdateBackoff();
     m_lastTxEnd = now + duration;
+    DoRestartAccessTimeoutIfNeeded();
 }
 
 void
@@ -741,6 +752,7 @@ ChannelAccessManager::NotifyCcaBusyStartNow(Time duration,
             m_lastPer20MHzBusyEnd[chIdx] = now + per20MhzDurations[chIdx];
         }
     }
+    DoRestartAccessTimeoutIfNeeded();
 }
 
 void
@@ -884,6 +896,7 @@ ChannelAccessManager::NotifyNavStartNow(Time duration)
     NS_LOG_DEBUG("nav start for=" << duration);
     UpdateBackoff();
     m_lastNavEnd = std::max(m_lastNavEnd, Simulator::Now() + duration);
+    DoRestartAccessTimeoutIfNeeded();
 }
 
 void
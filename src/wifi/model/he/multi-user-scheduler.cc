@@ -327,10 +327,12 @@ MultiUserScheduler::GetMaxSizeOfQosNullAmpdu(const CtrlTriggerHeader& trigger) c
         auto address = m_apMac->GetMldOrLinkAddressByAid(userInfo.GetAid12());
         NS_ASSERT_MSG(address, "AID " << userInfo.GetAid12() << " not found");
 
+        // BA agreements are indexed by the MLD address if ML setup was performed,
+        // which is the address returned by GetMldOrLinkAddressByAid()
         uint8_t staNTids = 0;
         for (uint8_t tid = 0; tid < 8; tid++)
         {
-            if (m_apMac->GetBaAgreementEstablishedAsRecipient(*address, tid))
+            if (m_apMac->GetQosTxop(tid)->GetBaManager()->GetAgreementAsRecipient(*address, tid))
             {
                 staNTids++;
             }
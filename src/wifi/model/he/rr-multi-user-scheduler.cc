@@ -133,13 +133,18 @@ RrMultiUserScheduler::DoDispose()
     m_staListDl.clear();
     m_staListUl.clear();
     m_candidates.clear();
+    m_ruAllocations.clear();
     m_txParams.Clear();
-    m_apMac->TraceDisconnectWithoutContext(
-        "AssociatedSta",
-        MakeCallback(&RrMultiUserScheduler::NotifyStationAssociated, this));
-    m_apMac->TraceDisconnectWithoutContext(
-        "DeAssociatedSta",
-        MakeCallback(&RrMultiUserScheduler::NotifyStationDeassociated, this));
+    // the scheduler may have not been installed on an AP (e.g., in unit tests)
+    if (m_apMac)
+    {
+        m_apMac->TraceDisconnectWithoutContext(
+            "AssociatedSta",
+            MakeCallback(&RrMultiUserScheduler::NotifyStationAssociated, this));
+        m_apMac->TraceDisconnectWithoutContext(
+            "DeAssociatedSta",
+            MakeCallback(&RrMultiUserScheduler::NotifyStationDeassociated, this));
+    }
     MultiUserScheduler::DoDispose();
 }
 
@@ -185,15 +190,10 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
     NS_LOG_FUNCTION(this);
 
     // determine RUs to allocate to stations
-    auto count = std::min<std::size_t>(m_nStations, m_staListUl.size());
-    std::size_t nCentral26TonesRus;
-    HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
-    NS_ASSERT(count >= 1);
-
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
+    const auto& ruAllocation =
+        GetRuAllocation(m_allowedWidth, std::min<std::size_t>(m_nStations, m_staListUl.size()));
+    auto count = ruAllocation.nRus;
+    auto nCentral26TonesRus = (m_useCentral26TonesRus ? ruAllocation.nCentral26TonesRus : 0);
 
     Ptr<HeConfiguration> heConfiguration = m_apMac->GetHeConfiguration();
     NS_ASSERT(heConfiguration);
@@ -234,8 +234,12 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
         while (tid < 8)
         {
             // check that a BA agreement is established with the receiver for the
-            // considered TID, since ack sequences for UL MU require block ack
-            if (m_apMac->GetBaAgreementEstablishedAsRecipient(staIt->address, tid))
+            // considered TID, since ack sequences for UL MU require block ack.
+            // BA agreements are indexed by the address stored in the station list
+            // (the MLD address if ML setup was performed), hence there is no need
+            // to resolve the address through the AP MAC
+            if (m_apMac->GetQosTxop(tid)->GetBaManager()->GetAgreementAsRecipient(staIt->address,
+                                                                                   tid))
             {
                 break;
             }
@@ -607,17 +611,13 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
         return TxFormat::SU_TX;
     }
 
-    std::size_t count =
-        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size());
-    std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
-    NS_ASSERT(count >= 1);
-
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
+    const auto& ruAllocation = GetRuAllocation(
+        m_allowedWidth,
+        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size()));
+    std::size_t count = ruAllocation.nRus;
+    HeRu::RuType ruType = ruAllocation.ruType;
+    std::size_t nCentral26TonesRus =
+        (m_useCentral26TonesRus ? ruAllocation.nCentral26TonesRus : 0);
 
     uint8_t currTid = wifiAcList.at(primaryAc).GetHighTid();
 
@@ -775,10 +775,10 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     NS_ASSERT(txVector.GetHeMuUserInfoMap().size() == m_candidates.size());
 
     // compute how many stations can be granted an RU and the RU size
-    std::size_t nRusAssigned = m_candidates.size();
-    std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, nRusAssigned, nCentral26TonesRus);
+    const auto& ruAllocation = GetRuAllocation(m_allowedWidth, m_candidates.size());
+    std::size_t nRusAssigned = ruAllocation.nRus;
+    std::size_t nCentral26TonesRus = ruAllocation.nCentral26TonesRus;
+    HeRu::RuType ruType = ruAllocation.ruType;
 
     NS_LOG_DEBUG(nRusAssigned << " stations are being assigned a " << ruType << " RU");
 
@@ -797,10 +797,8 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     std::swap(heMuUserInfoMap, txVector.GetHeMuUserInfoMap());
 
     auto candidateIt = m_candidates.begin(); // iterator over the list of candidate receivers
-    auto ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
-    auto ruSetIt = ruSet.begin();
-    auto central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruType);
-    auto central26TonesRusIt = central26TonesRus.begin();
+    auto ruSetIt = ruAllocation.rus.cbegin();
+    auto central26TonesRusIt = ruAllocation.central26TonesRus.cbegin();
 
     for (std::size_t i = 0; i < nRusAssigned + nCentral26TonesRus; i++)
     {
@@ -819,6 +817,37 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     m_candidates.erase(candidateIt, m_candidates.end());
 }
 
+const RrMultiUserScheduler::RuAllocation&
+RrMultiUserScheduler::GetRuAllocation(uint16_t channelWidth, std::size_t nStations)
+{
+    NS_LOG_FUNCTION(this << channelWidth << nStations);
+    NS_ASSERT(nStations >= 1);
+
+    auto [it, inserted] = m_ruAllocations.try_emplace(channelWidth);
+
+    if (inserted)
+    {
+        // compute the allocations for all the numbers of stations that can be
+        // allocated an RU on a channel of the given width, i.e., up to the
+        // number of 26-tone RUs
+        for (std::size_t n = 1; n <= HeRu::GetNRus(channelWidth, HeRu::RU_26_TONE); n++)
+        {
+            RuAllocation allocation;
+            allocation.nRus = n;
+            allocation.ruType = HeRu::GetEqualSizedRusForStations(channelWidth,
+                                                                  allocation.nRus,
+                                                                  allocation.nCentral26TonesRus);
+            allocation.rus = HeRu::GetRusOfType(channelWidth, allocation.ruType);
+            allocation.central26TonesRus =
+                HeRu::GetCentral26TonesRus(channelWidth, allocation.ruType);
+            it->second.push_back(std::move(allocation));
+        }
+    }
+
+    // more stations than 26-tone RUs are allocated as many RUs as the 26-tone RUs
+    return it->second.at(std::min(nStations, it->second.size()) - 1);
+}
+
 void
 RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
                                     Time txDuration,
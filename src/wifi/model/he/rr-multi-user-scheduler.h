@@ -23,6 +23,10 @@
 #include "multi-user-scheduler.h"
 
 #include <list>
+#include <map>
+#include <vector>
+
+class RrMultiUserSchedulerRuAllocationTest;
 
 namespace ns3
 {
@@ -44,6 +48,9 @@ namespace ns3
 class RrMultiUserScheduler : public MultiUserScheduler
 {
   public:
+    /// allow RrMultiUserSchedulerRuAllocationTest class access
+    friend class ::RrMultiUserSchedulerRuAllocationTest;
+
     /**
      * \brief Get the type ID.
      * \return the object TypeId
@@ -116,6 +123,31 @@ class RrMultiUserScheduler : public MultiUserScheduler
      */
     void NotifyStationDeassociated(uint16_t aid, Mac48Address address);
 
+    /**
+     * Allocation of equal-sized RUs (and possibly central 26-tone RUs) to stations
+     * on a channel of a given width
+     */
+    struct RuAllocation
+    {
+        std::size_t nRus;                            //!< number of equal-sized RUs
+        HeRu::RuType ruType;                         //!< type of the equal-sized RUs
+        std::size_t nCentral26TonesRus;              //!< number of central 26-tone RUs
+        std::vector<HeRu::RuSpec> rus;               //!< the equal-sized RUs
+        std::vector<HeRu::RuSpec> central26TonesRus; //!< the central 26-tone RUs
+    };
+
+    /**
+     * Get the allocation of equal-sized RUs to the largest number of stations, not
+     * exceeding the given number of stations, that can be allocated an RU on a channel
+     * of the given width without leaving RUs unallocated. The allocations for a channel
+     * width are computed the first time that channel width is considered and then reused.
+     *
+     * \param channelWidth the channel width in MHz
+     * \param nStations the number of stations (at least one)
+     * \return the allocation of equal-sized RUs
+     */
+    const RuAllocation& GetRuAllocation(uint16_t channelWidth, std::size_t nStations);
+
     /**
      * Information used to sort stations
      */
@@ -170,6 +202,8 @@ class RrMultiUserScheduler : public MultiUserScheduler
     CtrlTriggerHeader m_trigger;           //!< Trigger Frame to send
     WifiMacHeader m_triggerMacHdr;         //!< MAC header for Trigger Frame
     WifiTxParameters m_txParams;           //!< TX parameters
+    std::map<uint16_t, std::vector<RuAllocation>>
+        m_ruAllocations; //!< per channel width RU allocations, indexed by number of stations - 1
 };
 
 } // namespace ns3
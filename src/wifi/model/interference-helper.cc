@@ -310,32 +310,45 @@ void
 InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartOfdmaRxing)
 {
     NS_LOG_FUNCTION(this << event << isStartOfdmaRxing);
+    // both the bands of the event and the bands in m_niChangesPerBand (and in
+    // m_firstPowerPerBand) are sorted, hence they can be visited side by side
+    auto niIt = m_niChangesPerBand.begin();
+    auto firstPowerIt = m_firstPowerPerBand.begin();
     for (const auto& it : event->GetRxPowerWPerBand())
     {
         WifiSpectrumBand band = it.first;
-        auto niIt = m_niChangesPerBand.find(band);
-        NS_ASSERT(niIt != m_niChangesPerBand.end());
-        double previousPowerStart = 0;
-        double previousPowerEnd = 0;
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
+        while (niIt != m_niChangesPerBand.end() && niIt->first < band)
+        {
+            ++niIt;
+            ++firstPowerIt;
+        }
+        NS_ASSERT(niIt != m_niChangesPerBand.end() && niIt->first == band);
+        NS_ASSERT(firstPowerIt->first == band);
+        // the positions where the start and the end of the event have to be inserted
+        auto nextPowerStartPosition = GetNextPosition(event->GetStartTime(), niIt);
+        auto nextPowerEndPosition = GetNextPosition(event->GetEndTime(), niIt);
+        // This is safe since there is always an NiChange at time 0, before the event
+        double previousPowerStart = std::prev(nextPowerStartPosition)->second.GetPower();
+        double previousPowerEnd = std::prev(nextPowerEndPosition)->second.GetPower();
         if (!m_rxing)
         {
-            m_firstPowerPerBand.find(band)->second = previousPowerStart;
+            firstPowerIt->second = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            niIt->second.erase(++(niIt->second.begin()), nextPowerStartPosition);
         }
         else if (isStartOfdmaRxing)
         {
             // When the first UL-OFDMA payload is received, we need to set m_firstPowerPerBand
             // so that it takes into account interferences that arrived between the start of the
             // UL MU transmission and the start of UL-OFDMA payload.
-            m_firstPowerPerBand.find(band)->second = previousPowerStart;
+            firstPowerIt->second = previousPowerStart;
         }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+        auto first = niIt->second.insert(
+            nextPowerStartPosition,
+            std::make_pair(event->GetStartTime(), NiChange(previousPowerStart, event)));
+        auto last = niIt->second.insert(
+            nextPowerEndPosition,
+            std::make_pair(event->GetEndTime(), NiChange(previousPowerEnd, event)));
         for (auto i = first; i != last; ++i)
         {
             i->second.AddPower(it.second);
@@ -671,6 +684,64 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
     return snr;
 }
 
+double
+InterferenceHelper::CalculatePayloadEffectiveSnr(Ptr<Event> event,
+                                                 uint16_t channelWidth,
+                                                 WifiSpectrumBand band,
+                                                 uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << band.first << band.second << staId);
+    NiChangesPerBand nis;
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, &nis, band);
+    double powerW = event->GetRxPowerW(band);
+    const WifiTxVector& txVector = event->GetTxVector();
+    uint8_t nss = txVector.GetNss(staId);
+    Time payloadStart =
+        event->GetStartTime() + WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    Time payloadDuration = event->GetEndTime() - payloadStart;
+    if (!payloadDuration.IsStrictlyPositive())
+    {
+        return CalculateSnr(powerW, noiseInterferenceW, channelWidth, nss);
+    }
+
+    const auto& ni = nis.find(band)->second;
+    auto j = ni.cbegin();
+    Time previous = j->first;
+    noiseInterferenceW = m_firstPowerPerBand.find(band)->second;
+    double energy = 0; // noise and interference power integrated over the payload
+    while (++j != ni.cend())
+    {
+        Time current = j->first;
+        NS_ASSERT(current >= previous);
+        if (current > payloadStart)
+        {
+            energy += noiseInterferenceW * (current - Max(previous, payloadStart)).GetSeconds();
+        }
+        noiseInterferenceW = j->second.GetPower() - powerW;
+        previous = current;
+    }
+    return CalculateSnr(powerW, energy / payloadDuration.GetSeconds(), channelWidth, nss);
+}
+
+double
+InterferenceHelper::CalculateMpduPer(double snr,
+                                     uint32_t size,
+                                     const WifiTxVector& txVector,
+                                     uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << snr << size << txVector << staId);
+    // divide effective number of bits by NSS to achieve same chunk error rate as SISO for AWGN
+    uint64_t nbits = static_cast<uint64_t>(size) * 8 / txVector.GetNss(staId);
+    double csr = m_errorRateModel->GetChunkSuccessRate(txVector.GetMode(staId),
+                                                       txVector,
+                                                       snr,
+                                                       nbits,
+                                                       m_numRxAntennas,
+                                                       WIFI_PPDU_FIELD_DATA,
+                                                       staId);
+    return 1 - csr;
+}
+
 struct PhyEntity::SnrPer
 InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              uint16_t channelWidth,
@@ -254,6 +254,36 @@ class InterferenceHelper : public Object
                         uint16_t channelWidth,
                         uint8_t nss,
                         WifiSpectrumBand band) const;
+    /**
+     * Calculate the effective SNIR of the payload of the given SU PPDU, i.e. the SNIR
+     * obtained with the noise and interference power averaged over the payload duration.
+     *
+     * \param event the event corresponding to the first time the corresponding PPDU arrives
+     * \param channelWidth the channel width used to transmit the PSDU (in MHz)
+     * \param band identify the band used by the PSDU
+     * \param staId the station ID of the PSDU
+     *
+     * \return the effective SNR of the payload in linear scale
+     */
+    double CalculatePayloadEffectiveSnr(Ptr<Event> event,
+                                        uint16_t channelWidth,
+                                        WifiSpectrumBand band,
+                                        uint16_t staId) const;
+    /**
+     * Calculate the PER of an MPDU received with the given (effective) SNIR, as
+     * provided by the error rate model for the size of the MPDU.
+     *
+     * \param snr the SNIR in linear scale
+     * \param size the size of the MPDU (in bytes)
+     * \param txVector the TXVECTOR of the PPDU carrying the MPDU
+     * \param staId the station ID of the PSDU
+     *
+     * \return the PER of the MPDU
+     */
+    double CalculateMpduPer(double snr,
+                            uint32_t size,
+                            const WifiTxVector& txVector,
+                            uint16_t staId) const;
     /**
      * Calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
@@ -270,6 +270,16 @@ PhyEntity::SnrPer
 PhyEntity::GetPhyHeaderSnrPer(WifiPpduField field, Ptr<Event> event) const
 {
     uint16_t measurementChannelWidth = GetMeasurementChannelWidth(event->GetPpdu());
+    if (IsReceptionAbstracted(event->GetTxVector()))
+    {
+        // PHY headers are always correctly received once the preamble has been detected
+        return SnrPer(m_wifiPhy->m_interference->CalculateSnr(
+                          event,
+                          measurementChannelWidth,
+                          1,
+                          GetPrimaryBand(measurementChannelWidth)),
+                      0.0);
+    }
     return m_wifiPhy->m_interference->CalculatePhyHeaderSnrPer(
         event,
         measurementChannelWidth,
@@ -296,6 +306,13 @@ PhyEntity::StartReceiveField(WifiPpduField field, Ptr<Event> event)
     NS_ABORT_MSG_IF(!supported,
                     "Unknown field "
                         << field << " for this PHY entity"); // TODO see what to do if not supported
+    if (IsReceptionAbstracted(event->GetTxVector()))
+    {
+        // the PHY headers are all processed at the start of the payload, the PHY has been
+        // kept in CCA busy since the end of the preamble detection period
+        EndReceiveField(field, event);
+        return;
+    }
     Time duration = GetDuration(field, event->GetTxVector());
     m_wifiPhy->m_endPhyRxEvent =
         Simulator::Schedule(duration, &PhyEntity::EndReceiveField, this, field, event);
@@ -319,6 +336,9 @@ PhyEntity::EndReceiveField(WifiPpduField field, Ptr<Event> event)
     else
     {
         Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+        Time remainingDuration = IsReceptionAbstracted(txVector)
+                                     ? event->GetEndTime() - Simulator::Now()
+                                     : GetRemainingDurationAfterField(ppdu, field);
         switch (status.actionIfFailure)
         {
         case ABORT:
@@ -340,15 +360,12 @@ PhyEntity::EndReceiveField(WifiPpduField field, Ptr<Event> event)
                                      // triggered for filtered PPDUs
             }
             m_wifiPhy->NotifyRxDrop(GetAddressedPsduInPpdu(ppdu), status.reason);
-            m_wifiPhy->NotifyCcaBusy(ppdu, GetRemainingDurationAfterField(ppdu, field));
+            m_wifiPhy->NotifyCcaBusy(ppdu, remainingDuration);
         // no break
         case IGNORE:
             // Keep in Rx state and reset at end
             m_endRxPayloadEvents.push_back(
-                Simulator::Schedule(GetRemainingDurationAfterField(ppdu, field),
-                                    &PhyEntity::ResetReceive,
-                                    this,
-                                    event));
+                Simulator::Schedule(remainingDuration, &PhyEntity::ResetReceive, this, event));
             break;
         default:
             NS_FATAL_ERROR("Unknown action in case of failure");
@@ -589,8 +606,11 @@ PhyEntity::DoStartReceivePayload(Ptr<Event> event)
     uint16_t staId = GetStaId(ppdu);
     m_signalNoiseMap.insert({std::make_pair(ppdu->GetUid(), staId), SignalNoiseDbm()});
     m_statusPerMpduMap.insert({std::make_pair(ppdu->GetUid(), staId), std::vector<bool>()});
-    ScheduleEndOfMpdus(event);
     const WifiTxVector& txVector = event->GetTxVector();
+    if (!IsReceptionAbstracted(txVector))
+    {
+        ScheduleEndOfMpdus(event);
+    }
     Time payloadDuration = ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
     m_wifiPhy->m_phyRxPayloadBeginTrace(
         txVector,
@@ -701,6 +721,57 @@ PhyEntity::EndOfMpdu(Ptr<Event> event,
     }
 }
 
+void
+PhyEntity::EndOfAbstractedMpdus(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
+    const WifiTxVector& txVector = event->GetTxVector();
+    uint16_t staId = GetStaId(ppdu);
+    const auto& channelWidthAndBand = GetChannelWidthAndBand(txVector, staId);
+    double snr = m_wifiPhy->m_interference->CalculatePayloadEffectiveSnr(event,
+                                                                         channelWidthAndBand.first,
+                                                                         channelWidthAndBand.second,
+                                                                         staId);
+
+    SignalNoiseDbm signalNoise;
+    signalNoise.signal = WToDbm(event->GetRxPowerW(channelWidthAndBand.second));
+    signalNoise.noise = WToDbm(event->GetRxPowerW(channelWidthAndBand.second) / snr);
+    auto signalNoiseIt = m_signalNoiseMap.find(std::make_pair(ppdu->GetUid(), staId));
+    NS_ASSERT(signalNoiseIt != m_signalNoiseMap.end());
+    signalNoiseIt->second = signalNoise;
+
+    RxSignalInfo rxSignalInfo;
+    rxSignalInfo.snr = snr;
+    rxSignalInfo.rssi = signalNoise.signal;
+
+    auto statusPerMpduIt = m_statusPerMpduMap.find(std::make_pair(ppdu->GetUid(), staId));
+    NS_ASSERT(statusPerMpduIt != m_statusPerMpduMap.end());
+
+    std::size_t nMpdus = psdu->GetNMpdus();
+    std::size_t i = 0;
+    for (auto mpdu = psdu->begin(); mpdu != psdu->end(); ++mpdu, ++i)
+    {
+        uint32_t size = psdu->IsAggregate() ? psdu->GetAmpduSubframeSize(i) : psdu->GetSize();
+        double per = m_wifiPhy->m_interference->CalculateMpduPer(snr, size, txVector, staId);
+        Ptr<const WifiPsdu> mpduPsdu = Create<WifiPsdu>(*mpdu, false);
+        bool success = GetRandomValue() > per &&
+                       !(m_wifiPhy->m_postReceptionErrorModel &&
+                         m_wifiPhy->m_postReceptionErrorModel->IsCorrupt(
+                             mpduPsdu->GetPacket()->Copy()));
+        NS_LOG_DEBUG("MPDU #" << i << ": size=" << size << ", SNR(dB)=" << RatioToDb(snr)
+                              << ", PER=" << per << ", correct reception: " << success);
+        statusPerMpduIt->second.push_back(success);
+
+        if (success && nMpdus > 1)
+        {
+            // only done for correct MPDU that is part of an A-MPDU
+            m_state->NotifyRxMpdu(mpduPsdu, rxSignalInfo, txVector);
+        }
+    }
+}
+
 void
 PhyEntity::EndReceivePayload(Ptr<Event> event)
 {
@@ -709,6 +780,10 @@ PhyEntity::EndReceivePayload(Ptr<Event> event)
     Time psduDuration = ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
     NS_LOG_FUNCTION(this << *event << psduDuration);
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
+    if (IsReceptionAbstracted(txVector))
+    {
+        EndOfAbstractedMpdus(event);
+    }
     uint16_t staId = GetStaId(ppdu);
     const auto& channelWidthAndBand = GetChannelWidthAndBand(event->GetTxVector(), staId);
     double snr = m_wifiPhy->m_interference->CalculateSnr(event,
@@ -1022,9 +1097,12 @@ PhyEntity::EndPreambleDetectionPeriod(Ptr<Event> event)
                                  m_wifiPhy->m_currentEvent->GetRxPowerWPerBand());
         m_wifiPhy->m_timeLastPreambleDetected = Simulator::Now();
 
-        // Continue receiving preamble
-        Time durationTillEnd = GetDuration(WIFI_PPDU_FIELD_PREAMBLE, event->GetTxVector()) -
-                               m_wifiPhy->GetPreambleDetectionDuration();
+        // Continue receiving preamble (and PHY headers, if their reception is abstracted)
+        Time durationTillEnd =
+            (IsReceptionAbstracted(event->GetTxVector())
+                 ? CalculatePhyPreambleAndHeaderDuration(event->GetTxVector())
+                 : GetDuration(WIFI_PPDU_FIELD_PREAMBLE, event->GetTxVector())) -
+            m_wifiPhy->GetPreambleDetectionDuration();
         m_wifiPhy->NotifyCcaBusy(event->GetPpdu(),
                                  durationTillEnd); // will be prolonged by next field
         m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule(durationTillEnd,
@@ -1152,6 +1230,12 @@ PhyEntity::DoResetReceive(Ptr<Event> event)
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
 }
 
+bool
+PhyEntity::IsReceptionAbstracted(const WifiTxVector& txVector) const
+{
+    return m_wifiPhy->m_abstractedReception && !txVector.IsMu();
+}
+
 double
 PhyEntity::GetRandomValue() const
 {
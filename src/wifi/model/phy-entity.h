@@ -725,6 +725,14 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      * \param event the event holding incoming PPDU's information
      */
     void ScheduleEndOfMpdus(Ptr<Event> event);
+    /**
+     * The last symbol of a PPDU whose reception is abstracted has arrived.
+     * Determine the reception status of all its MPDUs from the effective SINR
+     * over the payload.
+     *
+     * \param event the event holding incoming PPDU's information
+     */
+    void EndOfAbstractedMpdus(Ptr<Event> event);
 
     /**
      * Perform amendment-specific actions when the payload is successfully received.
@@ -777,6 +785,16 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void AbortCurrentReception(WifiPhyRxfailureReason reason);
 
+    /**
+     * Whether the reception of a PPDU transmitted with the given TXVECTOR is
+     * abstracted, i.e. its PHY headers are not processed field by field and its
+     * MPDUs are all evaluated at the end of the PPDU (see the AbstractedReception
+     * attribute of WifiPhy).
+     *
+     * \param txVector the TXVECTOR of the PPDU
+     * \return true if the reception of the PPDU is abstracted, false otherwise
+     */
+    bool IsReceptionAbstracted(const WifiTxVector& txVector) const;
     /**
      * Obtain a random value from the WifiPhy's generator.
      * Wrapper used by child classes.
@@ -66,8 +66,9 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
     uint32_t m_ampduLen;         //!< Number of MPDUs in an A-MPDU.
     uint32_t m_ampduPacketCount; //!< Number of A-MPDUs transmitted.
 
-    McsGroupData m_groupsTable; //!< Table of groups with stats.
-    bool m_isHt;                //!< If the station is HT capable.
+    McsGroupData m_groupsTable;             //!< Table of groups with stats.
+    std::vector<uint8_t> m_supportedGroups; //!< IDs of the supported groups (in increasing order).
+    bool m_isHt;                            //!< If the station is HT capable.
 
     std::ofstream m_statsFile; //!< File where statistics table is written.
 };
@@ -978,20 +979,22 @@ MinstrelHtWifiManager::UpdateRateAfterAllowedWidth(uint16_t txRate, uint16_t all
     NS_LOG_FUNCTION(this << txRate << allowedWidth);
 
     auto groupId = GetGroupId(txRate);
-    McsGroup group = m_minstrelGroups[groupId];
+    // the groups considered below only differ in the channel width, hence there is no
+    // need to copy them (along with their TX time tables)
+    const McsGroup* group = &m_minstrelGroups[groupId];
 
-    if (group.chWidth <= allowedWidth)
+    if (group->chWidth <= allowedWidth)
     {
         NS_LOG_DEBUG("Channel width is not greater than allowed width, nothing to do");
         return txRate;
     }
 
     NS_ASSERT(GetHtSupported());
-    NS_ASSERT(group.chWidth % 20 == 0);
+    NS_ASSERT(group->chWidth % 20 == 0);
     // try halving the channel width and check if the group with the same number of
     // streams and same GI is supported, until either a supported group is found or
     // the width becomes lower than 20 MHz
-    uint16_t width = group.chWidth / 2;
+    uint16_t width = group->chWidth / 2;
 
     while (width >= 20)
     {
@@ -1001,23 +1004,23 @@ MinstrelHtWifiManager::UpdateRateAfterAllowedWidth(uint16_t txRate, uint16_t all
             continue;
         }
 
-        switch (group.type)
+        switch (group->type)
         {
         case WIFI_MINSTREL_GROUP_HT:
-            groupId = GetHtGroupId(group.streams, group.gi, width);
+            groupId = GetHtGroupId(group->streams, group->gi, width);
             break;
         case WIFI_MINSTREL_GROUP_VHT:
-            groupId = GetVhtGroupId(group.streams, group.gi, width);
+            groupId = GetVhtGroupId(group->streams, group->gi, width);
             break;
         case WIFI_MINSTREL_GROUP_HE:
-            groupId = GetHeGroupId(group.streams, group.gi, width);
+            groupId = GetHeGroupId(group->streams, group->gi, width);
             break;
         default:
-            NS_ABORT_MSG("Unknown group type: " << group.type);
+            NS_ABORT_MSG("Unknown group type: " << group->type);
         }
 
-        group = m_minstrelGroups[groupId];
-        if (group.isSupported)
+        group = &m_minstrelGroups[groupId];
+        if (group->isSupported)
         {
             break;
         }
@@ -1064,7 +1067,7 @@ MinstrelHtWifiManager::DoGetDataTxVector(WifiRemoteStation* st, uint16_t allowed
         NS_LOG_DEBUG("DoGetDataMode rateId= " << +rateId << " groupId= " << +groupId
                                               << " mode= " << GetMcsSupported(station, mcsIndex));
 
-        McsGroup group = m_minstrelGroups[groupId];
+        const McsGroup& group = m_minstrelGroups[groupId];
 
         // Check consistency of rate selected.
         if (((group.type == WIFI_MINSTREL_GROUP_HE) && (group.gi < GetGuardInterval(station))) ||
@@ -1437,93 +1440,76 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     station->m_maxTpRate2 = GetLowestIndex(station);
     station->m_maxProbRate = GetLowestIndex(station);
 
-    /// Update throughput and EWMA for each rate inside each group.
-    for (uint8_t j = 0; j < m_numGroups; j++)
+    /// Update throughput and EWMA for each rate inside each supported group.
+    for (const auto j : station->m_supportedGroups)
     {
-        if (station->m_groupsTable[j].m_supported)
-        {
-            station->m_sampleCount++;
+        GroupInfo& group = station->m_groupsTable[j];
+        station->m_sampleCount++;
 
-            /* (re)Initialize group rate indexes */
-            station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
+        /* (re)Initialize group rate indexes */
+        group.m_maxTpRate = GetLowestIndex(station, j);
+        group.m_maxTpRate2 = GetLowestIndex(station, j);
+        group.m_maxProbRate = GetLowestIndex(station, j);
 
-            for (uint8_t i = 0; i < m_numRates; i++)
+        for (uint8_t i = 0; i < m_numRates; i++)
+        {
+            MinstrelHtRateInfo& rate = group.m_ratesTable[i];
+
+            if (rate.supported)
             {
-                if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                    station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                    NS_LOG_DEBUG(
-                        +i << " "
-                           << GetMcsSupported(station,
-                                              station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
-                           << "\t attempt="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt
-                           << "\t success="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
-
-                    /// If we've attempted something.
-                    if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                        /**
-                         * Calculate the probability of success.
-                         * Assume probability scales from 0 to 100.
-                         */
-                        tempProb =
-                            (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) /
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
+                rate.retryUpdated = false;
 
-                        /// Bookkeeping.
-                        station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
+                NS_LOG_DEBUG(+i << " " << GetMcsSupported(station, rate.mcsIndex)
+                                << "\t attempt=" << rate.numRateAttempt
+                                << "\t success=" << rate.numRateSuccess);
 
-                        if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                        else
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmsdProb =
-                                CalculateEwmsd(station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                               tempProb,
-                                               station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                               m_ewmaLevel);
-                            /// EWMA probability
-                            tempProb =
-                                (tempProb * (100 - m_ewmaLevel) +
-                                 station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel) /
-                                100;
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
+                /// If we've attempted something.
+                if (rate.numRateAttempt > 0)
+                {
+                    rate.numSamplesSkipped = 0;
+                    /**
+                     * Calculate the probability of success.
+                     * Assume probability scales from 0 to 100.
+                     */
+                    tempProb = (100 * rate.numRateSuccess) / rate.numRateAttempt;
 
-                        station->m_groupsTable[j].m_ratesTable[i].throughput =
-                            CalculateThroughput(station, j, i, tempProb);
+                    /// Bookkeeping.
+                    rate.prob = tempProb;
 
-                        station->m_groupsTable[j].m_ratesTable[i].successHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                        station->m_groupsTable[j].m_ratesTable[i].attemptHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
+                    if (rate.successHist == 0)
+                    {
+                        rate.ewmaProb = tempProb;
                     }
                     else
                     {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
+                        rate.ewmsdProb =
+                            CalculateEwmsd(rate.ewmsdProb, tempProb, rate.ewmaProb, m_ewmaLevel);
+                        /// EWMA probability
+                        tempProb =
+                            (tempProb * (100 - m_ewmaLevel) + rate.ewmaProb * m_ewmaLevel) / 100;
+                        rate.ewmaProb = tempProb;
                     }
 
-                    /// Bookkeeping.
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
-
-                    if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                        SetBestStationThRates(station, GetIndex(j, i));
-                        SetBestProbabilityRate(station, GetIndex(j, i));
-                    }
+                    rate.throughput = CalculateThroughput(station, j, i, tempProb);
+
+                    rate.successHist += rate.numRateSuccess;
+                    rate.attemptHist += rate.numRateAttempt;
+                }
+                else
+                {
+                    rate.numSamplesSkipped++;
+                }
+
+                /// Bookkeeping.
+                rate.prevNumRateSuccess = rate.numRateSuccess;
+                rate.prevNumRateAttempt = rate.numRateAttempt;
+                rate.numRateSuccess = 0;
+                rate.numRateAttempt = 0;
+
+                if (rate.throughput != 0)
+                {
+                    SetBestStationThRates(station, GetIndex(j, i));
+                    SetBestProbabilityRate(station, GetIndex(j, i));
                 }
             }
         }
@@ -1582,7 +1568,6 @@ void
 MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* station, uint16_t index)
 {
     GroupInfo* group;
-    MinstrelHtRateInfo rate;
     uint8_t tmpGroupId;
     uint8_t tmpRateId;
     double tmpTh;
@@ -1598,7 +1583,7 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
     groupId = GetGroupId(index);
     rateId = GetRateId(index);
     group = &station->m_groupsTable[groupId];
-    rate = group->m_ratesTable[rateId];
+    const MinstrelHtRateInfo& rate = group->m_ratesTable[rateId];
 
     tmpGroupId = GetGroupId(station->m_maxProbRate);
     tmpRateId = GetRateId(station->m_maxProbRate);
@@ -1714,6 +1699,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
 
     station->m_groupsTable = McsGroupData(m_numGroups);
+    station->m_supportedGroups.clear();
 
     /**
      * Initialize groups supported by the receiver.
@@ -1784,6 +1770,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
 
             noSupportedGroupFound = false;
             station->m_groupsTable[groupId].m_supported = true;
+            station->m_supportedGroups.push_back(groupId);
             station->m_groupsTable[groupId].m_col = 0;
             station->m_groupsTable[groupId].m_index = 0;
 
@@ -2021,7 +2008,7 @@ MinstrelHtWifiManager::StatsDump(MinstrelHtWifiRemoteStation* station,
                                  std::ofstream& of)
 {
     uint8_t numRates = m_numRates;
-    McsGroup group = m_minstrelGroups[groupId];
+    const McsGroup& group = m_minstrelGroups[groupId];
     Time txTime;
     for (uint8_t i = 0; i < numRates; i++)
     {
@@ -2207,12 +2194,9 @@ MinstrelHtWifiManager::GetLowestIndex(MinstrelHtWifiRemoteStation* station)
 {
     NS_LOG_FUNCTION(this << station);
 
-    uint8_t groupId = 0;
+    NS_ASSERT(!station->m_supportedGroups.empty());
+    uint8_t groupId = station->m_supportedGroups.front();
     uint8_t rateId = 0;
-    while (groupId < m_numGroups && !station->m_groupsTable[groupId].m_supported)
-    {
-        groupId++;
-    }
     while (rateId < m_numRates && !station->m_groupsTable[groupId].m_ratesTable[rateId].supported)
     {
         rateId++;
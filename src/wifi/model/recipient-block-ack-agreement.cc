@@ -133,12 +133,12 @@ RecipientBlockAckAgreement::NotifyReceivedMpdu(Ptr<const WifiMpdu> mpdu)
     if (distance < m_scoreboard.GetWinSize())
     {
         // set to 1 the bit in position SN within the bitmap
-        m_scoreboard.At(distance) = true;
+        m_scoreboard.Set(distance);
     }
     else if (distance < SEQNO_SPACE_HALF_SIZE)
     {
         m_scoreboard.Advance(distance - m_scoreboard.GetWinSize() + 1);
-        m_scoreboard.At(m_scoreboard.GetWinSize() - 1) = true;
+        m_scoreboard.Set(m_scoreboard.GetWinSize() - 1);
     }
 
     distance = GetDistance(mpduSeqNumber, m_winStartB);
@@ -253,12 +253,10 @@ RecipientBlockAckAgreement::FillBlockAckBitmap(CtrlBAckResponseHeader* blockAckH
         blockAckHeader->SetStartingSequence(ssn, index);
         blockAckHeader->ResetBitmap(index);
 
-        for (std::size_t i = 0; i < m_scoreboard.GetWinSize(); i++)
+        for (std::size_t i = m_scoreboard.GetNextSet(0); i < m_scoreboard.GetWinSize();
+             i = m_scoreboard.GetNextSet(i + 1))
         {
-            if (m_scoreboard.At(i))
-            {
-                blockAckHeader->SetReceivedPacket((ssn + i) % SEQNO_SPACE_SIZE, index);
-            }
+            blockAckHeader->SetReceivedPacket((ssn + i) % SEQNO_SPACE_SIZE, index);
         }
     }
 }
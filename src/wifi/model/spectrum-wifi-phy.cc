@@ -37,6 +37,8 @@
 #include "ns3/simulator.h"
 #include "ns3/wifi-net-device.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -158,10 +160,11 @@ SpectrumWifiPhy::UpdateInterferenceHelperBands()
     NS_LOG_FUNCTION(this);
     uint16_t channelWidth = GetChannelWidth();
     m_interference->RemoveBands();
+    m_bands.clear();
     if (channelWidth < 20)
     {
         WifiSpectrumBand band = GetBand(channelWidth);
-        m_interference->AddBand(band);
+        m_bands.push_back(band);
     }
     else
     {
@@ -169,7 +172,7 @@ SpectrumWifiPhy::UpdateInterferenceHelperBands()
         {
             for (uint32_t i = 0; i < (channelWidth / bw); ++i)
             {
-                m_interference->AddBand(GetBand(bw, i));
+                m_bands.push_back(GetBand(bw, i));
             }
         }
     }
@@ -221,9 +224,16 @@ SpectrumWifiPhy::UpdateInterferenceHelperBands()
         }
         for (const auto& bandRuPair : m_ruBands[channelWidth])
         {
-            m_interference->AddBand(bandRuPair.first);
+            m_bands.push_back(bandRuPair.first);
         }
     }
+    // the received power is computed for all these bands upon every reception and
+    // sorting them allows to efficiently build the map of the received powers
+    std::sort(m_bands.begin(), m_bands.end());
+    for (const auto& band : m_bands)
+    {
+        m_interference->AddBand(band);
+    }
 }
 
 Ptr<Channel>
@@ -292,78 +302,40 @@ SpectrumWifiPhy::StartRx(Ptr<SpectrumSignalParameters> rxParams)
     // Integrate over our receive bandwidth (i.e., all that the receive
     // spectral mask representing our filtering allows) to find the
     // total energy apparent to the "demodulator".
-    // This is done per 20 MHz channel band.
-    uint16_t channelWidth = GetChannelWidth();
-    double totalRxPowerW = 0;
+    // This is done for every band handled by the InterferenceHelper, i.e., per
+    // 20 MHz channel band, per wider channel band and per RU band (for HE).
+    // Bands are sorted, hence each of them is inserted at the end of the map.
+    if (m_bands.empty())
+    {
+        // bands are set when the RX spectrum model is created
+        GetRxSpectrumModel();
+    }
+    NS_ASSERT(!m_bands.empty());
+    const double rxGain = DbToRatio(GetRxGain());
     RxPowerWattPerChannelBand rxPowerW;
-
-    if ((channelWidth == 5) || (channelWidth == 10))
+    for (const auto& band : m_bands)
     {
-        WifiSpectrumBand filteredBand = GetBand(channelWidth);
-        double rxPowerPerBandW =
-            WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, filteredBand);
-        NS_LOG_DEBUG("Signal power received (watts) before antenna gain: " << rxPowerPerBandW);
-        rxPowerPerBandW *= DbToRatio(GetRxGain());
-        totalRxPowerW += rxPowerPerBandW;
-        rxPowerW.insert({filteredBand, rxPowerPerBandW});
-        NS_LOG_DEBUG("Signal power received after antenna gain for "
-                     << channelWidth << " MHz channel: " << rxPowerPerBandW << " W ("
+        double rxPowerPerBandW = WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, band);
+        NS_LOG_DEBUG("Signal power received (watts) before antenna gain for band ("
+                     << band.first << "; " << band.second << "): " << rxPowerPerBandW);
+        rxPowerPerBandW *= rxGain;
+        NS_LOG_DEBUG("Signal power received after antenna gain for band ("
+                     << band.first << "; " << band.second << "): " << rxPowerPerBandW << " W ("
                      << WToDbm(rxPowerPerBandW) << " dBm)");
+        rxPowerW.emplace_hint(rxPowerW.end(), band, rxPowerPerBandW);
     }
 
-    // 20 MHz is handled apart since the totalRxPowerW is computed through it
-    for (uint16_t bw = 160; bw > 20; bw = bw / 2)
+    // the total received power is the sum of the power received over each 20 MHz
+    // channel band (or over the whole channel if narrower than 20 MHz)
+    uint16_t channelWidth = GetChannelWidth();
+    double totalRxPowerW = 0;
+    if ((channelWidth == 5) || (channelWidth == 10))
     {
-        for (uint32_t i = 0; i < (channelWidth / bw); i++)
-        {
-            NS_ASSERT(channelWidth >= bw);
-            WifiSpectrumBand filteredBand = GetBand(bw, i);
-            double rxPowerPerBandW =
-                WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, filteredBand);
-            NS_LOG_DEBUG("Signal power received (watts) before antenna gain for "
-                         << bw << " MHz channel band " << +i << ": " << rxPowerPerBandW);
-            rxPowerPerBandW *= DbToRatio(GetRxGain());
-            rxPowerW.insert({filteredBand, rxPowerPerBandW});
-            NS_LOG_DEBUG("Signal power received after antenna gain for "
-                         << bw << " MHz channel band " << +i << ": " << rxPowerPerBandW << " W ("
-                         << WToDbm(rxPowerPerBandW) << " dBm)");
-        }
+        totalRxPowerW += rxPowerW.at(GetBand(channelWidth));
     }
-
     for (uint32_t i = 0; i < (channelWidth / 20); i++)
     {
-        WifiSpectrumBand filteredBand = GetBand(20, i);
-        double rxPowerPerBandW =
-            WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, filteredBand);
-        NS_LOG_DEBUG("Signal power received (watts) before antenna gain for 20 MHz channel band "
-                     << +i << ": " << rxPowerPerBandW);
-        rxPowerPerBandW *= DbToRatio(GetRxGain());
-        totalRxPowerW += rxPowerPerBandW;
-        rxPowerW.insert({filteredBand, rxPowerPerBandW});
-        NS_LOG_DEBUG("Signal power received after antenna gain for 20 MHz channel band "
-                     << +i << ": " << rxPowerPerBandW << " W (" << WToDbm(rxPowerPerBandW)
-                     << " dBm)");
-    }
-
-    if (GetStandard() >= WIFI_STANDARD_80211ax)
-    {
-        NS_ASSERT(!m_ruBands[channelWidth].empty());
-        for (const auto& bandRuPair : m_ruBands[channelWidth])
-        {
-            double rxPowerPerBandW =
-                WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, bandRuPair.first);
-            NS_LOG_DEBUG("Signal power received (watts) before antenna gain for RU with type "
-                         << bandRuPair.second.GetRuType() << " and index "
-                         << bandRuPair.second.GetIndex() << " -> (" << bandRuPair.first.first
-                         << "; " << bandRuPair.first.second << "): " << rxPowerPerBandW);
-            rxPowerPerBandW *= DbToRatio(GetRxGain());
-            NS_LOG_DEBUG("Signal power received after antenna gain for RU with type "
-                         << bandRuPair.second.GetRuType() << " and index "
-                         << bandRuPair.second.GetIndex() << " -> (" << bandRuPair.first.first
-                         << "; " << bandRuPair.first.second << "): " << rxPowerPerBandW << " W ("
-                         << WToDbm(rxPowerPerBandW) << " dBm)");
-            rxPowerW.insert({bandRuPair.first, rxPowerPerBandW});
-        }
+        totalRxPowerW += rxPowerW.at(GetBand(20, i));
     }
 
     NS_LOG_DEBUG("Total signal power received after antenna gain: "
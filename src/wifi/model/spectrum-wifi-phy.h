@@ -32,6 +32,7 @@
 #include "ns3/spectrum-model.h"
 
 #include <map>
+#include <vector>
 
 class SpectrumWifiPhyFilterTest;
 
@@ -232,6 +233,9 @@ class SpectrumWifiPhy : public WifiPhy
                                               //!< of the transmit spectrum mask
     double m_txMaskOuterBandMaximumRejection; //!< The maximum rejection (in dBr) for the outer band
                                               //!< of the transmit spectrum mask
+
+    std::vector<WifiSpectrumBand> m_bands; //!< the bands handled by the InterferenceHelper for
+                                           //!< the current channel, in increasing order
 };
 
 } // namespace ns3
@@ -937,19 +937,28 @@ StaWifiMac::ReceiveBeacon(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
     NS_ASSERT(hdr.IsBeacon());
 
     NS_LOG_DEBUG("Beacon received");
-    MgtBeaconHeader beacon;
-    mpdu->GetPacket()->PeekHeader(beacon);
-    const CapabilityInformation& capabilities = beacon.GetCapabilities();
-    NS_ASSERT(capabilities.IsEss());
-    bool goodBeacon;
-    if (IsWaitAssocResp() || IsAssociated())
+    bool goodBeacon = false;
+    const bool bssKnown = IsWaitAssocResp() || IsAssociated();
+    if (bssKnown)
     {
         // we have to process this Beacon only if sent by the AP we are associated
         // with or from which we are waiting an Association Response frame
         auto bssid = GetLink(linkId).bssid;
         goodBeacon = bssid.has_value() && (hdr.GetAddr3() == *bssid);
+        if (!goodBeacon && m_beaconInfo.IsEmpty())
+        {
+            // nobody is interested in the information carried by this Beacon,
+            // hence there is no need to deserialize it
+            NS_LOG_LOGIC("Beacon is not for us");
+            return;
+        }
     }
-    else
+
+    MgtBeaconHeader beacon;
+    mpdu->GetPacket()->PeekHeader(beacon);
+    const CapabilityInformation& capabilities = beacon.GetCapabilities();
+    NS_ASSERT(capabilities.IsEss());
+    if (!bssKnown)
     {
         // we retain this Beacon as candidate AP if the supported rates fit the
         // configured BSS membership selector
@@ -33,22 +33,31 @@ WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    m_expiryIndex.clear();
+    m_pendingQueues.clear();
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    QueueInfo& queueInfo = GetQueueInfo(queueId);
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == queueInfo.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
+    queueInfo.nBytes += item->GetSize();
 
-    return m_queues[queueId].emplace(pos, item);
+    // the expiry time of the inserted MPDU is set afterwards, hence check this container
+    // queue at the next extraction of all the MPDUs with expired lifetime
+    if (!queueInfo.pending)
+    {
+        queueInfo.pending = true;
+        m_pendingQueues.push_back(&queueInfo);
+    }
+
+    return queueInfo.queue.emplace(pos, item);
 }
 
 WifiMacQueueContainer::iterator
@@ -59,13 +68,12 @@ WifiMacQueueContainer::erase(const_iterator pos)
         return m_expiredQueue.erase(pos);
     }
 
-    WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
+    auto it = m_queues.find(GetQueueId(pos->mpdu));
+    NS_ASSERT(it != m_queues.end());
+    NS_ASSERT(it->second.nBytes >= pos->mpdu->GetSize());
+    it->second.nBytes -= pos->mpdu->GetSize();
 
-    return m_queues[queueId].erase(pos);
+    return it->second.queue.erase(pos);
 }
 
 Ptr<WifiMpdu>
@@ -98,35 +106,47 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
     return {WIFI_DATA_QUEUE, hdr.GetAddr1(), std::nullopt};
 }
 
+WifiMacQueueContainer::QueueInfo&
+WifiMacQueueContainer::GetQueueInfo(const WifiContainerQueueId& queueId) const
+{
+    return m_queues[queueId];
+}
+
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return GetQueueInfo(queueId).queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.queue.empty())
     {
         return 0;
     }
-    return m_nBytesPerQueue.at(queueId);
+    else
+    {
+        return it->second.nBytes;
+    }
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    return DoExtractExpiredMpdus(GetQueueInfo(queueId));
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(QueueInfo& queueInfo) const
 {
+    ContainerQueue& queue = queueInfo.queue;
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
     iterator firstExpiredIt = queue.begin();
     iterator lastExpiredIt = firstExpiredIt;
     Time now = Simulator::Now();
+    // time at which this container queue has to be checked again
+    Time nextCheck = Time::Max();
 
     do
     {
@@ -135,6 +155,7 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
              firstExpiredIt != queue.end() && !firstExpiredIt->inflights.empty();
              ++firstExpiredIt, ++lastExpiredIt)
         {
+            nextCheck = Min(nextCheck, firstExpiredIt->expiryTime);
         }
 
         if (!ret)
@@ -152,11 +173,8 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(queueInfo.nBytes >= lastExpiredIt->mpdu->GetSize());
+            queueInfo.nBytes -= lastExpiredIt->mpdu->GetSize();
 
             ++lastExpiredIt;
         }
@@ -170,6 +188,23 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
 
     } while (lastExpiredIt != firstExpiredIt);
 
+    // firstExpiredIt points to the first non-inflight MPDU whose lifetime has not expired
+    if (firstExpiredIt != queue.end())
+    {
+        nextCheck = Min(nextCheck, firstExpiredIt->expiryTime);
+    }
+
+    // update the position of this container queue in the expiry index
+    if (queueInfo.expiryIt && (*queueInfo.expiryIt)->first != nextCheck)
+    {
+        m_expiryIndex.erase(*queueInfo.expiryIt);
+        queueInfo.expiryIt.reset();
+    }
+    if (!queueInfo.expiryIt && nextCheck != Time::Max())
+    {
+        queueInfo.expiryIt = m_expiryIndex.emplace(nextCheck, &queueInfo);
+    }
+
     return *ret;
 }
 
@@ -177,10 +212,27 @@ std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
+    Time now = Simulator::Now();
+
+    // add the container queues that may hold MPDUs with expired lifetime to those
+    // in which an MPDU has been inserted since the last extraction
+    for (auto it = m_expiryIndex.begin(); it != m_expiryIndex.end() && it->first <= now; ++it)
+    {
+        if (!it->second->pending)
+        {
+            it->second->pending = true;
+            m_pendingQueues.push_back(it->second);
+        }
+    }
+
+    // the expiry index is modified while extracting MPDUs, hence work on a copy
+    auto pendingQueues = std::move(m_pendingQueues);
+    m_pendingQueues.clear();
 
-    for (auto& queue : m_queues)
+    for (auto queueInfo : pendingQueues)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        queueInfo->pending = false;
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(*queueInfo);
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
@@ -208,16 +260,16 @@ std::size_t
 std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queueId) const
 {
     auto [type, address, tid] = queueId;
-    const std::size_t size = tid.has_value() ? 8 : 7;
 
-    uint8_t buffer[size];
-    buffer[0] = type;
-    address.CopyTo(buffer + 1);
-    if (tid.has_value())
+    // the queue type, the address and the TID (if any) fit in 64 bits
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = type;
+    for (const auto byte : buffer)
     {
-        buffer[7] = *tid;
+        key = (key << 8) | byte;
     }
+    key = (key << 8) | (tid.has_value() ? *tid : 0xff);
 
-    std::string s(buffer, buffer + size);
-    return std::hash<std::string>{}(s);
+    return std::hash<uint64_t>{}(key * 0x9E3779B97F4A7C15ULL);
 }
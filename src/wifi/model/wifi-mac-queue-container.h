@@ -25,9 +25,11 @@
 #include "ns3/mac48-address.h"
 
 #include <list>
+#include <map>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -100,6 +102,14 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * In order to extract the MPDUs with expired lifetime from all the container queues
+ * without walking through all of them, the container keeps an index of the container
+ * queues sorted by the time at which they may next hold a non-inflight MPDU with
+ * expired lifetime, i.e., the expiry time of the first non-inflight MPDU found the
+ * last time the container queue was checked (or the expiry time of a skipped inflight
+ * MPDU, if earlier). A container queue in which an MPDU is inserted is checked again
+ * at the next extraction, because the expiry time of the inserted MPDU is not known yet.
  */
 class WifiMacQueueContainer
 {
@@ -196,21 +206,46 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    struct QueueInfo;
+
+    /// Container queues sorted by the time at which they have to be checked for expired MPDUs
+    using ExpiryIndex = std::multimap<Time, QueueInfo*>;
+
+    /// Information associated with a container queue
+    struct QueueInfo
+    {
+        ContainerQueue queue;                          //!< the container queue
+        uint32_t nBytes{0};                            //!< size in bytes of the container queue
+        std::optional<ExpiryIndex::iterator> expiryIt; //!< position in the expiry index, if any
+        bool pending{false}; //!< whether the queue must be checked at the next extraction
+    };
+
+    /**
+     * Get the information associated with the container queue identified by the given
+     * QueueId. The container queue is created if it does not exist.
+     *
+     * \param queueId the given QueueId
+     * \return the information associated with the container queue
+     */
+    QueueInfo& GetQueueInfo(const WifiContainerQueueId& queueId) const;
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
-     * container queue storing MPDUs with expired lifetime.
+     * container queue storing MPDUs with expired lifetime and update the position of the
+     * given container queue in the expiry index.
      *
-     * \param queue the given container queue
+     * \param queueInfo the information associated with the given container queue
      * \return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(QueueInfo& queueInfo) const;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable ExpiryIndex m_expiryIndex;     //!< the expiry index
+    mutable std::vector<QueueInfo*>
+        m_pendingQueues; //!< container queues to check at the next extraction
 };
 
 } // namespace ns3
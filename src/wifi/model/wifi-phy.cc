@@ -46,12 +46,81 @@
 #include "ns3/vht-configuration.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("WifiPhy");
 
+namespace
+{
+
+/// The parameters determining the TX duration of a SU PPDU
+struct TxDurationKey
+{
+    uint32_t size;          ///< the PSDU size
+    uint32_t modeUid;       ///< the UID of the mode
+    uint16_t channelWidth;  ///< the channel width
+    uint16_t guardInterval; ///< the guard interval
+    uint16_t staId;         ///< the STA-ID
+    uint8_t preamble;       ///< the preamble type
+    uint8_t band;           ///< the frequency band
+    uint8_t nss;            ///< the number of spatial streams
+    uint8_t ness;           ///< the number of extension spatial streams
+    bool stbc;              ///< whether STBC is used
+    bool nonHtDuplicate;    ///< whether the PPDU is a non-HT duplicate
+
+    /**
+     * \param other the other key
+     * \return whether the two keys are equal
+     */
+    bool operator==(const TxDurationKey& other) const
+    {
+        return size == other.size && modeUid == other.modeUid &&
+               channelWidth == other.channelWidth && guardInterval == other.guardInterval &&
+               staId == other.staId && preamble == other.preamble && band == other.band &&
+               nss == other.nss && ness == other.ness && stbc == other.stbc &&
+               nonHtDuplicate == other.nonHtDuplicate;
+    }
+};
+
+/// Hash function of a TxDurationKey
+struct TxDurationKeyHash
+{
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    std::size_t operator()(const TxDurationKey& key) const
+    {
+        uint64_t first = (static_cast<uint64_t>(key.size) << 32) | key.modeUid;
+        uint64_t second = (static_cast<uint64_t>(key.channelWidth) << 48) |
+                          (static_cast<uint64_t>(key.guardInterval) << 32) |
+                          (static_cast<uint64_t>(key.staId) << 16) |
+                          (static_cast<uint64_t>(key.preamble) << 8) | key.band;
+        uint64_t third = (static_cast<uint64_t>(key.nss) << 8) | (key.ness << 2) |
+                         (key.stbc << 1) | key.nonHtDuplicate;
+        return std::hash<uint64_t>()((first * 0x9E3779B97F4A7C15ULL) ^
+                                     (second * 0xC2B2AE3D27D4EB4FULL) ^ third);
+    }
+};
+
+/// Maximum number of TX durations cached
+std::size_t g_txDurationCacheSize = 4096;
+
+/**
+ * \return the TX durations of the SU PPDUs already computed
+ */
+std::unordered_map<TxDurationKey, Time, TxDurationKeyHash>&
+GetTxDurationCache()
+{
+    static std::unordered_map<TxDurationKey, Time, TxDurationKeyHash> cache;
+    return cache;
+}
+
+} // namespace
+
 /****************************************************************
  *       The actual WifiPhy class
  ****************************************************************/
@@ -247,6 +316,15 @@ WifiPhy::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&WifiPhy::m_postReceptionErrorModel),
                           MakePointerChecker<ErrorModel>())
+            .AddAttribute("AbstractedReception",
+                          "If true, the PHY headers of the received SU PPDUs are not processed "
+                          "field by field and the success of each MPDU is only determined at "
+                          "the end of the PPDU, based on the effective SINR over the payload "
+                          "and on the error rate model. MU PPDUs are always received using the "
+                          "detailed model.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&WifiPhy::m_abstractedReception),
+                          MakeBooleanChecker())
             .AddAttribute("Sifs",
                           "The duration of the Short Interframe Space. "
                           "NOTE that the default value is overwritten by the value defined "
@@ -351,6 +429,7 @@ WifiPhy::WifiPhy()
       m_txSpatialStreams(1),
       m_rxSpatialStreams(1),
       m_wifiRadioEnergyModel(nullptr),
+      m_abstractedReception(false),
       m_timeLastPreambleDetected(Seconds(0))
 {
     NS_LOG_FUNCTION(this);
@@ -1476,15 +1555,57 @@ WifiPhy::CalculatePhyPreambleAndHeaderDuration(const WifiTxVector& txVector)
         ->CalculatePhyPreambleAndHeaderDuration(txVector);
 }
 
+void
+WifiPhy::SetTxDurationCacheSize(std::size_t size)
+{
+    g_txDurationCacheSize = size;
+    GetTxDurationCache().clear();
+}
+
 Time
 WifiPhy::CalculateTxDuration(uint32_t size,
                              const WifiTxVector& txVector,
                              WifiPhyBand band,
                              uint16_t staId)
 {
+    // the duration of MU PPDUs depends on the allocation of all the users, and EHT
+    // PPDUs are MU PPDUs even with a single user, hence only SU PPDUs are cached
+    bool cacheable = (g_txDurationCacheSize > 0) && !txVector.IsMu() &&
+                     (txVector.GetModulationClass() < WIFI_MOD_CLASS_EHT);
+    TxDurationKey key;
+    if (cacheable)
+    {
+        key = {size,
+               txVector.GetMode().GetUid(),
+               txVector.GetChannelWidth(),
+               txVector.GetGuardInterval(),
+               staId,
+               static_cast<uint8_t>(txVector.GetPreambleType()),
+               static_cast<uint8_t>(band),
+               txVector.GetNss(),
+               txVector.GetNess(),
+               txVector.IsStbc(),
+               txVector.IsNonHtDuplicate()};
+        auto it = GetTxDurationCache().find(key);
+        if (it != GetTxDurationCache().end())
+        {
+            return it->second;
+        }
+    }
+
     Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
                     GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
     NS_ASSERT(duration.IsStrictlyPositive());
+
+    if (cacheable)
+    {
+        auto& cache = GetTxDurationCache();
+        if (cache.size() >= g_txDurationCacheSize)
+        {
+            cache.clear();
+        }
+        cache.emplace(key, duration);
+    }
     return duration;
 }
 
@@ -263,6 +263,15 @@ class WifiPhy : public Object
                                     const WifiTxVector& txVector,
                                     WifiPhyBand band);
 
+    /**
+     * Set the maximum number of TX durations of SU PPDUs kept in the cache shared by all
+     * the PHYs, so that the TX duration of a PPDU of a given size and TXVECTOR is only
+     * computed once. The cache is emptied when it is full.
+     *
+     * \param size the maximum number of TX durations cached (0 to disable the cache)
+     */
+    static void SetTxDurationCacheSize(std::size_t size);
+
     /**
      * \param txVector the transmission parameters used for this packet
      *
@@ -1482,6 +1491,7 @@ class WifiPhy : public Object
     Ptr<PreambleDetectionModel> m_preambleDetectionModel; //!< Preamble detection model
     Ptr<WifiRadioEnergyModel> m_wifiRadioEnergyModel;     //!< Wifi radio energy model
     Ptr<ErrorModel> m_postReceptionErrorModel;            //!< Error model for receive packet events
+    bool m_abstractedReception; //!< Flag whether the reception of SU PPDUs is abstracted
     Time m_timeLastPreambleDetected; //!< Record the time the last preamble was detected
 
     Callback<void> m_capabilitiesChangedCallback; //!< Callback when PHY capabilities changed
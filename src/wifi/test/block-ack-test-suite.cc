@@ -18,6 +18,7 @@
  */
 
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/block-ack-window.h"
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/ctrl-headers.h"
@@ -666,6 +667,91 @@ OriginatorBlockAckWindowTest::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test for the search of the elements of a large block ack window
+ *
+ * A window whose size is not a multiple of the size of the words of the bitmap
+ * is moved forward by various numbers of positions, so that its head is located
+ * anywhere in the bitmap. After each movement, some elements are set and the
+ * result of the search for the elements that are set (or not set) is compared
+ * with the result of a linear search.
+ */
+class BlockAckWindowSearchTest : public TestCase
+{
+  public:
+    BlockAckWindowSearchTest();
+
+  private:
+    void DoRun() override;
+};
+
+BlockAckWindowSearchTest::BlockAckWindowSearchTest()
+    : TestCase("Check the search of the elements of a large block ack window")
+{
+}
+
+void
+BlockAckWindowSearchTest::DoRun()
+{
+    const uint16_t winSize = 1000;
+    uint16_t winStart = 4000;
+
+    BlockAckWindow window;
+    window.Init(winStart, winSize);
+
+    NS_TEST_EXPECT_MSG_EQ(window.GetNextSet(0), winSize, "No element should be set");
+    NS_TEST_EXPECT_MSG_EQ(window.GetNextUnset(0), 0, "No element should be set");
+
+    for (std::size_t count : {1, 63, 64, 65, 127, 300, 999, 7, 500})
+    {
+        window.Advance(count);
+        winStart = (winStart + count) % SEQNO_SPACE_SIZE;
+        NS_TEST_EXPECT_MSG_EQ(window.GetWinStart(), winStart, "Incorrect winStart");
+
+        // set the elements whose distance is a multiple of count, except the first one
+        for (std::size_t distance = count; distance < winSize; distance += count)
+        {
+            window.Set(distance);
+        }
+        // also set a run of elements crossing a word boundary
+        for (std::size_t distance = 120; distance < 200; distance++)
+        {
+            window.Set(distance);
+        }
+
+        for (std::size_t distance = 0; distance <= winSize; distance++)
+        {
+            std::size_t nextSet = distance;
+            while (nextSet < winSize && !window.At(nextSet))
+            {
+                nextSet++;
+            }
+            std::size_t nextUnset = distance;
+            while (nextUnset < winSize && window.At(nextUnset))
+            {
+                nextUnset++;
+            }
+            NS_TEST_EXPECT_MSG_EQ(window.GetNextSet(distance),
+                                  nextSet,
+                                  "Incorrect next set element after " << distance
+                                                                      << " (advance=" << count
+                                                                      << ")");
+            NS_TEST_EXPECT_MSG_EQ(window.GetNextUnset(distance),
+                                  nextUnset,
+                                  "Incorrect next unset element after " << distance
+                                                                        << " (advance=" << count
+                                                                        << ")");
+        }
+    }
+
+    // moving the window forward clears the elements that become part of its tail
+    window.Advance(winSize - 1);
+    NS_TEST_EXPECT_MSG_EQ(window.GetNextSet(1), winSize, "Only the first element may be set");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2023,6 +2109,7 @@ BlockAckTestSuite::BlockAckTestSuite()
     AddTestCase(new PacketBufferingCaseA, TestCase::QUICK);
     AddTestCase(new PacketBufferingCaseB, TestCase::QUICK);
     AddTestCase(new OriginatorBlockAckWindowTest, TestCase::QUICK);
+    AddTestCase(new BlockAckWindowSearchTest, TestCase::QUICK);
     AddTestCase(new CtrlBAckResponseHeaderTest, TestCase::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(0), TestCase::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(4090), TestCase::QUICK);
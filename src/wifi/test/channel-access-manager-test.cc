@@ -1185,6 +1185,55 @@ ChannelAccessManagerTest<Txop>::DoRun()
     AddSwitchingEvt(80, 20);
     AddAccessRequest(101, 2, 111, 0);
     EndTest();
+
+    // Check that the grant time is not changed when the medium becomes busy (NAV, CCA
+    // busy, transmission or reception) while the access timeout is pending, in which
+    // case the access timeout is moved to the end of the backoff.
+    //
+    //  20          60     66      70       74     94     100     104      108      112  116
+    //   |    rx     | sifs | aifsn | bslot0 | busy | sifs | aifsn | bslot1 | bslot2 | bslot3 |
+    //        |
+    //       30 request access. backoff slots: 4
+    //
+    StartTest(4, 6, 10);
+    AddTxop(1);
+    AddRxOkEvt(20, 40);
+    AddAccessRequest(30, 2, 116, 0);
+    ExpectBackoff(30, 4, 0); // backoff: 4 slots
+    AddNavStart(74, 20);
+    EndTest();
+
+    StartTest(4, 6, 10);
+    AddTxop(1);
+    AddRxOkEvt(20, 40);
+    AddAccessRequest(30, 2, 116, 0);
+    ExpectBackoff(30, 4, 0); // backoff: 4 slots
+    AddCcaBusyEvt(74, 20);
+    EndTest();
+
+    StartTest(4, 6, 10);
+    AddTxop(1);
+    AddRxOkEvt(20, 40);
+    AddAccessRequest(30, 2, 116, 0);
+    ExpectBackoff(30, 4, 0); // backoff: 4 slots
+    AddTxEvt(74, 20);
+    EndTest();
+
+    // The access timeout is moved again by a reception starting after the NAV
+    //
+    //  20     60     66      70       74    94   100  110    116     120      124      128      132
+    //   |  rx  | sifs | aifsn | bslot0 | nav |    | rx | sifs | aifsn | bslot1 | bslot2 | bslot3 |
+    //        |
+    //       30 request access. backoff slots: 4
+    //
+    StartTest(4, 6, 10);
+    AddTxop(1);
+    AddRxOkEvt(20, 40);
+    AddAccessRequest(30, 2, 132, 0);
+    ExpectBackoff(30, 4, 0); // backoff: 4 slots
+    AddNavStart(74, 20);
+    AddRxOkEvt(100, 10);
+    EndTest();
 }
 
 /*
@@ -234,15 +234,19 @@ TxDurationTest::CheckTxDuration(uint32_t size,
                                          std::list<uint16_t>{SU_STA_ID},
                                          txVector,
                                          testedBand);
+        // the TX duration is now returned by the cache
+        Time cachedDuration = phy->CalculateTxDuration(size, txVector, testedBand);
         if (calculatedDuration != knownDuration ||
-            calculatedDuration != calculatedDurationUsingList)
+            calculatedDuration != calculatedDurationUsingList ||
+            calculatedDuration != cachedDuration)
         {
             std::cerr << "size=" << size << " band=" << testedBand << " mode=" << payloadMode
                       << " channelWidth=" << +channelWidth << " guardInterval=" << guardInterval
                       << " datarate=" << payloadMode.GetDataRate(channelWidth, guardInterval, 1)
                       << " preamble=" << preamble << " known=" << knownDuration
                       << " calculated=" << calculatedDuration
-                      << " calculatedUsingList=" << calculatedDurationUsingList << std::endl;
+                      << " calculatedUsingList=" << calculatedDurationUsingList
+                      << " cached=" << cachedDuration << std::endl;
             return false;
         }
     }
@@ -30,6 +30,7 @@
 #include "ns3/packet.h"
 #include "ns3/qos-utils.h"
 #include "ns3/rng-seed-manager.h"
+#include "ns3/rr-multi-user-scheduler.h"
 #include "ns3/spectrum-wifi-helper.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
@@ -41,6 +42,7 @@
 #include "ns3/wifi-psdu.h"
 
 #include <iomanip>
+#include <sstream>
 
 using namespace ns3;
 
@@ -2195,6 +2197,104 @@ OfdmaAckSequenceTest::DoRun()
     Config::SetGlobal("RngRun", UintegerValue(previousRun));
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the allocation of equal-sized RUs by the Round Robin MU scheduler
+ *
+ * The RU allocations returned by the RR MU scheduler for each channel width and
+ * for numbers of stations up to beyond the number of 26-tone RUs are compared
+ * with the ones computed by HeRu::GetEqualSizedRusForStations, both when the
+ * allocations for the channel width are computed by the request (cold cache)
+ * and when they have been computed by previous requests (warm cache).
+ */
+class RrMultiUserSchedulerRuAllocationTest : public TestCase
+{
+  public:
+    RrMultiUserSchedulerRuAllocationTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the RU allocation returned by the given scheduler
+     *
+     * \param scheduler the RR MU scheduler
+     * \param channelWidth the channel width in MHz
+     * \param nStations the number of stations
+     * \param cache a string identifying the state of the cache of the scheduler
+     */
+    void CheckRuAllocation(Ptr<RrMultiUserScheduler> scheduler,
+                           uint16_t channelWidth,
+                           std::size_t nStations,
+                           const std::string& cache);
+};
+
+RrMultiUserSchedulerRuAllocationTest::RrMultiUserSchedulerRuAllocationTest()
+    : TestCase("Check the RU allocations of the RR MU scheduler")
+{
+}
+
+void
+RrMultiUserSchedulerRuAllocationTest::CheckRuAllocation(Ptr<RrMultiUserScheduler> scheduler,
+                                                        uint16_t channelWidth,
+                                                        std::size_t nStations,
+                                                        const std::string& cache)
+{
+    std::size_t nRus = nStations;
+    std::size_t nCentral26TonesRus;
+    HeRu::RuType ruType = HeRu::GetEqualSizedRusForStations(channelWidth, nRus, nCentral26TonesRus);
+
+    const auto& allocation = scheduler->GetRuAllocation(channelWidth, nStations);
+    std::ostringstream msg;
+    msg << channelWidth << " MHz, " << nStations << " stations, " << cache << " cache";
+    NS_TEST_EXPECT_MSG_EQ(allocation.nRus, nRus, "Unexpected number of RUs: " << msg.str());
+    NS_TEST_EXPECT_MSG_EQ(allocation.ruType, ruType, "Unexpected RU type: " << msg.str());
+    NS_TEST_EXPECT_MSG_EQ(allocation.nCentral26TonesRus,
+                          nCentral26TonesRus,
+                          "Unexpected number of central 26-tone RUs: " << msg.str());
+    NS_TEST_EXPECT_MSG_EQ((allocation.rus == HeRu::GetRusOfType(channelWidth, ruType)),
+                          true,
+                          "Unexpected RUs: " << msg.str());
+    NS_TEST_EXPECT_MSG_EQ(
+        (allocation.central26TonesRus == HeRu::GetCentral26TonesRus(channelWidth, ruType)),
+        true,
+        "Unexpected central 26-tone RUs: " << msg.str());
+}
+
+void
+RrMultiUserSchedulerRuAllocationTest::DoRun()
+{
+    Ptr<RrMultiUserScheduler> warmScheduler = CreateObject<RrMultiUserScheduler>();
+
+    for (uint16_t channelWidth : {20, 40, 80, 160})
+    {
+        std::size_t maxStations = HeRu::GetNRus(channelWidth, HeRu::RU_26_TONE) + 3;
+        for (std::size_t nStations = 1; nStations <= maxStations; nStations++)
+        {
+            // a new scheduler computes the allocations for the channel width
+            // when requested the allocation for the given number of stations
+            CheckRuAllocation(CreateObject<RrMultiUserScheduler>(),
+                              channelWidth,
+                              nStations,
+                              "cold");
+            CheckRuAllocation(warmScheduler, channelWidth, nStations, "warm");
+        }
+    }
+
+    // the allocations for all the channel widths are now cached; request them
+    // again, in a different order
+    for (uint16_t channelWidth : {160, 80, 40, 20})
+    {
+        std::size_t maxStations = HeRu::GetNRus(channelWidth, HeRu::RU_26_TONE) + 3;
+        for (std::size_t nStations = maxStations; nStations >= 1; nStations--)
+        {
+            CheckRuAllocation(warmScheduler, channelWidth, nStations, "warm");
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2269,6 +2369,7 @@ WifiMacOfdmaTestSuite::WifiMacOfdmaTestSuite()
                         TestCase::QUICK);
         }
     }
+    AddTestCase(new RrMultiUserSchedulerRuAllocationTest, TestCase::QUICK);
 }
 
 static WifiMacOfdmaTestSuite g_wifiMacOfdmaTestSuite; ///< the test suite
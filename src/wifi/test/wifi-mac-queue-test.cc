@@ -146,8 +146,9 @@ class WifiExtractExpiredMpdusTest : public TestCase
      * \param rxAddr Receiver Address of the MPDU
      * \param inflight whether the MPDU is inflight
      * \param expiryTime the expity time for the MPDU
+     * \return an iterator pointing to the enqueued MPDU
      */
-    void Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime);
+    WifiMacQueueContainer::iterator Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime);
 
     WifiMacQueueContainer m_container; //!< MAC queue container
     uint16_t m_currentSeqNo{0};        //!< sequence number of current MPDU
@@ -159,7 +160,7 @@ WifiExtractExpiredMpdusTest::WifiExtractExpiredMpdusTest()
 {
 }
 
-void
+WifiMacQueueContainer::iterator
 WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime)
 {
     WifiMacHeader header(WIFI_MAC_QOSDATA);
@@ -177,6 +178,7 @@ WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time ex
         elemIt->inflights.emplace(0, mpdu);
     }
     elemIt->deleter = [](auto mpdu) {};
+    return elemIt;
 }
 
 void
@@ -203,7 +205,7 @@ WifiExtractExpiredMpdusTest::DoRun()
      * │11 │12 │13 │14 │15 │16 │17 │18 │19 │
      * └───┴───┴───┴───┴───┴───┴───┴───┴───┘
      */
-    Enqueue(rxAddr1, true, MilliSeconds(10));
+    auto firstIt = Enqueue(rxAddr1, true, MilliSeconds(10));
     Enqueue(rxAddr1, false, MilliSeconds(10));
     Enqueue(rxAddr1, true, MilliSeconds(12));
     Enqueue(rxAddr1, false, MilliSeconds(15));
@@ -424,6 +426,28 @@ WifiExtractExpiredMpdusTest::DoRun()
                               "There should be no other MPDU in container queue 2");
     });
 
+    /**
+     * At simulation time 60ms, MPDU 0 is no longer inflight and is extracted along
+     * with all the MPDUs following it whose lifetime has expired.
+     */
+    Simulator::Schedule(MilliSeconds(60), [&]() {
+        firstIt->inflights.clear();
+        auto [first, last] = m_container.ExtractAllExpiredMpdus();
+
+        std::set<uint16_t> expectedSeqNo{0};
+        std::set<uint16_t> actualSeqNo;
+
+        std::transform(first, last, std::inserter(actualSeqNo, actualSeqNo.end()), [](auto& elem) {
+            return elem.mpdu->GetHeader().GetSequenceNumber();
+        });
+
+        NS_TEST_EXPECT_MSG_EQ((expectedSeqNo == actualSeqNo), true, "Expected MPDU 0 extracted");
+        auto elemIt = m_container.GetQueue(queueId1).begin();
+        NS_TEST_EXPECT_MSG_EQ(elemIt->mpdu->GetHeader().GetSequenceNumber(),
+                              2,
+                              "Unexpected MPDU at the head of container queue 1");
+    });
+
     Simulator::Run();
     Simulator::Destroy();
 }
@@ -4745,6 +4745,301 @@ TestPrimary20CoveredByPpdu::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Abstracted reception test
+ *
+ * This test checks the reception of A-MPDUs by a PHY whose AbstractedReception
+ * attribute is set: the PHY stays in CCA_BUSY until the start of the payload,
+ * the MPDUs are only evaluated at the end of the PPDU and the interference
+ * affects all the MPDUs through the effective SINR over the payload.
+ */
+class TestAbstractedReception : public TestCase
+{
+  public:
+    TestAbstractedReception();
+
+  protected:
+    void DoSetup() override;
+    void DoTeardown() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * RX success function
+     * \param psdu the PSDU
+     * \param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+     * \param txVector the transmit vector
+     * \param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   WifiTxVector txVector,
+                   std::vector<bool> statusPerMpdu);
+    /**
+     * RX failure function
+     * \param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+
+    /**
+     * Create an A-MPDU with 3 MPDUs
+     * \return the A-MPDU
+     */
+    Ptr<WifiPsdu> CreateAmpdu() const;
+
+    /**
+     * Send an A-MPDU with 3 MPDUs
+     * \param rxPowerDbm the received power in dBm
+     */
+    void SendAmpdu(double rxPowerDbm);
+
+    /**
+     * Reset the counters
+     */
+    void Reset();
+
+    /**
+     * Check the counters
+     * \param expectedNotified the expected number of MPDUs notified before the end of the A-MPDU
+     * \param expectedSuccess the expected number of MPDUs successfully received
+     * \param expectedFailure the expected number of MPDUs unsuccessfully received
+     */
+    void CheckRxCounts(uint32_t expectedNotified,
+                       uint32_t expectedSuccess,
+                       uint32_t expectedFailure);
+
+    /**
+     * Check the PHY state
+     * \param expectedState the expected PHY state
+     */
+    void CheckPhyState(WifiPhyState expectedState);
+
+    /// \return the TXVECTOR used to transmit the A-MPDUs
+    static WifiTxVector GetTxVector();
+
+    Ptr<SpectrumWifiPhy> m_phy;  ///< Phy
+    uint32_t m_countRxNotified; ///< number of MPDUs notified before the end of the A-MPDU
+    uint32_t m_countRxSuccess;  ///< number of MPDUs successfully received
+    uint32_t m_countRxFailure;  ///< number of MPDUs unsuccessfully received
+    uint64_t m_uid;             ///< UID
+};
+
+TestAbstractedReception::TestAbstractedReception()
+    : TestCase("Abstracted reception test"),
+      m_countRxNotified(0),
+      m_countRxSuccess(0),
+      m_countRxFailure(0),
+      m_uid(0)
+{
+}
+
+WifiTxVector
+TestAbstractedReception::GetTxVector()
+{
+    return WifiTxVector(HePhy::GetHeMcs0(), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, true);
+}
+
+void
+TestAbstractedReception::RxSuccess(Ptr<const WifiPsdu> psdu,
+                                   RxSignalInfo rxSignalInfo,
+                                   WifiTxVector txVector,
+                                   std::vector<bool> statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    if (statusPerMpdu.empty()) // MPDU notified before the end of the A-MPDU
+    {
+        m_countRxNotified++;
+        return;
+    }
+    m_countRxSuccess += std::count(statusPerMpdu.begin(), statusPerMpdu.end(), true);
+    m_countRxFailure += std::count(statusPerMpdu.begin(), statusPerMpdu.end(), false);
+}
+
+void
+TestAbstractedReception::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_countRxFailure += psdu->GetNMpdus();
+}
+
+Ptr<WifiPsdu>
+TestAbstractedReception::CreateAmpdu() const
+{
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        mpduList.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+    }
+    return Create<WifiPsdu>(mpduList);
+}
+
+void
+TestAbstractedReception::SendAmpdu(double rxPowerDbm)
+{
+    WifiTxVector txVector = GetTxVector();
+    Ptr<WifiPsdu> psdu = CreateAmpdu();
+
+    Time txDuration = m_phy->CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+
+    Ptr<WifiPpdu> ppdu =
+        Create<HePpdu>(psdu, txVector, FREQUENCY, txDuration, WIFI_PHY_BAND_5GHZ, m_uid++);
+
+    Ptr<SpectrumValue> txPowerSpectrum =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(FREQUENCY,
+                                                                    CHANNEL_WIDTH,
+                                                                    DbmToW(rxPowerDbm),
+                                                                    GUARD_WIDTH);
+
+    Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters>();
+    txParams->psd = txPowerSpectrum;
+    txParams->txPhy = nullptr;
+    txParams->duration = txDuration;
+    txParams->ppdu = ppdu;
+    txParams->txWidth = CHANNEL_WIDTH;
+
+    m_phy->StartRx(txParams);
+}
+
+void
+TestAbstractedReception::Reset()
+{
+    m_countRxNotified = 0;
+    m_countRxSuccess = 0;
+    m_countRxFailure = 0;
+}
+
+void
+TestAbstractedReception::CheckRxCounts(uint32_t expectedNotified,
+                                       uint32_t expectedSuccess,
+                                       uint32_t expectedFailure)
+{
+    NS_TEST_ASSERT_MSG_EQ(m_countRxNotified,
+                          expectedNotified,
+                          "Unexpected number of MPDUs notified at " << Simulator::Now());
+    NS_TEST_ASSERT_MSG_EQ(m_countRxSuccess,
+                          expectedSuccess,
+                          "Unexpected number of successfully received MPDUs at "
+                              << Simulator::Now());
+    NS_TEST_ASSERT_MSG_EQ(m_countRxFailure,
+                          expectedFailure,
+                          "Unexpected number of unsuccessfully received MPDUs at "
+                              << Simulator::Now());
+}
+
+void
+TestAbstractedReception::CheckPhyState(WifiPhyState expectedState)
+{
+    WifiPhyState currentState;
+    PointerValue ptr;
+    m_phy->GetAttribute("State", ptr);
+    Ptr<WifiPhyStateHelper> state = DynamicCast<WifiPhyStateHelper>(ptr.Get<WifiPhyStateHelper>());
+    currentState = state->GetState();
+    NS_TEST_ASSERT_MSG_EQ(currentState,
+                          expectedState,
+                          "PHY State " << currentState << " does not match expected state "
+                                       << expectedState << " at " << Simulator::Now());
+}
+
+void
+TestAbstractedReception::DoSetup()
+{
+    m_phy = CreateObject<SpectrumWifiPhy>();
+    m_phy->SetAttribute("AbstractedReception", BooleanValue(true));
+    m_phy->ConfigureStandard(WIFI_STANDARD_80211ax);
+    Ptr<InterferenceHelper> interferenceHelper = CreateObject<InterferenceHelper>();
+    m_phy->SetInterferenceHelper(interferenceHelper);
+    Ptr<ErrorRateModel> error = CreateObject<NistErrorRateModel>();
+    m_phy->SetErrorRateModel(error);
+    m_phy->SetOperatingChannel(WifiPhy::ChannelTuple{CHANNEL_NUMBER, 0, WIFI_PHY_BAND_5GHZ, 0});
+
+    m_phy->SetReceiveOkCallback(MakeCallback(&TestAbstractedReception::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&TestAbstractedReception::RxFailure, this));
+
+    Ptr<ThresholdPreambleDetectionModel> preambleDetectionModel =
+        CreateObject<ThresholdPreambleDetectionModel>();
+    m_phy->SetPreambleDetectionModel(preambleDetectionModel);
+}
+
+void
+TestAbstractedReception::DoTeardown()
+{
+    m_phy->Dispose();
+    m_phy = nullptr;
+}
+
+void
+TestAbstractedReception::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 0;
+    m_phy->AssignStreams(streamNumber);
+    double rxPowerDbm = -50;
+
+    Time headerDuration = WifiPhy::CalculatePhyPreambleAndHeaderDuration(GetTxVector());
+    Time ppduDuration =
+        m_phy->CalculateTxDuration(CreateAmpdu()->GetSize(), GetTxVector(), WIFI_PHY_BAND_5GHZ);
+
+    // CASE 1: an A-MPDU received without interference. The PHY stays in CCA_BUSY until the
+    // start of the payload and all MPDUs are successfully received at the end of the A-MPDU.
+    Simulator::Schedule(Seconds(1.0), &TestAbstractedReception::SendAmpdu, this, rxPowerDbm);
+    Simulator::Schedule(Seconds(1.0) + MicroSeconds(5),
+                        &TestAbstractedReception::CheckPhyState,
+                        this,
+                        WifiPhyState::CCA_BUSY);
+    Simulator::Schedule(Seconds(1.0) + headerDuration - NanoSeconds(1),
+                        &TestAbstractedReception::CheckPhyState,
+                        this,
+                        WifiPhyState::CCA_BUSY);
+    Simulator::Schedule(Seconds(1.0) + headerDuration + NanoSeconds(1),
+                        &TestAbstractedReception::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(Seconds(1.0) + ppduDuration - NanoSeconds(1),
+                        &TestAbstractedReception::CheckRxCounts,
+                        this,
+                        0,
+                        0,
+                        0);
+    Simulator::Schedule(Seconds(1.0) + ppduDuration + NanoSeconds(1),
+                        &TestAbstractedReception::CheckRxCounts,
+                        this,
+                        3,
+                        3,
+                        0);
+    Simulator::Schedule(Seconds(1.0) + ppduDuration + NanoSeconds(1),
+                        &TestAbstractedReception::CheckPhyState,
+                        this,
+                        WifiPhyState::IDLE);
+    Simulator::Schedule(Seconds(1.5), &TestAbstractedReception::Reset, this);
+
+    // CASE 2: an A-MPDU is received and a stronger A-MPDU arrives shortly after the start of its
+    // payload. The interference covers most of the payload, hence the effective SINR is too low
+    // to successfully receive any of the MPDUs.
+    Simulator::Schedule(Seconds(2.0), &TestAbstractedReception::SendAmpdu, this, rxPowerDbm);
+    Simulator::Schedule(Seconds(2.0) + headerDuration + MicroSeconds(100),
+                        &TestAbstractedReception::SendAmpdu,
+                        this,
+                        rxPowerDbm + 3);
+    Simulator::Schedule(Seconds(2.0) + ppduDuration + NanoSeconds(1),
+                        &TestAbstractedReception::CheckRxCounts,
+                        this,
+                        0,
+                        0,
+                        3);
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -4768,6 +5063,7 @@ WifiPhyReceptionTestSuite::WifiPhyReceptionTestSuite()
     AddTestCase(new TestUnsupportedModulationReception(), TestCase::QUICK);
     AddTestCase(new TestUnsupportedBandwidthReception(), TestCase::QUICK);
     AddTestCase(new TestPrimary20CoveredByPpdu(), TestCase::QUICK);
+    AddTestCase(new TestAbstractedReception, TestCase::QUICK);
 }
 
 static WifiPhyReceptionTestSuite wifiPhyReceptionTestSuite; ///< the test suite
@@ -40,6 +40,7 @@
 #include "ns3/rng-seed-manager.h"
 #include "ns3/socket.h"
 #include "ns3/spectrum-wifi-helper.h"
+#include "ns3/sta-wifi-mac.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/vht-phy.h"
@@ -55,6 +56,8 @@
 #include "ns3/yans-wifi-helper.h"
 #include "ns3/yans-wifi-phy.h"
 
+#include <set>
+
 using namespace ns3;
 
 // Helper function to assign streams to random variables, to control
@@ -2116,6 +2119,222 @@ StaWifiMacScanningTestCase::DoRun()
     }
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * Make sure that an associated STA only handles the Beacon frames of its own
+ * AP. We consider 2 APs with different SSIDs on the same channel and 1 STA
+ * associating with the first AP. The Beacon frames of the first AP restart
+ * the beacon watchdog of the STA, hence the STA stays associated as long as
+ * the first AP sends Beacon frames. The first AP then stops sending Beacon
+ * frames: those of the second AP are ignored, hence the STA disassociates
+ * once MaxMissedBeacons Beacon frames have been missed. The test is run with
+ * and without a callback connected to the ReceivedBeaconInfo trace source,
+ * which requires the STA to deserialize the Beacon frames of the other BSSs.
+ */
+class StaWifiMacBeaconTestCase : public TestCase
+{
+  public:
+    StaWifiMacBeaconTestCase();
+    void DoRun() override;
+
+  private:
+    /**
+     * Run the test
+     * \param traceBeaconInfo whether to connect a callback to ReceivedBeaconInfo
+     */
+    void RunOne(bool traceBeaconInfo);
+    /**
+     * Callback function on STA assoc event
+     * \param bssid the associated AP's bssid
+     */
+    void AssocCallback(Mac48Address bssid);
+    /**
+     * Callback function on STA deassoc event
+     * \param bssid the AP's bssid
+     */
+    void DeAssocCallback(Mac48Address bssid);
+    /**
+     * Callback function on the arrival of a Beacon frame from the associated AP
+     * \param time the arrival time
+     */
+    void BeaconArrivalCallback(Time time);
+    /**
+     * Callback function on the reception of a Beacon frame
+     * \param apInfo the information about the Beacon frame
+     */
+    void BeaconInfoCallback(StaWifiMac::ApInfo apInfo);
+    /**
+     * Stop the generation of Beacon frames by the given AP
+     * \param apDevice the device of the AP
+     */
+    void TurnBeaconGenerationOff(Ptr<NetDevice> apDevice);
+
+    Time m_assocTime;                          ///< time the STA associated
+    Time m_deAssocTime;                        ///< time the STA disassociated
+    Time m_beaconStopTime;                     ///< time the first AP stopped sending Beacons
+    Time m_lastBeaconArrival;                  ///< time the last Beacon of the own AP arrived
+    uint32_t m_beaconArrivals;                 ///< number of Beacons received from the own AP
+    uint32_t m_lateArrivals;                   ///< number of Beacons arrived after the stop
+    std::set<Mac48Address> m_beaconInfoBssids; ///< BSSIDs of the Beacon frames traced
+};
+
+StaWifiMacBeaconTestCase::StaWifiMacBeaconTestCase()
+    : TestCase("Test case for the handling of Beacon frames by an associated StaWifiMac")
+{
+}
+
+void
+StaWifiMacBeaconTestCase::AssocCallback(Mac48Address bssid)
+{
+    m_assocTime = Simulator::Now();
+}
+
+void
+StaWifiMacBeaconTestCase::DeAssocCallback(Mac48Address bssid)
+{
+    m_deAssocTime = Simulator::Now();
+}
+
+void
+StaWifiMacBeaconTestCase::BeaconArrivalCallback(Time time)
+{
+    m_beaconArrivals++;
+    m_lastBeaconArrival = time;
+    if (!m_beaconStopTime.IsZero())
+    {
+        m_lateArrivals++;
+    }
+}
+
+void
+StaWifiMacBeaconTestCase::BeaconInfoCallback(StaWifiMac::ApInfo apInfo)
+{
+    m_beaconInfoBssids.insert(apInfo.m_bssid);
+}
+
+void
+StaWifiMacBeaconTestCase::TurnBeaconGenerationOff(Ptr<NetDevice> apDevice)
+{
+    auto mac = DynamicCast<WifiNetDevice>(apDevice)->GetMac();
+    mac->SetAttribute("BeaconGeneration", BooleanValue(false));
+    // let a Beacon frame being transmitted arrive
+    m_beaconStopTime = Simulator::Now() + MilliSeconds(5);
+}
+
+void
+StaWifiMacBeaconTestCase::RunOne(bool traceBeaconInfo)
+{
+    m_assocTime = Time();
+    m_deAssocTime = Time();
+    m_beaconStopTime = Time();
+    m_lastBeaconArrival = Time();
+    m_beaconArrivals = 0;
+    m_lateArrivals = 0;
+    m_beaconInfoBssids.clear();
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 1;
+    const uint32_t maxMissedBeacons = 5;
+
+    NodeContainer apNodes(2);
+    NodeContainer staNode(1);
+
+    YansWifiPhyHelper phy;
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager");
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(Ssid("own")));
+    NetDeviceContainer apDevices = wifi.Install(phy, mac, apNodes.Get(0));
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(Ssid("other")));
+    apDevices.Add(wifi.Install(phy, mac, apNodes.Get(1)));
+    mac.SetType("ns3::StaWifiMac",
+                "Ssid",
+                SsidValue(Ssid("own")),
+                "MaxMissedBeacons",
+                UintegerValue(maxMissedBeacons));
+    NetDeviceContainer staDevice = wifi.Install(phy, mac, staNode);
+
+    // Assign fixed streams to random variables in use
+    wifi.AssignStreams(apDevices, streamNumber);
+    wifi.AssignStreams(staDevice, streamNumber + 2);
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));  // own AP
+    positionAlloc->Add(Vector(10.0, 0.0, 0.0)); // other AP
+    positionAlloc->Add(Vector(5.0, 0.0, 0.0));  // STA
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNodes);
+    mobility.Install(staNode);
+
+    auto staMac = DynamicCast<WifiNetDevice>(staDevice.Get(0))->GetMac();
+    staMac->TraceConnectWithoutContext(
+        "Assoc",
+        MakeCallback(&StaWifiMacBeaconTestCase::AssocCallback, this));
+    staMac->TraceConnectWithoutContext(
+        "DeAssoc",
+        MakeCallback(&StaWifiMacBeaconTestCase::DeAssocCallback, this));
+    staMac->TraceConnectWithoutContext(
+        "BeaconArrival",
+        MakeCallback(&StaWifiMacBeaconTestCase::BeaconArrivalCallback, this));
+    if (traceBeaconInfo)
+    {
+        staMac->TraceConnectWithoutContext(
+            "ReceivedBeaconInfo",
+            MakeCallback(&StaWifiMacBeaconTestCase::BeaconInfoCallback, this));
+    }
+
+    // the STA stays associated for longer than the beacon watchdog timeout
+    // thanks to the Beacon frames of its own AP
+    Simulator::Schedule(Seconds(1.5),
+                        &StaWifiMacBeaconTestCase::TurnBeaconGenerationOff,
+                        this,
+                        apDevices.Get(0));
+
+    Simulator::Stop(Seconds(2.5));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const Time beaconInterval = MicroSeconds(102400);
+    NS_TEST_ASSERT_MSG_EQ(m_assocTime.IsStrictlyPositive(), true, "STA did not associate");
+    NS_TEST_EXPECT_MSG_LT(m_assocTime,
+                          Seconds(1.5) - beaconInterval * maxMissedBeacons,
+                          "STA associated too late to check the beacon watchdog");
+    NS_TEST_EXPECT_MSG_GT(m_beaconArrivals,
+                          maxMissedBeacons,
+                          "Beacon frames of the own AP should be handled");
+    NS_TEST_EXPECT_MSG_EQ(m_lateArrivals,
+                          0,
+                          "Beacon frames of other BSSs should not be handled as own AP's");
+    NS_TEST_ASSERT_MSG_EQ(m_deAssocTime.IsStrictlyPositive(),
+                          true,
+                          "Beacon frames of other BSSs should not restart the beacon watchdog");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(m_deAssocTime,
+                                m_lastBeaconArrival + beaconInterval * maxMissedBeacons,
+                                "STA disassociated before missing MaxMissedBeacons Beacons");
+    NS_TEST_EXPECT_MSG_LT(m_deAssocTime,
+                          m_lastBeaconArrival + beaconInterval * (maxMissedBeacons + 1),
+                          "STA disassociated too late");
+    // the Beacon frames of both BSSs are traced if a callback is connected
+    NS_TEST_EXPECT_MSG_EQ(m_beaconInfoBssids.size(),
+                          (traceBeaconInfo ? 2 : 0),
+                          "Unexpected BSSIDs of the traced Beacon frames");
+}
+
+void
+StaWifiMacBeaconTestCase::DoRun()
+{
+    RunOne(false);
+    RunOne(true);
+}
+
 //-----------------------------------------------------------------------------
 /**
  * Make sure that the ADDBA handshake process is protected.
@@ -3652,6 +3871,7 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new Bug2843TestCase, TestCase::QUICK);            // Bug 2843
     AddTestCase(new Bug2831TestCase, TestCase::QUICK);            // Bug 2831
     AddTestCase(new StaWifiMacScanningTestCase, TestCase::QUICK); // Bug 2399
+    AddTestCase(new StaWifiMacBeaconTestCase, TestCase::QUICK);
     AddTestCase(new Bug2470TestCase, TestCase::QUICK);            // Bug 2470
     AddTestCase(new Issue40TestCase, TestCase::QUICK);            // Issue #40
     AddTestCase(new Issue169TestCase, TestCase::QUICK);           // Issue #169
@@ -0,0 +1,180 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the FlowMonitor bookkeeping
+// (flow classification, packet tracking and lost packet detection)
+// with a large number of short flows, without simulating any network.
+// Sample usage:  ./ns3 run 'bench-flow-monitor --flows=1000000'
+
+#include "ns3/abort.h"
+#include "ns3/command-line.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// FlowProbe reporting packets directly, without being attached to a node
+class BenchFlowProbe : public FlowProbe
+{
+  public:
+    /**
+     * Constructor
+     * \param monitor the FlowMonitor this probe reports to
+     */
+    BenchFlowProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/// Generator of short UDP flows, each one made of a few packets
+class FlowGenerator
+{
+  public:
+    /**
+     * Constructor
+     * \param flows number of flows
+     * \param packets number of packets per flow
+     * \param lossEvery one packet out of lossEvery is never received (0 for no losses)
+     */
+    FlowGenerator(uint32_t flows, uint32_t packets, uint32_t lossEvery)
+        : m_flows(flows),
+          m_packets(packets),
+          m_lossEvery(lossEvery)
+    {
+        m_monitor = CreateObject<FlowMonitor>();
+        m_monitor->SetAttribute("MaxPerHopDelay", TimeValue(Seconds(1)));
+        m_classifier = Create<Ipv4FlowClassifier>();
+        m_monitor->AddFlowClassifier(m_classifier);
+        m_probe = CreateObject<BenchFlowProbe>(m_monitor);
+    }
+
+    /// Start the flows; every flow starts 1 us after the previous one
+    void Start()
+    {
+        m_monitor->StartRightNow();
+        for (uint32_t flow = 0; flow < m_flows; flow++)
+        {
+            Simulator::Schedule(MicroSeconds(flow), &FlowGenerator::SendFlow, this, flow);
+        }
+    }
+
+    /// \return the flow monitor
+    Ptr<FlowMonitor> GetMonitor() const
+    {
+        return m_monitor;
+    }
+
+    /// \return the number of packets transmitted
+    uint64_t GetSentPackets() const
+    {
+        return m_sent;
+    }
+
+  private:
+    /**
+     * Transmit all the packets of a flow, one every 10 us.
+     * \param flow the flow index
+     */
+    void SendFlow(uint32_t flow)
+    {
+        Ipv4Header header;
+        header.SetSource(Ipv4Address(0x0a000000 + (flow >> 8)));
+        header.SetDestination(Ipv4Address(0x0b000000 + (flow & 0xff)));
+        header.SetProtocol(17);
+        uint8_t ports[4] = {static_cast<uint8_t>(flow >> 24),
+                            static_cast<uint8_t>(flow >> 16),
+                            0x13,
+                            0x89};
+        Ptr<Packet> payload = Create<Packet>(ports, 4);
+
+        for (uint32_t i = 0; i < m_packets; i++)
+        {
+            uint32_t flowId;
+            uint32_t packetId;
+            NS_ABORT_UNLESS(m_classifier->Classify(header, payload, &flowId, &packetId));
+            m_monitor->ReportFirstTx(m_probe, flowId, packetId, 1000);
+            ++m_sent;
+            if (m_lossEvery == 0 || (m_sent % m_lossEvery) != 0)
+            {
+                Simulator::Schedule(MicroSeconds(100 + 10 * i),
+                                    &FlowMonitor::ReportLastRx,
+                                    m_monitor,
+                                    m_probe,
+                                    flowId,
+                                    packetId,
+                                    1000);
+            }
+        }
+    }
+
+    uint32_t m_flows;                     //!< Number of flows
+    uint32_t m_packets;                   //!< Packets per flow
+    uint32_t m_lossEvery;                 //!< One packet out of m_lossEvery is lost
+    uint64_t m_sent{0};                   //!< Number of packets sent
+    Ptr<FlowMonitor> m_monitor;           //!< The flow monitor
+    Ptr<Ipv4FlowClassifier> m_classifier; //!< The flow classifier
+    Ptr<BenchFlowProbe> m_probe;          //!< The probe reporting the packets
+};
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t flows = 1000000;
+    uint32_t packets = 4;
+    uint32_t lossEvery = 100;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the FlowMonitor with many short flows");
+    cmd.AddValue("flows", "number of flows", flows);
+    cmd.AddValue("packets", "number of packets per flow", packets);
+    cmd.AddValue("lossEvery", "one packet out of lossEvery is lost (0 for no losses)", lossEvery);
+    cmd.Parse(argc, argv);
+
+    std::cout << "Running bench-flow-monitor with " << flows << " flows of " << packets
+              << " packets" << std::endl;
+
+    SystemWallClockMs clock;
+    clock.Start();
+
+    FlowGenerator generator(flows, packets, lossEvery);
+    generator.Start();
+    Simulator::Stop(MicroSeconds(flows) + Seconds(3));
+    Simulator::Run();
+
+    Ptr<FlowMonitor> monitor = generator.GetMonitor();
+    monitor->CheckForLostPackets();
+    uint64_t lost = 0;
+    for (const auto& [flowId, stats] : monitor->GetFlowStats())
+    {
+        lost += stats.lostPackets;
+    }
+    uint64_t elapsedMs = clock.End();
+
+    std::cout << monitor->GetFlowStats().size() << " flows, " << generator.GetSentPackets()
+              << " packets, " << lost << " lost" << std::endl;
+    std::cout << elapsedMs << " ms elapsed, " << generator.GetSentPackets() * 1000.0 / elapsedMs
+              << " packets/s" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the invocation of a TracedCallback
+// with the signature of the per-packet trace sources (a Ptr argument),
+// with no Callback connected and with a few Callbacks connected.
+// Sample usage:  ./ns3 run 'bench-traced-callback --calls=100000000'
+
+#include "ns3/command-line.h"
+#include "ns3/object.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/traced-callback.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// Number of times the sinks were invoked
+uint64_t g_sinkCalls = 0;
+
+/**
+ * Trace sink.
+ * \param object the traced object
+ * \param size the traced size
+ */
+void
+Sink(Ptr<const Object> object, uint32_t size)
+{
+    g_sinkCalls += size;
+}
+
+/**
+ * Invoke a TracedCallback and print the time per invocation.
+ * \param trace the TracedCallback
+ * \param object the object passed to the TracedCallback
+ * \param calls the number of invocations
+ */
+void
+Bench(const TracedCallback<Ptr<const Object>, uint32_t>& trace,
+      Ptr<const Object> object,
+      uint64_t calls)
+{
+    SystemWallClockMs clock;
+    clock.Start();
+    for (uint64_t i = 0; i < calls; i++)
+    {
+        trace(object, 1);
+    }
+    int64_t elapsedMs = clock.End();
+    std::cout << (elapsedMs * 1e6) / calls << " ns/call" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t calls = 10000000;
+    uint32_t sinks = 4;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the invocation of a TracedCallback");
+    cmd.AddValue("calls", "number of invocations of the TracedCallback", calls);
+    cmd.AddValue("sinks", "maximum number of connected Callbacks", sinks);
+    cmd.Parse(argc, argv);
+
+    Ptr<Object> object = CreateObject<Object>();
+    TracedCallback<Ptr<const Object>, uint32_t> trace;
+
+    for (uint32_t n = 0; n <= sinks; n++)
+    {
+        std::cout << n << " sinks: ";
+        Bench(trace, object, calls);
+        trace.ConnectWithoutContext(MakeCallback(&Sink));
+    }
+
+    std::cout << g_sinkCalls << " sink calls" << std::endl;
+    return 0;
+}
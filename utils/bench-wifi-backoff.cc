@@ -0,0 +1,132 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the channel access of a saturated BSS.
+// All the stations are in range of each other and send packets to the AP as fast
+// as possible, so that they keep contending for the medium and their backoff is
+// interrupted by the transmissions of the other stations. The number of events
+// processed by the simulator and the wall clock time are reported.
+// Sample usage:  ./ns3 run 'bench-wifi-backoff --stations=100 --duration=1'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/simulator.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// The number of packets received by the AP
+uint64_t g_received = 0;
+
+/**
+ * Count the packets received by the AP.
+ * \param packet the received packet
+ * \param from the address of the sender
+ */
+void
+Received(Ptr<const Packet> packet, const Address& from)
+{
+    ++g_received;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t stations = 100;
+    double duration = 1;
+    uint32_t payloadSize = 1000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the channel access of a saturated BSS");
+    cmd.AddValue("stations", "number of stations", stations);
+    cmd.AddValue("duration", "simulated time in seconds", duration);
+    cmd.AddValue("payloadSize", "size of the packets in bytes", payloadSize);
+    cmd.Parse(argc, argv);
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(stations);
+
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate54Mbps"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    WifiMacHelper mac;
+    Ssid ssid = Ssid("bench");
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(ssid), "ActiveProbing", BooleanValue(false));
+    NetDeviceContainer staDevices = wifi.Install(phy, mac, staNodes);
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    PacketSocketAddress socket;
+    socket.SetSingleDevice(apDevice.Get(0)->GetIfIndex());
+    socket.SetPhysicalAddress(apDevice.Get(0)->GetAddress());
+    socket.SetProtocol(1);
+
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient>();
+        client->SetAttribute("PacketSize", UintegerValue(payloadSize));
+        client->SetAttribute("MaxPackets", UintegerValue(0));
+        client->SetAttribute("Interval", TimeValue(MilliSeconds(1)));
+        client->SetRemote(socket);
+        staNodes.Get(i)->AddApplication(client);
+        client->SetStartTime(Seconds(0.5));
+    }
+
+    Ptr<PacketSocketServer> server = CreateObject<PacketSocketServer>();
+    server->SetLocal(socket);
+    server->TraceConnectWithoutContext("Rx", MakeCallback(&Received));
+    apNode.Get(0)->AddApplication(server);
+
+    Simulator::Stop(Seconds(0.5 + duration));
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << Simulator::GetEventCount() << " events, " << g_received
+              << " packets received, " << elapsedMs << " ms" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
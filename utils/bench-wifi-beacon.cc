@@ -0,0 +1,136 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the transmission and reception of
+// Beacon frames in a static deployment with many BSSs operating on the same
+// channel. APs are placed on a grid and each AP has a number of stations
+// placed around it. Every station associates with its own AP (each BSS has
+// a distinct SSID) and then only receives Beacon frames, most of which are
+// transmitted by other APs. The number of events processed by the simulator,
+// the number of associated stations and the wall clock time are reported.
+// Sample usage:  ./ns3 run 'bench-wifi-beacon --aps=50 --stations=4 --duration=5'
+
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <cmath>
+#include <iostream>
+
+using namespace ns3;
+
+/// The number of associations
+uint32_t g_associations = 0;
+
+/**
+ * Count the associations.
+ * \param context the context of the trace source
+ * \param bssid the BSSID of the AP
+ */
+void
+Associated(std::string context, Mac48Address bssid)
+{
+    ++g_associations;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t aps = 50;
+    uint32_t stations = 4;
+    double distance = 20;
+    double duration = 5;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the transmission and reception of Beacon frames");
+    cmd.AddValue("aps", "number of APs", aps);
+    cmd.AddValue("stations", "number of stations per AP", stations);
+    cmd.AddValue("distance", "distance in meters between adjacent APs", distance);
+    cmd.AddValue("duration", "simulated time in seconds", duration);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs7"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    auto side = static_cast<uint32_t>(std::ceil(std::sqrt(aps)));
+
+    NodeContainer nodes;
+    for (uint32_t i = 0; i < aps; i++)
+    {
+        NodeContainer apNode(1);
+        NodeContainer staNodes(stations);
+        Vector apPosition(distance * (i % side), distance * (i / side), 0.0);
+        positionAlloc->Add(apPosition);
+        for (uint32_t j = 0; j < stations; j++)
+        {
+            double angle = 2 * M_PI * j / stations;
+            positionAlloc->Add(Vector(apPosition.x + std::cos(angle) * distance / 4,
+                                      apPosition.y + std::sin(angle) * distance / 4,
+                                      0.0));
+        }
+
+        WifiMacHelper mac;
+        Ssid ssid = Ssid("bench-" + std::to_string(i));
+        mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(ssid));
+        NetDeviceContainer staDevices = wifi.Install(phy, mac, staNodes);
+        mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+        NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+        wifi.AssignStreams(apDevice, 100 * i);
+        wifi.AssignStreams(staDevices, 100 * i + 10);
+
+        nodes.Add(apNode);
+        nodes.Add(staNodes);
+    }
+
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    Config::Connect("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/$ns3::StaWifiMac/Assoc",
+                    MakeCallback(&Associated));
+
+    Simulator::Stop(Seconds(duration));
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << Simulator::GetEventCount() << " events, " << g_associations << " associations, "
+              << elapsedMs << " ms" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the WifiMacQueue of an AP serving
+// many stations. Every millisecond, an MPDU is enqueued for each station and
+// the MPDU at the head of the container queue of one station out of two is
+// dequeued. MPDUs that are not dequeued expire, and the queue fills up, so
+// that the MPDUs with expired lifetime have to be removed to make room for
+// the new ones.
+// Sample usage:  ./ns3 run 'bench-wifi-mac-queue --stations=500 --duration=2'
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/fcfs-wifi-queue-scheduler.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/wifi-mac-queue.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/// The queue under test
+Ptr<WifiMacQueue> g_queue;
+/// The addresses of the stations
+std::vector<Mac48Address> g_stations;
+/// The number of MPDUs enqueued
+uint64_t g_enqueued = 0;
+
+/**
+ * Enqueue an MPDU for each station, dequeue an MPDU for one station out of two
+ * and schedule the next round.
+ * \param round the index of this round
+ */
+void
+Round(uint32_t round)
+{
+    for (const auto& station : g_stations)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(station);
+        header.SetQosTid(0);
+        g_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(1000), header));
+        ++g_enqueued;
+    }
+    for (std::size_t i = round % 2; i < g_stations.size(); i += 2)
+    {
+        if (auto mpdu = g_queue->PeekByTidAndAddress(0, g_stations[i]))
+        {
+            g_queue->DequeueIfQueued({mpdu});
+        }
+    }
+    Simulator::Schedule(MilliSeconds(1), &Round, round + 1);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t stations = 500;
+    uint32_t maxSize = 5000;
+    double maxDelay = 20;
+    double duration = 2;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the WifiMacQueue of an AP serving many stations");
+    cmd.AddValue("stations", "number of stations", stations);
+    cmd.AddValue("maxSize", "maximum number of MPDUs in the queue", maxSize);
+    cmd.AddValue("maxDelay", "lifetime of the MPDUs in milliseconds", maxDelay);
+    cmd.AddValue("duration", "simulated time in seconds", duration);
+    cmd.Parse(argc, argv);
+
+    auto mac = CreateObjectWithAttributes<ApWifiMac>("QosSupported", BooleanValue(true));
+    mac->SetMacQueueScheduler(CreateObject<FcfsWifiQueueScheduler>());
+    g_queue = mac->GetTxopQueue(AC_BE);
+    g_queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, maxSize));
+    g_queue->SetMaxDelay(MilliSeconds(maxDelay));
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        g_stations.push_back(Mac48Address::Allocate());
+    }
+
+    Simulator::Schedule(Seconds(0), &Round, 0);
+    Simulator::Stop(Seconds(duration));
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << g_enqueued << " MPDUs enqueued, " << g_queue->GetTotalDroppedPackets()
+              << " dropped, " << (elapsedMs * 1e6) / g_enqueued << " ns/MPDU" << std::endl;
+
+    g_queue = nullptr;
+    mac->Dispose();
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the Minstrel-HT rate control algorithm
+// at an 802.11ax AP serving many stations. The stations are placed at increasing
+// distances from the AP, so that different rates are selected for different
+// stations, and the AP sends packets to every station. The number of events
+// processed by the simulator, the number of packets received and the wall clock
+// time are reported.
+// Sample usage:  ./ns3 run 'bench-wifi-minstrel --stations=200 --duration=2'
+
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/// The number of packets received
+uint64_t g_received = 0;
+
+/**
+ * Count the received packets.
+ * \param packet the received packet
+ * \param from the address of the sender
+ */
+void
+Received(Ptr<const Packet> packet, const Address& from)
+{
+    ++g_received;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t stations = 200;
+    double maxDistance = 60;
+    double duration = 2;
+    uint32_t payloadSize = 1000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the Minstrel-HT rate control algorithm");
+    cmd.AddValue("stations", "number of stations", stations);
+    cmd.AddValue("maxDistance", "distance in meters of the farthest station", maxDistance);
+    cmd.AddValue("duration", "simulated time with traffic in seconds", duration);
+    cmd.AddValue("payloadSize", "size of the packets in bytes", payloadSize);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(stations);
+
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    phy.Set("ChannelSettings", StringValue("{0, 80, BAND_5GHZ, 0}"));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::MinstrelHtWifiManager");
+
+    WifiMacHelper mac;
+    Ssid ssid = Ssid("bench");
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer staDevices = wifi.Install(phy, mac, staNodes);
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    wifi.AssignStreams(apDevice, 100);
+    wifi.AssignStreams(staDevices, 1000);
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        positionAlloc->Add(Vector(maxDistance * (i + 1) / stations, 0.0, 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(apDevice.Get(0)->GetIfIndex());
+        socket.SetPhysicalAddress(staDevices.Get(i)->GetAddress());
+        socket.SetProtocol(1);
+
+        Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient>();
+        client->SetAttribute("PacketSize", UintegerValue(payloadSize));
+        client->SetAttribute("MaxPackets", UintegerValue(0));
+        client->SetAttribute("Interval", TimeValue(MilliSeconds(2)));
+        client->SetRemote(socket);
+        apNode.Get(0)->AddApplication(client);
+        client->SetStartTime(Seconds(1));
+
+        Ptr<PacketSocketServer> server = CreateObject<PacketSocketServer>();
+        server->SetLocal(socket);
+        server->TraceConnectWithoutContext("Rx", MakeCallback(&Received));
+        staNodes.Get(i)->AddApplication(server);
+    }
+
+    Simulator::Stop(Seconds(1 + duration));
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << Simulator::GetEventCount() << " events, " << g_received
+              << " packets received, " << elapsedMs << " ms" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark how the simulation of 802.11be
+// multi-link devices scales with the number of links. An AP MLD and a number
+// of non-AP MLDs operate on up to three links (on the 2.4, 5 and 6 GHz bands).
+// Once all the non-AP MLDs have performed ML setup, every non-AP MLD sends
+// a packet to the AP MLD and the AP MLD sends a packet to every non-AP MLD
+// every 100 microseconds, which saturates the links. The number of events
+// processed by the simulator, the wall clock time and the number of packets
+// received are reported.
+// Sample usage:  ./ns3 run 'bench-wifi-mlo --stations=10 --links=3 --duration=0.5'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/ssid.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-net-device.h"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+/// The number of packets received
+uint64_t g_received = 0;
+/// The MACs of the non-AP MLDs
+std::vector<Ptr<StaWifiMac>> g_staMacs;
+/// The AID of the last non-AP MLD that completed ML setup
+uint16_t g_lastAid = 0;
+/// The devices of the non-AP MLDs
+NetDeviceContainer g_staDevices;
+/// The device of the AP MLD
+Ptr<NetDevice> g_apDevice;
+/// The size of the packets in bytes
+uint32_t g_payloadSize;
+/// The simulated time with traffic
+Time g_duration;
+
+/**
+ * Count the received packets.
+ * \param packet the received packet
+ * \param from the address of the sender
+ */
+void
+Received(Ptr<const Packet> packet, const Address& from)
+{
+    ++g_received;
+}
+
+/**
+ * Install the applications generating the uplink and downlink flows and stop
+ * the simulation after the configured duration.
+ */
+void
+StartTraffic()
+{
+    // a client on each non-AP MLD sends packets to the AP MLD and a client on
+    // the AP MLD sends packets to each non-AP MLD
+    std::vector<std::pair<Ptr<NetDevice>, Ptr<NetDevice>>> flows;
+    for (uint32_t i = 0; i < g_staDevices.GetN(); i++)
+    {
+        flows.emplace_back(g_staDevices.Get(i), g_apDevice);
+        flows.emplace_back(g_apDevice, g_staDevices.Get(i));
+    }
+
+    for (const auto& [from, to] : flows)
+    {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(from->GetIfIndex());
+        socket.SetPhysicalAddress(to->GetAddress());
+        socket.SetProtocol(1);
+
+        Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient>();
+        client->SetAttribute("PacketSize", UintegerValue(g_payloadSize));
+        client->SetAttribute("MaxPackets", UintegerValue(0));
+        client->SetAttribute("Interval", TimeValue(MicroSeconds(100)));
+        client->SetRemote(socket);
+        from->GetNode()->AddApplication(client);
+    }
+
+    // a server on each MLD
+    for (uint32_t i = 0; i <= g_staDevices.GetN(); i++)
+    {
+        Ptr<NetDevice> dev = (i < g_staDevices.GetN() ? g_staDevices.Get(i) : g_apDevice);
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(dev->GetIfIndex());
+        socket.SetPhysicalAddress(dev->GetAddress());
+        socket.SetProtocol(1);
+
+        Ptr<PacketSocketServer> server = CreateObject<PacketSocketServer>();
+        server->SetLocal(socket);
+        server->TraceConnectWithoutContext("Rx", MakeCallback(&Received));
+        dev->GetNode()->AddApplication(server);
+    }
+    Simulator::Stop(g_duration);
+}
+
+/**
+ * Make the next non-AP MLD start ML setup, or start the traffic if all the
+ * non-AP MLDs have completed ML setup.
+ * \param aid the AID assigned to the non-AP MLD that completed ML setup
+ * \param address the address of the non-AP MLD that completed ML setup
+ */
+void
+AssociatedSta(uint16_t aid, Mac48Address address)
+{
+    if (aid == g_lastAid)
+    {
+        // another STA of this non-AP MLD has already fired this callback
+        return;
+    }
+    g_lastAid = aid;
+    if (aid < g_staMacs.size())
+    {
+        g_staMacs[aid]->SetSsid(Ssid("bench"));
+        return;
+    }
+    // let the last non-AP MLD receive the Association Response
+    Simulator::Schedule(MilliSeconds(5), &StartTraffic);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t stations = 10;
+    uint32_t links = 3;
+    double duration = 0.5;
+    uint32_t payloadSize = 1000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the simulation of multi-link devices");
+    cmd.AddValue("stations", "number of non-AP MLDs", stations);
+    cmd.AddValue("links", "number of links (1 to 3)", links);
+    cmd.AddValue("duration", "simulated time with traffic in seconds", duration);
+    cmd.AddValue("payloadSize", "size of the packets in bytes", payloadSize);
+    cmd.Parse(argc, argv);
+    g_duration = Seconds(duration);
+    g_payloadSize = payloadSize;
+    NS_ABORT_MSG_IF(links < 1 || links > 3, "The number of links must be between 1 and 3");
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(stations);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211be);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("EhtMcs7"),
+                                 "ControlMode",
+                                 StringValue("HtMcs0"));
+
+    const std::vector<std::string> channels{"{42, 80, BAND_5GHZ, 0}",
+                                            "{23, 80, BAND_6GHZ, 0}",
+                                            "{6, 40, BAND_2_4GHZ, 0}"};
+    SpectrumWifiPhyHelper phy(links);
+    phy.SetChannel(CreateObject<MultiModelSpectrumChannel>());
+    for (uint8_t linkId = 0; linkId < links; linkId++)
+    {
+        phy.Set(linkId, "ChannelSettings", StringValue(channels[linkId]));
+    }
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::StaWifiMac", "ActiveProbing", BooleanValue(false));
+    NetDeviceContainer staDevices = wifi.Install(phy, mac, staNodes);
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(Ssid("bench")));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    wifi.AssignStreams(apDevice, 100);
+    wifi.AssignStreams(staDevices, 1000);
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    g_staDevices = staDevices;
+    g_apDevice = apDevice.Get(0);
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        g_staMacs.push_back(
+            DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(staDevices.Get(i))->GetMac()));
+    }
+
+    // perform ML setup one non-AP MLD at a time
+    auto apMac = DynamicCast<WifiNetDevice>(g_apDevice)->GetMac();
+    apMac->TraceConnectWithoutContext("AssociatedSta", MakeCallback(&AssociatedSta));
+    Simulator::Schedule(Seconds(0), [&]() { g_staMacs[0]->SetSsid(Ssid("bench")); });
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << links << " links: " << Simulator::GetEventCount() << " events, " << g_received
+              << " packets received, " << elapsedMs << " ms" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the multi-user scheduler of an 802.11ax
+// AP serving many stations. The AP sends packets to every station and every
+// station sends packets to the AP, so that the AP keeps scheduling DL MU PPDUs
+// and Trigger Frames soliciting TB PPDUs. The number of events processed by the
+// simulator, the number of packets received and the wall clock time are reported.
+// At the end of the simulation, the multi-user scheduler of the AP is repeatedly
+// notified that the AP gained channel access, while the queues of the AP still
+// hold frames for the stations, and statistics of the time taken by each call
+// (scheduling latency) are reported for each format of the selected transmission.
+// Sample usage:  ./ns3 run 'bench-wifi-ofdma --stations=70 --width=80 --ruStations=16'
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/he-configuration.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/multi-user-scheduler.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/qos-txop.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-acknowledgment.h"
+#include "ns3/wifi-net-device.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace ns3;
+
+/// The number of packets received
+uint64_t g_received = 0;
+
+/**
+ * Count the received packets.
+ * \param packet the received packet
+ * \param from the address of the sender
+ */
+void
+Received(Ptr<const Packet> packet, const Address& from)
+{
+    ++g_received;
+}
+
+/**
+ * Notify the multi-user scheduler of the given AP that channel access was gained
+ * the given number of times and print statistics of the time taken by each call.
+ * \param apMac the MAC of the AP
+ * \param accesses the number of channel accesses
+ */
+void
+MeasureSchedulingLatency(Ptr<ApWifiMac> apMac, uint32_t accesses)
+{
+    /// Statistics of the scheduling latency for a TX format
+    struct Stats
+    {
+        uint32_t count{0}; //!< number of calls
+        double totalUs{0}; //!< total time taken by the calls in microseconds
+        double maxUs{0};   //!< maximum time taken by a call in microseconds
+    };
+
+    std::map<MultiUserScheduler::TxFormat, Stats> stats;
+    auto muScheduler = apMac->GetObject<MultiUserScheduler>();
+    auto edca = apMac->GetQosTxop(AC_BE);
+    const auto width = apMac->GetWifiPhy()->GetChannelWidth();
+
+    for (uint32_t i = 0; i < accesses; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto txFormat = muScheduler->NotifyAccessGranted(edca, Time::Min(), true, width, 0);
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        auto& entry = stats[txFormat];
+        entry.count++;
+        entry.totalUs += elapsed.count();
+        entry.maxUs = std::max(entry.maxUs, elapsed.count());
+    }
+
+    const std::map<MultiUserScheduler::TxFormat, std::string> names{
+        {MultiUserScheduler::NO_TX, "NO_TX"},
+        {MultiUserScheduler::SU_TX, "SU_TX"},
+        {MultiUserScheduler::DL_MU_TX, "DL_MU_TX"},
+        {MultiUserScheduler::UL_MU_TX, "UL_MU_TX"}};
+    for (const auto& [txFormat, entry] : stats)
+    {
+        std::cout << names.at(txFormat) << ": " << entry.count << " accesses, "
+                  << entry.totalUs / entry.count << " us/access on average, " << entry.maxUs
+                  << " us at most" << std::endl;
+    }
+    Simulator::Stop();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t stations = 70;
+    uint16_t width = 80;
+    uint32_t ruStations = 16;
+    double duration = 0.1;
+    uint32_t payloadSize = 1000;
+    uint32_t accesses = 10000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the multi-user scheduler of an 802.11ax AP");
+    cmd.AddValue("stations", "number of stations", stations);
+    cmd.AddValue("width", "channel width in MHz (20, 40, 80 or 160)", width);
+    cmd.AddValue("ruStations",
+                 "maximum number of stations that are granted an RU in a DL MU PPDU",
+                 ruStations);
+    cmd.AddValue("duration", "simulated time with traffic in seconds", duration);
+    cmd.AddValue("payloadSize", "size of the packets in bytes", payloadSize);
+    cmd.AddValue("accesses",
+                 "number of channel accesses notified to the scheduler to measure its latency",
+                 accesses);
+    cmd.Parse(argc, argv);
+
+    Config::SetDefault("ns3::WifiDefaultAckManager::DlMuAckSequenceType",
+                       EnumValue(WifiAcknowledgment::DL_MU_AGGREGATE_TF));
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(stations);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs7"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    std::ostringstream channel;
+    channel << "{0, " << width << ", BAND_5GHZ, 0}";
+    SpectrumWifiPhyHelper phy;
+    phy.SetChannel(CreateObject<MultiModelSpectrumChannel>());
+    phy.Set("ChannelSettings", StringValue(channel.str()));
+
+    WifiMacHelper mac;
+    Ssid ssid = Ssid("bench");
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer staDevices = wifi.Install(phy, mac, staNodes);
+    mac.SetMultiUserScheduler("ns3::RrMultiUserScheduler",
+                              "NStations",
+                              UintegerValue(ruStations),
+                              "EnableUlOfdma",
+                              BooleanValue(true),
+                              "EnableBsrp",
+                              BooleanValue(true));
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    wifi.AssignStreams(apDevice, 100);
+    wifi.AssignStreams(staDevices, 1000);
+
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    NetDeviceContainer devices(apDevice, staDevices);
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        PacketSocketAddress local;
+        local.SetSingleDevice(devices.Get(i)->GetIfIndex());
+        local.SetPhysicalAddress(devices.Get(i)->GetAddress());
+        local.SetProtocol(1);
+
+        Ptr<PacketSocketServer> server = CreateObject<PacketSocketServer>();
+        server->SetLocal(local);
+        server->TraceConnectWithoutContext("Rx", MakeCallback(&Received));
+        devices.Get(i)->GetNode()->AddApplication(server);
+    }
+
+    for (uint32_t i = 0; i < stations; i++)
+    {
+        // downlink and uplink flows
+        for (auto [from, to] : {std::make_pair(apDevice.Get(0), staDevices.Get(i)),
+                                std::make_pair(staDevices.Get(i), apDevice.Get(0))})
+        {
+            PacketSocketAddress remote;
+            remote.SetSingleDevice(from->GetIfIndex());
+            remote.SetPhysicalAddress(to->GetAddress());
+            remote.SetProtocol(1);
+
+            Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient>();
+            client->SetAttribute("PacketSize", UintegerValue(payloadSize));
+            client->SetAttribute("MaxPackets", UintegerValue(0));
+            client->SetAttribute("Interval", TimeValue(MilliSeconds(1)));
+            client->SetRemote(remote);
+            from->GetNode()->AddApplication(client);
+            client->SetStartTime(Seconds(1));
+        }
+    }
+
+    auto apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice.Get(0))->GetMac());
+    Simulator::Schedule(Seconds(1 + duration), &MeasureSchedulingLatency, apMac, accesses);
+
+    SystemWallClockMs clock;
+    clock.Start();
+    Simulator::Run();
+    int64_t elapsedMs = clock.End();
+
+    std::cout << Simulator::GetEventCount() << " events, " << g_received
+              << " packets received, " << elapsedMs << " ms" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the computation of the TX duration of
+// the PSDUs by WifiPhy, following the pattern of the A-MPDU aggregation: the
+// TX duration of the A-MPDU is computed again each time an MPDU is added, for
+// 802.11ax SU PPDUs with all the HE MCSs, with and without the TX duration cache.
+// Sample usage:  ./ns3 run 'bench-wifi-tx-duration --ampdus=100000'
+
+#include "ns3/command-line.h"
+#include "ns3/he-phy.h"
+#include "ns3/mpdu-aggregator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-tx-vector.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Compute the TX durations of A-MPDUs made of an increasing number of MPDUs
+ * and print the time per computation.
+ * \param ampdus the number of A-MPDUs
+ * \param mpdus the maximum number of MPDUs per A-MPDU
+ * \param mpduSize the size of each MPDU
+ * \return the sum of the TX durations, so that the computation is not optimized away
+ */
+Time
+Bench(uint32_t ampdus, uint32_t mpdus, uint32_t mpduSize)
+{
+    WifiTxVector txVector;
+    txVector.SetPreambleType(WIFI_PREAMBLE_HE_SU);
+    txVector.SetChannelWidth(80);
+    txVector.SetGuardInterval(800);
+    txVector.SetNss(1);
+    Time total;
+    uint64_t calls = 0;
+    SystemWallClockMs clock;
+    clock.Start();
+    for (uint32_t ampdu = 0; ampdu < ampdus; ampdu++)
+    {
+        txVector.SetMode(HePhy::GetHeMcs(ampdu % 12));
+        uint32_t ampduSize = 0;
+        for (uint32_t mpdu = 0; mpdu < mpdus; mpdu++)
+        {
+            ampduSize = MpduAggregator::GetSizeIfAggregated(mpduSize, ampduSize);
+            total += WifiPhy::CalculateTxDuration(ampduSize, txVector, WIFI_PHY_BAND_5GHZ);
+            ++calls;
+        }
+    }
+    int64_t elapsedMs = clock.End();
+    std::cout << (elapsedMs * 1e6) / calls << " ns/call" << std::endl;
+    return total;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t ampdus = 100000;
+    uint32_t mpdus = 64;
+    uint32_t mpduSize = 1538;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the computation of the TX duration of A-MPDUs");
+    cmd.AddValue("ampdus", "number of A-MPDUs", ampdus);
+    cmd.AddValue("mpdus", "maximum number of MPDUs per A-MPDU", mpdus);
+    cmd.AddValue("mpduSize", "size of each MPDU in bytes", mpduSize);
+    cmd.Parse(argc, argv);
+
+    std::cout << "without cache: ";
+    WifiPhy::SetTxDurationCacheSize(0);
+    Time uncached = Bench(ampdus, mpdus, mpduSize);
+
+    std::cout << "with cache:    ";
+    WifiPhy::SetTxDurationCacheSize(4096);
+    Time cached = Bench(ampdus, mpdus, mpduSize);
+
+    if (cached != uncached)
+    {
+        std::cerr << "the cached TX durations differ from the computed ones" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/campaign-runner.h"
+#include "ns3/core-module.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Split a string on a separator.
+ *
+ * \param [in] str The string to split.
+ * \param [in] separator The separator.
+ * \returns The non-empty tokens.
+ */
+std::vector<std::string>
+Split(const std::string& str, char separator)
+{
+    std::vector<std::string> tokens;
+    std::istringstream iss(str);
+    std::string token;
+    while (std::getline(iss, token, separator))
+    {
+        if (!token.empty())
+        {
+            tokens.push_back(token);
+        }
+    }
+    return tokens;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string program;
+    std::string db = "campaign.db";
+    std::string name;
+    std::string params;
+    std::string fixedArgs;
+    uint32_t runs = 1;
+    uint32_t firstRun = 1;
+    uint32_t jobs = 1;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Run a parameter sweep of an ns-3 program in a pool of processes.\n"
+              "\n"
+              "The grid is given by --params=\"name1=v1,v2;name2=v3,v4\": every\n"
+              "combination is run --runs times, with --RngRun taking the values\n"
+              "--firstRun, --firstRun + 1, ...  Results are stored in the\n"
+              "CampaignRuns table of --db; runs already completed in the database\n"
+              "are skipped, so an interrupted campaign is resumed by re-running\n"
+              "the same command.");
+    cmd.AddValue("program", "path of the program to run", program);
+    cmd.AddValue("db", "SQLite database storing the results", db);
+    cmd.AddValue("name", "campaign name (defaults to the program path)", name);
+    cmd.AddValue("params", "parameter grid, as name=v1,v2;name2=v3", params);
+    cmd.AddValue("args", "space separated arguments passed to every run", fixedArgs);
+    cmd.AddValue("runs", "number of replications per grid point", runs);
+    cmd.AddValue("firstRun", "RngRun value of the first replication", firstRun);
+    cmd.AddValue("jobs", "maximum number of concurrent runs", jobs);
+    cmd.Parse(argc, argv);
+
+    if (program.empty())
+    {
+        std::cerr << "A program to run must be given with --program" << std::endl;
+        return 1;
+    }
+
+    CampaignRunner runner(program, db);
+    if (!name.empty())
+    {
+        runner.SetCampaignName(name);
+    }
+    for (const auto& param : Split(params, ';'))
+    {
+        auto pos = param.find('=');
+        if (pos == std::string::npos)
+        {
+            std::cerr << "Malformed parameter " << param << ", expected name=v1,v2" << std::endl;
+            return 1;
+        }
+        runner.AddParameter(param.substr(0, pos), Split(param.substr(pos + 1), ','));
+    }
+    for (const auto& arg : Split(fixedArgs, ' '))
+    {
+        runner.AddFixedArgument(arg);
+    }
+    runner.SetRuns(runs, firstRun);
+    runner.SetMaxConcurrency(jobs);
+
+    std::size_t total = runner.GetRuns().size();
+    std::size_t done = runner.GetCompletedRuns();
+    std::cout << "Campaign: " << total << " runs, " << done << " already completed" << std::endl;
+
+    std::size_t failures = runner.Run();
+    std::cout << "Campaign finished: " << runner.GetCompletedRuns() << "/" << total
+              << " runs completed, " << failures << " failed" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}